@@ -116,6 +116,8 @@ class AIM::Grid_Aerosol
 
         /* Coagulation */
         void Coagulate( const double dt, Coagulation &kernel, const UInt N = 2, const UInt SYM = 0 );
+        /* Cell-parallel coagulation with local (T, P) kernels from the KernelCache */
+        void Coagulate( const double dt, const Vector_2D &T, const Vector_1D &P, const char* phase, const double rho, const UInt N = 2, const UInt SYM = 0 );
 
         /* Ice crystal growth */
         void Grow( const double dt, Vector_2D &H2O, const Vector_2D &T, const Vector_1D &P, const UInt N = 2, const UInt SYM = 0 );
@@ -32,6 +32,7 @@ namespace AIM
     class Grid_Aerosol;
 
     class Coagulation;
+    struct CoagulationMap;
 
 }
 
@@ -47,10 +48,13 @@ class AIM::Coagulation
         Coagulation( const char* phase, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1, double rho_1, Vector_1D const &bin_Centers_2, double rho_2, double temperature_K_, double pressure_Pa_ );
         Coagulation( const char* phase, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1, double rho_1, double temperature_K_, double pressure_Pa_ );
         Coagulation( const char* phase, Vector_1D const &bin_Centers_1, double rho_1, double bin_Centers_2, double rho_2, double temperature_K_, double pressure_Pa_ );
+        Coagulation( const char* phase, const Vector_2D &kernel, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1 );
             
         ~Coagulation( );
         Coagulation( const Coagulation& k );
         Coagulation& operator=( const Coagulation& k );
+        void updateKernel( const char* phase, const Vector_2D &kernel, const Vector_1D &bin_Centers );
+        void buildBeta( const char* phase, const Vector_1D &bin_Centers );
         void buildBeta( const Vector_1D &bin_Centers );
         void buildF( const Vector_1D &bin_VCenters );
         void buildF( const Vector_3D &bin_VCenters, const UInt jNy, const UInt iNx );
@@ -78,5 +82,37 @@ class AIM::Coagulation
 
 };
 
+/* Sparse, single grid cell equivalent of Coagulation::f and
+ * Coagulation::indices. A particle formed by bins i and j has its volume
+ * split between bin target(i,j) (fraction fLow(i,j)) and bin target(i,j)+1
+ * (fraction 1 - fLow(i,j)), so storage and rebuild cost are O(nBin^2)
+ * instead of O(nBin^3). */
+struct AIM::CoagulationMap
+{
+
+    void build( const Vector_1D &bin_VCenters );
+
+    inline UInt target( UInt iBin, UInt jBin ) const { return targets[iBin * nBin + jBin]; };
+    inline double fLow( UInt iBin, UInt jBin ) const { return fractions[iBin * nBin + jBin]; };
+    /* Is part of the volume also put into bin target(i,j)+1? */
+    inline bool splits( UInt iBin, UInt jBin ) const { return targets[iBin * nBin + jBin] < nBin - 1; };
+    /* Equivalent to Coagulation::f[iBin][jBin][kBin] */
+    inline double f( UInt iBin, UInt jBin, UInt kBin ) const {
+        const UInt t = target( iBin, jBin );
+        if ( kBin == t )
+            return fLow( iBin, jBin );
+        if ( kBin == t + 1 && splits( iBin, jBin ) )
+            return 1.0 - fLow( iBin, jBin );
+        return 0.0E+00;
+    };
+
+    UInt nBin = 0;
+    /* Volume centers the map was built for */
+    Vector_1D vCenters;
+    std::vector<UInt> targets;
+    Vector_1D fractions;
+
+};
+
 #endif /* COAGULATION_H_INCLUDED */
 
@@ -0,0 +1,126 @@
+#ifndef AIM_KERNELCACHE_H
+#define AIM_KERNELCACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Util/ForwardDecl.hpp"
+#include "AIM/buildKernel.hpp"
+
+namespace AIM {
+
+    /* Process-wide cache of total coagulation kernels (cm^3/s).
+     * Kernels are stored on nodes of a regular grid in (T, ln P) for each
+     * (phase, bin grid, densities) combination. Requests at arbitrary (T, P)
+     * are bilinearly interpolated between the four surrounding nodes, and
+     * missing nodes are built in parallel on first use.
+     * All public member functions are thread-safe. */
+    class KernelCache {
+        public:
+            /* Node spacing in temperature [K] and in ln(pressure) [-] */
+            struct Resolution {
+                double dT_K;
+                double dlnP;
+            };
+
+            static KernelCache& getInstance();
+
+            KernelCache(const KernelCache&) = delete;
+            KernelCache& operator=(const KernelCache&) = delete;
+
+            Vector_2D getKernel(const char* phase, double temperature_K, double pressure_Pa,
+                                const Vector_1D& bin_Centers_1, double rho_1,
+                                const Vector_1D& bin_Centers_2, double rho_2);
+            Vector_2D getKernel(const char* phase, double temperature_K, double pressure_Pa,
+                                const Vector_1D& bin_Centers, double rho) {
+                return getKernel(phase, temperature_K, pressure_Pa, bin_Centers, rho, bin_Centers, rho);
+            }
+
+            /* Batched lookup. Every node needed by any of the requested states
+             * is built once, in parallel, before interpolating. */
+            std::vector<Vector_2D> getKernels(const char* phase, const Vector_1D& temperature_K, const Vector_1D& pressure_Pa,
+                                              const Vector_1D& bin_Centers, double rho);
+
+            /* Kernels on the nodes (iT[s] * dT, exp(iP[s] * dlnP)) of the given
+             * resolution. Callers that interpolate between nodes themselves
+             * pass node indices rather than (T, P), which could round to a
+             * neighbouring node. Nodes of another resolution than the current
+             * one are built but not cached. */
+            std::vector<Vector_2D> getNodeKernels(const char* phase, const Resolution& resolution,
+                                                  const std::vector<long>& iT, const std::vector<long>& iP,
+                                                  const Vector_1D& bin_Centers, double rho);
+
+            /* Fill the nodes covering [Tmin, Tmax] x [Pmin, Pmax] ahead of time */
+            void precompute(const char* phase, double Tmin_K, double Tmax_K, double Pmin_Pa, double Pmax_Pa,
+                            const Vector_1D& bin_Centers, double rho);
+
+            /* Changing the resolution invalidates all cached nodes */
+            void setResolution(double dT_K, double dlnP);
+            /* Once the cache holds more than maxEntries nodes it is flushed.
+             * Kernels already handed out remain valid. */
+            void setMaxEntries(std::size_t maxEntries);
+
+            void clear();
+            std::size_t size() const;
+            Resolution resolution() const;
+
+        private:
+            KernelCache() = default;
+
+            /* Bin centers and densities of both distributions, compared in
+             * full so that a hash collision can never return another grid's kernel */
+            struct Grid {
+                Vector_1D bin_Centers_1;
+                double rho_1;
+                Vector_1D bin_Centers_2;
+                double rho_2;
+                std::size_t hash;
+                bool operator==(const Grid& other) const {
+                    return hash == other.hash && rho_1 == other.rho_1 && rho_2 == other.rho_2
+                        && bin_Centers_1 == other.bin_Centers_1 && bin_Centers_2 == other.bin_Centers_2;
+                }
+            };
+            typedef std::shared_ptr<const Grid> GridPtr;
+            struct Key {
+                std::string phase;
+                GridPtr grid;
+                long iT;
+                long iP;
+                bool operator==(const Key& other) const {
+                    return iT == other.iT && iP == other.iP && phase == other.phase
+                        && (grid == other.grid || *grid == *other.grid);
+                }
+            };
+            struct KeyHash {
+                std::size_t operator()(const Key& key) const;
+            };
+            struct NodeStencil {
+                Key keys[4];
+                double weights[4];
+            };
+            typedef std::shared_ptr<const Vector_2D> KernelPtr;
+
+            static GridPtr makeGrid(const Vector_1D& bin_Centers_1, double rho_1, const Vector_1D& bin_Centers_2, double rho_2);
+            /* Node indices and weights are computed for the given resolution, and
+             * acquire() builds the nodes for that same resolution, so that a
+             * concurrent setResolution() cannot mix spacings */
+            static NodeStencil stencil(const std::string& phase, const GridPtr& grid, const Resolution& resolution,
+                                       double temperature_K, double pressure_Pa);
+            /* Returns the kernels for the given nodes, building the missing ones in parallel */
+            std::vector<KernelPtr> acquire(const std::vector<Key>& keys, const Resolution& resolution);
+            static Vector_2D interpolate(const KernelPtr* kernels, const double* weights, std::size_t nNodes);
+
+            std::unordered_map<Key, KernelPtr, KeyHash> cache_;
+            mutable std::shared_mutex mutex_;
+            double dT_ = 1.0;
+            double dlnP_ = 0.02;
+            std::size_t maxEntries_ = 4096;
+    };
+
+}
+
+#endif
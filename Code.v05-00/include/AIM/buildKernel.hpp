@@ -17,6 +17,7 @@
 #include <iostream>
 #include <vector>
 #include <fstream>
+#include <cstring>
 
 #include "Util/ForwardDecl.hpp"
 #include "Util/PhysConstant.hpp"
@@ -44,6 +45,10 @@ namespace AIM
     /* Turbulent shear */
     Vector_1D buildTSKernel( double temperature_K, double pressure_Pa, Vector_1D const &bin_Centers, double rho_1, double bin_R, double rho_2 );
     Vector_2D buildTSKernel( double temperature_K, double pressure_Pa, Vector_1D const &bin_Centers_1, double rho_1, Vector_1D const &bin_Centers_2, double rho_2 );
+
+    /* Total coagulation kernel for a given phase, in cm^3/s.
+     * Liquid and soot use Brownian + DE, ice uses all five processes */
+    Vector_2D buildTotalKernel( const char* phase, double temperature_K, double pressure_Pa, Vector_1D const &bin_Centers_1, double rho_1, Vector_1D const &bin_Centers_2, double rho_2 );
     
 }
 
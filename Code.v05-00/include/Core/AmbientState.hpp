@@ -0,0 +1,50 @@
+#ifndef AMBIENTSTATE_H_INCLUDED
+#define AMBIENTSTATE_H_INCLUDED
+
+#include "Util/ForwardDecl.hpp"
+
+class Input;
+struct OptInput;
+class Meteorology;
+
+/* Ambient chemical state at a single grid cell along with the background
+ * aerosol summary, as the EPM needs them.
+ * Holds the same values as Solution::getData (without CHEMISTRY) and
+ * Solution::getAerosol after Solution::Initialize, without allocating the
+ * species and aerosol fields over the whole grid. */
+class AmbientState
+{
+
+    public:
+
+        /* Same arguments as Solution::Initialize, for the cell (i, j) of the
+         * ADV_GRID_NX x ADV_GRID_NY grid */
+        AmbientState( const char *fileName,      \
+                      const Input &input,        \
+                      const double airDens,      \
+                      const Meteorology &met,    \
+                      const OptInput &Input_Opt, \
+                      const UInt i, const UInt j,
+                      const bool DBG = 0 );
+
+        /* Fills NVAR variable and NFIX fixed species concentrations */
+        void getData( double* varSpeciesArray, double* fixSpeciesArray ) const;
+
+        /* Concentration of the NSPEC species [molec/cm^3] */
+        const Vector_1D& species() const { return species_; }
+        /* Same layout as Solution::getAerosol: [soot, solid, liquid][density, radius, area] */
+        const Vector_2D& aerosol() const { return aerosol_; }
+        /* Same as Solution::KHETI_SLA and Solution::STATE_PSC, for GC_SETHET */
+        const Vector_1D& KHETI_SLA() const { return KHETI_SLA_; }
+        UInt STATE_PSC() const { return STATE_PSC_; }
+
+    private:
+
+        Vector_1D species_;
+        Vector_2D aerosol_;
+        Vector_1D KHETI_SLA_;
+        UInt STATE_PSC_;
+
+};
+
+#endif /* AMBIENTSTATE_H_INCLUDED */
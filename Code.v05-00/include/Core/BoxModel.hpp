@@ -0,0 +1,50 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* BoxModel Header File                                             */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 3/18/2018                                 */
+/* File                 : BoxModel.hpp                              */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef BOXMODEL_H_INCLUDED
+#define BOXMODEL_H_INCLUDED
+
+#include <functional>
+#include "Util/ForwardDecl.hpp"
+
+struct KppContext;
+
+/* Cross-section of the box: an ellipse of semi-axes sigmaX and sigmaY, the
+ * size of the inner ring into which the plume model releases the emissions,
+ * that spreads by horizontal and vertical diffusion until it covers the
+ * computational domain */
+struct BoxPlume
+{
+    double sigmaX;    /* Initial horizontal semi-axis [m]       */
+    double sigmaY;    /* Initial vertical semi-axis [m]         */
+    double horizDiff; /* Horizontal diffusion coefficient [m^2/s] */
+    double vertiDiff; /* Vertical diffusion coefficient [m^2/s]   */
+    double maxArea;   /* Area of the computational domain [m^2]   */
+
+    /* Area of the cross-section t seconds after the release [m^2] */
+    double area( const double t ) const;
+};
+
+/* Integrates the chemistry of the box and of the ambient air over timeArray.
+ * setRates( ctx, t, dt ) sets the photolysis, heterogeneous and thermal rates
+ * of ctx for the step from t to t + dt. After each step the box entrains
+ * ambient air as its cross-section grows, so that the excess over the ambient
+ * air of every species scales as the inverse of the area.
+ * boxSpecies[N][nTime] receives the concentrations of the box at each time.
+ * Returns the error code of the last integration (negative if it failed) */
+int BoxIntegrate( KppContext &boxKPP, KppContext &ambientKPP,                        \
+                  const BoxPlume &plume, const Vector_1D &timeArray,                 \
+                  const std::function<void( KppContext&, double, double )> &setRates, \
+                  double ATOL[], double RTOL[], Vector_2D &boxSpecies );
+
+#endif /* BOXMODEL_H_INCLUDED */
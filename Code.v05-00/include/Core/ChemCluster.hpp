@@ -0,0 +1,70 @@
+#ifndef CHEMCLUSTER_H_INCLUDED
+#define CHEMCLUSTER_H_INCLUDED
+
+#include <functional>
+#include <map>
+#include <vector>
+#include "Util/ForwardDecl.hpp"
+
+struct KppContext;
+
+/* Groups grid cells by chemical state rather than by position, so that cells
+ * whose concentrations and reaction rates agree to within a relative tolerance
+ * can share a single chemistry integration.
+ * Each component of the state is binned on a logarithmic scale with bins of
+ * relative width relTol; cells falling in the same bin in every component form
+ * a cluster. Values at or below the component's floor all fall in the same bin.
+ * The first cell added to a cluster is its representative. */
+class ChemCluster
+{
+
+    public:
+
+        ChemCluster( const double relTol, const Vector_1D &floor );
+
+        /* Adds the next cell (cells are numbered in the order they are added)
+         * and returns the index of its cluster */
+        UInt Add( const Vector_1D &state );
+
+        UInt getnCluster() const { return representatives.size(); }
+        UInt getnCell() const { return clusterIndex.size(); }
+        /* Cell number of the representative of each cluster */
+        const std::vector<UInt>& getRepresentatives() const { return representatives; }
+        /* Cluster of each cell */
+        const std::vector<UInt>& getClusterIndex() const { return clusterIndex; }
+        /* Largest relative difference between a cell's state and that of its
+         * representative, over all components above their floor */
+        double getMaxSpread() const { return maxSpread; }
+
+    protected:
+
+        long Bin( const double x, const UInt iComp ) const;
+
+        double relTol;
+        double logWidth;
+        Vector_1D floor;
+        std::map<std::vector<long>, UInt> bins;
+        std::vector<UInt> representatives;
+        std::vector<UInt> clusterIndex;
+        Vector_2D repStates;
+        double maxSpread;
+
+};
+
+/* Integrates the chemistry of nCell cells from TIN to TOUT, once per cluster
+ * of cells whose concentrations and reaction rates agree to within relTol
+ * (concentrations at or below concFloor are not told apart).
+ * setupCell( ctx, iCell ) sets the concentrations and rates of cell iCell into
+ * a zeroed context; it is called from several threads at once.
+ * Each cell gets the increments of its cluster's representative, through
+ * applyCell( iCell, VAR ). Cells of a cluster whose integration failed are
+ * integrated on their own instead, and failedCell( ctx, iCell ) is called for
+ * each cell that still fails.
+ * Returns the clustering */
+ChemCluster IntegrateClustered( const UInt nCell, const double relTol, const double concFloor, \
+                                const std::function<void( KppContext&, UInt )> &setupCell,    \
+                                const std::function<void( UInt, const double[] )> &applyCell,  \
+                                const std::function<void( const KppContext&, UInt )> &failedCell, \
+                                double TIN, double TOUT, double ATOL[], double RTOL[], double STEPMIN );
+
+#endif /* CHEMCLUSTER_H_INCLUDED */
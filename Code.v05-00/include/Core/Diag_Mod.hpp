@@ -28,6 +28,9 @@
 #include "Util/VectorUtils.hpp"
 #include <netcdf>
 #include <filesystem>
+#include <map>
+#include <optional>
+#include "LAGRID/RemappingFunctions.hpp"
 
 namespace Diag {
     using namespace netCDF;
@@ -51,18 +54,117 @@ namespace Diag {
                     const int hh, const int mm, const int ss, \
                     const Solution& Data, const Mesh& m );
 
+    /* Which aerosol time-series fields to save and how to store them.
+     * Fields are named by their TS_AERO_VARS key. */
+    struct TSOutputOptions {
+        /* Fields to save, all of them if empty */
+        vector<string> vars;
+        /* netCDF-4 deflate level (0 to 9) with byte shuffling, 0 leaves the
+         * variables uncompressed */
+        int deflate = 0;
+        /* Significant decimal digits to keep per field, "all" applies to
+         * every field without an entry of its own. Fields without either
+         * keep full float precision. */
+        std::map<string, int> sigDigits;
+        /* If set, the 2D fields and the profiles along x or y are
+         * conservatively resampled onto this fixed grid before being saved.
+         * Scalars and size distributions are still computed on the model grid. */
+        std::optional<LAGRID::Remapping> analysisGrid;
+
+        bool wants( const string& key ) const;
+        int digits( const string& key ) const;
+        void compress( NcVar& var ) const;
+    };
+
+    /* The meteorological fields saved with the aerosol time series, so that
+     * a save can hold on to them without copying the whole Meteorology */
+    struct TSMetFields {
+        TSMetFields( const Meteorology &met ):
+            pressure( met.Press() ), altitude( met.Altitude() ), temperature( met.Temp() ) {}
+
+        Vector_1D pressure;    /* [Pa] */
+        Vector_1D altitude;    /* [m]  */
+        Vector_2D temperature; /* [K]  */
+    };
+
+    /* Bit grooming: keeps enough mantissa bits in each value for the given
+     * number of significant decimal digits and alternately clears and sets
+     * the others, so that the data compresses well. digits <= 0 is a no-op. */
+    void GroomFloats( float* array, const size_t n, const int digits );
+
     void Diag_TS_Phys( const char* rootName,
                     const int hh, const int mm, const int ss,
                     const AIM::Grid_Aerosol& iceAer, const Vector_2D& H2O,
                     const Vector_1D& xCoord, const Vector_1D& yCoord,
                     const Vector_1D& xEdges, const Vector_1D& yEdges,
-                    const Meteorology &met);
+                    const TSMetFields &met,
+                    const TSOutputOptions& options = TSOutputOptions());
     
+    /* Writes every Diag_TS_Phys save of one case to a single file, with one
+     * record per save along the unlimited time dimension.
+     * The LAGRID grid changes size between saves, so the x and y dimensions
+     * are unlimited too: each record is padded with the fill value beyond its
+     * own grid, whose extent is stored in "nx" and "ny" and whose cell
+     * centers are stored per record in "x_centers" and "y_centers". */
+    class TSPhysFile {
+        public:
+            TSPhysFile( const string& fileName, const AIM::Grid_Aerosol& iceAer,
+                        const TSOutputOptions& options = TSOutputOptions() );
+            TSPhysFile( const TSPhysFile& ) = delete;
+            TSPhysFile& operator=( const TSPhysFile& ) = delete;
+
+            void Append( const int hh, const int mm, const int ss,
+                         const AIM::Grid_Aerosol& iceAer, const Vector_2D& H2O,
+                         const Vector_1D& xCoord, const Vector_1D& yCoord,
+                         const Vector_1D& xEdges, const Vector_1D& yEdges,
+                         const TSMetFields &met );
+
+            size_t nRecord() const { return nRecord_; }
+
+        private:
+            NcVar recordVar( const string& name, const NcType& type, const vector<NcDim>& dims,
+                             const string& desc, const string& units );
+
+            NcFile file_;
+            const TSOutputOptions options_;
+            NcDim tDim_, xDim_, yDim_, binRadDim_;
+            NcVar tVar_;
+            std::map<string, NcVar> vars_;
+            size_t nRecord_;
+            /* Chunk extent along x and y, set from the grid of the first record */
+            size_t xChunk_, yChunk_;
+    };
+
+    /* Name of the single time-series file for a Diag_TS_Phys file pattern:
+     * the time placeholder (hhmmss or hhmm) is replaced by "series" */
+    string TSSeriesFileName( const string& rootName );
+
     void add0DVar(NcFile& currFile, const float toSave, const NcDim& dim, const string& name, const string& desc, const string& units);
     void add1DVar(NcFile& currFile, const Vector_1D& toSave, const NcDim& dim, const string& name, const string& desc, const string& units);
     void add2DVar(NcFile& currFile, const Vector_2D& toSave, const vector<NcDim> dims, const string& name, const string& desc, const string& units);
     void replace_hhmmss(string& fileName, int hh, int mm, int ss);
 
+    /* ================================================================== */
+    /* ---- Box Model Diagnostics --------------------------------------- */
+    /* ================================================================== */
+
+    /* Saves the box model timeseries: one variable per KPP variable species,
+     * boxSpecies[N][iT] [molec/cm^3] at timeArray[iT] [s] */
+    void Diag_Box( const char* fileName, const Vector_1D& timeArray,
+                   const Vector_2D& boxSpecies, const double airDens );
+
+    /* ================================================================== */
+    /* ---- Adjoint Diagnostics ----------------------------------------- */
+    /* ================================================================== */
+
+    /* Saves the plume-to-box adjoint optimization: the plume concentrations
+     * the box model was fitted to, the ambient initial conditions and the
+     * optimized box initial conditions, all of size NVAR [molec/cm^3] */
+    void Diag_Adjoint( const char* fileName,
+                       const Vector_1D& finalPlume, const Vector_1D& initBackg,
+                       const Vector_1D& initBox, const double metric,
+                       const double tStart, const double tEnd );
+
     /* ================================================================== */
     /* ---- Prod & Loss Rates Diagnostics ------------------------------- */
     /* ================================================================== */
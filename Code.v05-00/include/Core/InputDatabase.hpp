@@ -0,0 +1,112 @@
+#ifndef INPUTDATABASE_H_INCLUDED
+#define INPUTDATABASE_H_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Util/ForwardDecl.hpp"
+
+/* The text input files shared by every case (engine emission database and
+ * background conditions) are parsed once per process into the immutable
+ * databases below, which cases look up concurrently.
+ * If precompiled inputs are turned on, parsing a file also leaves a binary
+ * copy of it in the per-user cache folder (see Util/CacheDir.hpp), which
+ * later runs load instead. The copy records the size and modification time
+ * of the text file and is only used while both still match. If the copy
+ * cannot be read or written, the text file is parsed. */
+
+/* Turns precompiled inputs on or off for the databases read afterwards.
+ * Off by default. */
+void SetPrecompiledInputs( const bool enable );
+
+/* Size and modification time of a text input */
+struct InputFileStamp
+{
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+
+    bool operator==( const InputFileStamp &other ) const { return ( size == other.size ) && ( mtime == other.mtime ); }
+};
+
+/* Engine LTO emission database (ENG_EI.txt), indexed by engine name and
+ * ICAO UID */
+class EngineDatabase
+{
+
+    public:
+
+        /* Data of one LTO thrust setting */
+        struct Mode {
+            double CO;       /* [g/kg fuel] */
+            double HC;       /* [g/kg fuel] */
+            double NOx;      /* [g/kg fuel] */
+            double fuelflow; /* [kg fuel/s] */
+        };
+
+        /* The four records of an engine, in file order */
+        typedef std::array<Mode, 4> Entry;
+
+        /* Returns the database for fileName, reading the file on first use.
+         * Throws std::runtime_error if the file cannot be read. */
+        static std::shared_ptr<const EngineDatabase> Get( const std::string &fileName );
+
+        /* Returns nullptr if the engine is not in the database */
+        const Entry* find( const std::string &engineName ) const;
+        std::size_t size() const { return entries_.size(); }
+
+    private:
+
+        EngineDatabase() = default;
+
+        static std::shared_ptr<const EngineDatabase> Parse( const std::string &fileName );
+        static std::shared_ptr<const EngineDatabase> Load( const std::string &binFileName, \
+                                                           const InputFileStamp &stamp );
+        bool Write( const std::string &binFileName, const InputFileStamp &stamp ) const;
+
+        std::vector<Entry> entries_;
+        std::unordered_map<std::string, UInt> index_;
+
+};
+
+/* Background conditions (init.txt): the ambient mixing ratio of each
+ * species, in species order, followed by the number concentration and
+ * radius of each background aerosol */
+class BackgroundDatabase
+{
+
+    public:
+
+        /* Same as EngineDatabase::Get. nSpec and nAer are the number of
+         * species and aerosols the file is read for, entries missing from
+         * the file are zero. */
+        static std::shared_ptr<const BackgroundDatabase> Get( const std::string &fileName, \
+                                                              const UInt nSpec, const UInt nAer );
+
+        const Vector_1D& ambient() const { return ambient_; }
+        /* [iAer][0]: number concentration [#/cm^3], [iAer][1]: radius [m] */
+        const Vector_2D& aerosol() const { return aerosol_; }
+        /* Index of a species in ambient(), from the comment preceding its
+         * value. Returns -1 if the name does not appear in the file. */
+        int indexOf( const std::string &speciesName ) const;
+
+    private:
+
+        BackgroundDatabase() = default;
+
+        static std::shared_ptr<const BackgroundDatabase> Parse( const std::string &fileName, \
+                                                                const UInt nSpec, const UInt nAer );
+        static std::shared_ptr<const BackgroundDatabase> Load( const std::string &binFileName, \
+                                                               const InputFileStamp &stamp, \
+                                                               const UInt nSpec, const UInt nAer );
+        bool Write( const std::string &binFileName, const InputFileStamp &stamp ) const;
+
+        Vector_1D ambient_;
+        Vector_2D aerosol_;
+        std::unordered_map<std::string, UInt> index_;
+
+};
+
+#endif /* INPUTDATABASE_H_INCLUDED */
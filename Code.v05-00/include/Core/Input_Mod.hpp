@@ -14,11 +14,19 @@
 #ifndef INPUT_MOD_H_INCLUDED
 #define INPUT_MOD_H_INCLUDED
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
+#include <map>
 #include <unordered_map>
 #include "Util/ForwardDecl.hpp"
 
+/* Names accepted for the aerosol timeseries variable selection */
+inline const std::vector<std::string> TS_AERO_VAR_NAMES = {
+    "Pressure", "Altitude", "H2O", "Temperature", "IceNumber", "IceArea",
+    "IceVolume", "EffRadius", "xOD", "yOD", "SizeDist", "IceMass",
+    "IceParticles", "Extinction", "IWC", "RHi", "width", "depth", "intOD" };
+
 struct OptInput
 {
 
@@ -31,17 +39,24 @@ struct OptInput
     bool        SIMULATION_PARAMETER_SWEEP;
     bool        SIMULATION_MONTECARLO;
     int         SIMULATION_MCRUNS;
+    std::uint64_t SIMULATION_RANDOM_SEED;
     std::string SIMULATION_OUTPUT_FOLDER;
     bool        SIMULATION_OVERWRITE;
+    std::string SIMULATION_MICRO_FORMAT;
+    int         SIMULATION_MICRO_WRITE_EVERY;
+    double      SIMULATION_MICRO_REL_CHANGE;
+    std::string SIMULATION_SUMMARY_FILENAME;
     bool        SIMULATION_THREADED_FFT;
     bool        SIMULATION_USE_FFTW_WISDOM;
     std::string SIMULATION_DIRECTORY_W_WRITE_PERMISSION;
     std::string SIMULATION_INPUT_BACKG_COND;
     std::string SIMULATION_INPUT_ENG_EI;
+    bool        SIMULATION_PRECOMPILE_INPUTS;
     bool        SIMULATION_SAVE_FORWARD;
     std::string SIMULATION_FORWARD_FILENAME;
     bool        SIMULATION_ADJOINT;
     std::string SIMULATION_ADJOINT_FILENAME;
+    double      SIMULATION_ADJOINT_CHECKPOINT_MB;
     bool        SIMULATION_BOXMODEL;
     std::string SIMULATION_BOX_FILENAME;
 
@@ -70,6 +85,9 @@ struct OptInput
     bool        CHEMISTRY_HETCHEM;
     double      CHEMISTRY_TIMESTEP;
     std::string CHEMISTRY_JRATE_FOLDER;
+    double      CHEMISTRY_CLUSTER_RTOL;
+    double      CHEMISTRY_RCONST_DT;
+    bool        CHEMISTRY_BATCH;
 
     /* ========================================== */
     /* ---- AEROSOL MENU ------------------------ */
@@ -133,6 +151,17 @@ struct OptInput
     std::string      TS_AERO_FILENAME;
     std::vector<int> TS_AEROSOL;
     double           TS_AERO_FREQ;
+    bool             TS_AERO_APPEND;
+    std::vector<std::string> TS_AERO_VARS;
+    int              TS_AERO_DEFLATE;
+    std::map<std::string, int> TS_AERO_SIGDIGITS;
+    bool             TS_AERO_RESAMPLE;
+    int              TS_AERO_GRID_NX;
+    int              TS_AERO_GRID_NY;
+    double           TS_AERO_GRID_XLIM_RIGHT;
+    double           TS_AERO_GRID_XLIM_LEFT;
+    double           TS_AERO_GRID_YLIM_UP;
+    double           TS_AERO_GRID_YLIM_DOWN;
 
     /* ========================================== */
     /* ---- PROD & LOSS MENU -------------------- */
@@ -151,12 +180,18 @@ struct OptInput
     double ADV_GRID_XLIM_LEFT;
     double ADV_GRID_YLIM_UP;
     double ADV_GRID_YLIM_DOWN;
+    int ADV_GRID_COARSEN_LEVELS;
+    int ADV_GRID_COARSEN_BLOCKSIZE;
     double ADV_CSIZE_DEPTH_BASE;
     double ADV_CSIZE_DEPTH_SCALING_FACTOR;
     double ADV_CSIZE_WIDTH_BASE;
     double ADV_CSIZE_WIDTH_SCALING_FACTOR;
     double ADV_AMBIENT_LAPSERATE;
     double ADV_TROPOPAUSE_PRESSURE;
+    std::string ADV_EPM_INTEGRATOR;
+    bool ADV_EPM_TABLE_BUILD;
+    std::string ADV_EPM_TABLE_FILE;
+    double ADV_EPM_TABLE_MAXERR;
         
 
 };
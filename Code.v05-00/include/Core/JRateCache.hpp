@@ -0,0 +1,88 @@
+#ifndef JRATECACHE_H_INCLUDED
+#define JRATECACHE_H_INCLUDED
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Util/ForwardDecl.hpp"
+
+/* Noon-time photolysis rates of one day on a lon x lat x pmid grid, laid out
+ * column by column so that the rates needed to interpolate at a point are
+ * contiguous: data[((iLat * nLon + iLon) * nPres + iPres) * NPHOTOL + iPhotol].
+ * The cache file is a small header followed by the lon, lat and pmid axes and
+ * the data, all native doubles, and is memory-mapped read-only. The header
+ * records the size and modification time of the input the cache was built
+ * from, so that a cache is rebuilt when its input changes.
+ * A cache is immutable once built and can be queried concurrently. */
+class JRateCache
+{
+
+    public:
+
+        /* Size and modification time of the input of a cache */
+        struct Source
+        {
+            std::uint64_t size = 0;
+            std::int64_t mtime = 0;
+
+            bool operator==( const Source &other ) const { return ( size == other.size ) && ( mtime == other.mtime ); }
+        };
+
+        /* Stamps the input file, or returns an empty Source if it cannot be read */
+        static Source Stamp( const std::string &sourceFile );
+
+        /* Keeps the data in memory, for when the cache file cannot be written */
+        JRateCache( const Vector_1D &lon, const Vector_1D &lat, \
+                    const Vector_1D &pmid, Vector_1D &&data );
+        ~JRateCache();
+
+        JRateCache( const JRateCache& ) = delete;
+        JRateCache& operator=( const JRateCache& ) = delete;
+
+        /* Maps an existing cache file. Returns nullptr if the file does not
+         * exist, was not written for the current mechanism or was built from
+         * another version of the input than source. */
+        static std::shared_ptr<const JRateCache> Map( const std::string &cacheFile, \
+                                                      const Source &source );
+
+        /* Writes a cache file. The file is written under a temporary name and
+         * renamed, so a concurrent Map never sees a partial file. Returns
+         * false if the file could not be written. */
+        static bool Write( const std::string &cacheFile, const Source &source, \
+                           const Vector_1D &lon, const Vector_1D &lat,        \
+                           const Vector_1D &pmid, const Vector_1D &data );
+
+        /* Interpolates all NPHOTOL rates to (LON, LAT, P_hPa). pmid is sorted
+         * in decreasing order. Points in the first or last interval of the lon
+         * or lat axis, or beyond it, take the values of the upper bounding row
+         * instead of being interpolated along that axis. */
+        void Interpolate( const double LON, const double LAT, const double P_hPa, \
+                          double NOON_JRATES[] ) const;
+
+        UInt nLon() const { return nLon_; }
+        UInt nLat() const { return nLat_; }
+        UInt nPres() const { return nPres_; }
+        bool isMapped() const { return mapping_ != nullptr; }
+
+    private:
+
+        JRateCache() = default;
+
+        const double* column( const UInt iLat, const UInt iLon, const UInt iPres ) const;
+
+        UInt nLon_ = 0;
+        UInt nLat_ = 0;
+        UInt nPres_ = 0;
+        const double* lon_ = nullptr;
+        const double* lat_ = nullptr;
+        const double* pmid_ = nullptr;
+        const double* data_ = nullptr;
+
+        /* Either the mapped file or the in-memory copy backs the pointers above */
+        void* mapping_ = nullptr;
+        std::size_t mappingSize_ = 0;
+        Vector_1D storage_;
+
+};
+
+#endif /* JRATECACHE_H_INCLUDED */
@@ -3,8 +3,10 @@
 #include "AIM/Aerosol.hpp"
 #include "AIM/Settling.hpp"
 #include "LAGRID/RemappingFunctions.hpp"
+#include "LAGRID/RemapOperator.hpp"
 #include "FVM_ANDS/FVM_Solver.hpp"
 #include "EPM/Integrate.hpp"
+#include "EPM/ResponseSurface.hpp"
 #include "Core/Diag_Mod.hpp"
 #include "Core/MPMSimVarsWrapper.hpp"
 #include "Core/TimestepVarsWrapper.hpp"
@@ -12,7 +14,11 @@
 #include "Util/VectorUtils.hpp"
 #include "Util/PlumeModelUtils.hpp"
 #include <filesystem>
+#include <future>
+#include <memory>
 #include "Core/Status.hpp"
+#include "Core/OutputWriter.hpp"
+#include "Core/SweepSummary.hpp"
 class LAGRIDPlumeModel {
     public:
         static constexpr bool COCIP_MIXING = 0; // Results in less accurate mixing representation, only meant for comparisions vs. the CoCiP model.
@@ -23,9 +29,14 @@ class LAGRIDPlumeModel {
         static constexpr double RIGHT_BUFFER_SCALING = 1.5;
 
         LAGRIDPlumeModel() = delete;
-        LAGRIDPlumeModel(const OptInput &Input_Opt, const Input &input);
+        LAGRIDPlumeModel(const OptInput &Input_Opt, const Input &input, SweepSummary* summary = nullptr);
+        ~LAGRIDPlumeModel();
         SimStatus runFullModel();
         SimStatus runEPM();
+        //Raw EPM result (single engine, before vortex losses) and the point it is tabulated at
+        std::pair<EPM::ResponseSurface::Point, EPM::ResponseSurface::NodeResult> runEPMForTable();
+        //EPM inputs that aren't table axes, all cases using a table must share them
+        std::string epmTableContext() const;
         struct BufferInfo {
             double leftBuffer;
             double rightBuffer;
@@ -58,6 +69,14 @@ class LAGRIDPlumeModel {
         double simTime_h_;
         double solarTime_h_;
         double shear_rep_;
+        //Variable selection and compression of the aerosol saves
+        Diag::TSOutputOptions tsAeroOptions_;
+        //Sweep-level record of the scalar diagnostics, optional
+        SweepSummary* summary_;
+        //Only used when all aerosol saves go to a single file. Owned by the model but only touched on the I/O thread.
+        std::unique_ptr<Diag::TSPhysFile> tsAeroFile_;
+        //Save currently being written by the I/O thread
+        std::future<void> pendingTSAero_;
 
         typedef std::pair<std::vector<std::vector<int>>, VectorUtils::MaskInfo> MaskType;
         inline MaskType iceNumberMask(double cutoff_ratio = NUM_FILTER_RATIO) {
@@ -69,15 +88,19 @@ class LAGRIDPlumeModel {
             return VectorUtils::Vec2DMask(iceTotalNum, xEdges_, yEdges_, iceNumMaskFunc);
         }
 
+        void initEPMMet();
+        std::pair<EPM::EPMOutput, SimStatus> integrateEPM();
+        EPM::ResponseSurface::Point epmTablePoint() const;
         void createOutputDirectories();
         void initializeGrid();
         void saveTSAerosol();
+        void finishTSAerosol();
         void initH2O();
         void updateDiffVecs();
         void runTransport(double timestep);
         void remapAllVars(double remapTimestep);
         void trimH2OBoundary();
-        LAGRID::twoDGridVariable remapVariable(const VectorUtils::MaskInfo& maskInfo, const BufferInfo& buffers, const Vector_2D& phi, const std::vector<std::vector<int>>& mask);
+        LAGRID::RemapOperator buildRemapOperator(const VectorUtils::MaskInfo& maskInfo, const BufferInfo& buffers, const std::vector<std::vector<int>>& mask);
         double totalAirMass();
         void runCocipH2OMixing(const Vector_2D& h2o_old, const Vector_2D& h2o_amb_new, MaskType& mask_old, MaskType& mask_new);
 
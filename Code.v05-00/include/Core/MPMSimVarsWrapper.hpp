@@ -77,6 +77,7 @@ struct MPMSimVarsWrapper{
     const std::string TS_AERO_FILEPATH;
     const std::vector<int> TS_AERO_LIST;
     const double TS_AERO_FREQ;
+    const bool TS_AERO_APPEND;
 
     /* ======================================================================= */
     /* ---- Input options from the PROD & LOSS MENU -------------------------- */
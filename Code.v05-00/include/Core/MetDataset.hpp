@@ -0,0 +1,52 @@
+#ifndef METDATASET_H_INCLUDED
+#define METDATASET_H_INCLUDED
+
+#include <map>
+#include <memory>
+#include <string>
+#include "Util/ForwardDecl.hpp"
+
+/* Contents of a met input file, decoded once and shared read-only between
+ * every case that uses the file.
+ * Profiles are stored on the file's altitude grid as [altitude][time]. A
+ * variable without a time dimension is stored with a single time entry.
+ * Instances are only created through Get, which keeps one dataset per file
+ * name for the lifetime of the process. */
+class MetDataset
+{
+
+    public:
+
+        struct Profile {
+            Vector_2D data;
+            /* True if the variable has a time dimension in the file */
+            bool timeseries;
+        };
+
+        /* Returns the dataset for fileName, reading the file on first use.
+         * Safe to call concurrently from several cases. */
+        static std::shared_ptr<const MetDataset> Get( const std::string &fileName );
+
+        const std::string& fileName() const { return fileName_; }
+        int altitudeDim() const { return altitude_.size(); }
+        int timeDim() const { return timeDim_; }
+        /* Altitude [m] and pressure [Pa] of the file's vertical levels */
+        const Vector_1D& altitude() const { return altitude_; }
+        const Vector_1D& pressure() const { return pressure_; }
+        bool hasProfile( const std::string &varName ) const { return profiles_.count( varName ) > 0; }
+        /* Throws std::runtime_error if the file has no variable varName */
+        const Profile& profile( const std::string &varName ) const;
+
+    private:
+
+        explicit MetDataset( const std::string &fileName );
+
+        std::string fileName_;
+        int timeDim_;
+        Vector_1D altitude_;
+        Vector_1D pressure_;
+        std::map<std::string, Profile> profiles_;
+
+};
+
+#endif /* METDATASET_H_INCLUDED */
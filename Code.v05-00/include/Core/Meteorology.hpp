@@ -26,8 +26,10 @@
 #include "Util/ForwardDecl.hpp"
 #include "Core/Mesh.hpp"
 #include "Core/Input_Mod.hpp"
+#include "Core/MetDataset.hpp"
 #include "Util/PhysConstant.hpp"
 #include "Util/MetFunction.hpp"
+#include "Util/MC_Rand.hpp"
 /*#include <netcdfcpp.h>*/
 #include <netcdf>
 #include <limits>
@@ -66,15 +68,20 @@ class Meteorology
         void Update( const double dt, const double solarTime_h, \
                      const double simTime_h, const double dTrav_x = 0, const double dTrav_y = 0);
         
-        void updateTempPerturb();
+        /* Draws a new perturbation field. The field only depends on the
+         * random seed, case and step, not on the number of threads. */
+        void updateTempPerturb( const UInt iCase, const UInt iStep );
         inline double alt( int j ) const { return altitude_[j]; }
 	    inline double press( int j ) const { return pressure_[j]; }
         inline double shear( int j ) const { return shear_[j]; }
         inline double shear() const { return i_Zp_ == -1 ? shear_[0] : shear_[i_Zp_]; }
 
-        inline double temp( int j, int i ) const { return tempTotal_[j][i]; }
-        inline double airMolecDens( int j, int i ) const { return airMolecDens_[j][i]; } // molecules/cm3
-        inline double H2O( int j, int i ) const { return H2O_[j][i]; }
+        //Element accessors are computed from the column profiles and are safe to call from parallel loops.
+        inline double temp( int j, int i ) const {
+            return tempPerturbation_.empty() ? tempBase_[j] : tempBase_[j] + tempPerturbation_[j][i];
+        }
+        inline double airMolecDens( int j, int i ) const { return pressure_[j] / temp(j, i) * (1.00E-06 / physConst::kB); } // molecules/cm3
+        inline double H2O( int j, int i ) const { return H2OColumn_[j]; }
 
         //For getting the temp, rhw, and satdepth corresponding to initial pressure when using met input
         //TODO: Fix these functions and delete the _user variables, just calculate it from the reference altitude.
@@ -103,17 +110,13 @@ class Meteorology
         inline double referencePress() const { return pressureRef_; } //Pressure at y = 0
 
         inline const Vector_1D& tempBase() const { return tempBase_; }
-        inline const Vector_1D H2O_1D() const {
-            Vector_1D h2o1D(yCoords_.size());
-            for(int j = 0; j < yCoords_.size(); j++) {
-                h2o1D[j] = H2O_[j][0];
-            }
-            return h2o1D;
-        }
-        inline const Vector_2D& Temp() const { return tempTotal_; }
+        inline const Vector_1D& H2O_1D() const { return H2OColumn_; }
+        //The 2D fields are only built when requested and are cached until the profiles change.
+        //Not thread-safe: don't call these from inside a parallel region.
+        const Vector_2D& Temp() const;
         inline const Vector_1D& Press() const { return pressure_; }
         inline const Vector_1D& Shear() const { return shear_; }
-        inline const Vector_2D& H2O_field() const { return H2O_; }
+        const Vector_2D& H2O_field() const;
         inline const Vector_1D& VertVeloc() const { return vertVeloc_; }
         inline const Vector_1D& AltEdges() const { return altitudeEdges_; }
         inline const Vector_1D& PressEdges() const { return pressureEdges_; }
@@ -131,12 +134,11 @@ class Meteorology
         
     private:
         inline void zeroVectors() { 
-            tempTotal_ = Vector_2D(ny_, Vector_1D (nx_, 0));
-            tempPerturbation_ = Vector_2D(ny_, Vector_1D (nx_, 0));
-            airMolecDens_ = Vector_2D(ny_, Vector_1D (nx_, 0));
-            H2O_ = Vector_2D(ny_, Vector_1D (nx_, 0));
+            tempPerturbation_.clear();
+            invalidateFields();
 
             tempBase_ = Vector_1D(ny_, 0);
+            H2OColumn_ = Vector_1D(ny_, 0);
             shear_ = Vector_1D(ny_, 0);
             vertVeloc_ = Vector_1D(ny_, 0);
             altitude_ = Vector_1D(ny_, 0);
@@ -171,21 +173,24 @@ class Meteorology
             }
         }
 
-        void initAltitudeAndPress( const NcFile& dataFile );
-        void readMetVar( const NcFile& dataFile, std::string varName, Vector_2D& vec_ts, bool timeseries);
+        void initAltitudeAndPress();
+        const Vector_2D& metProfile( const std::string& varName, bool timeseries ) const;
         void initTempNoMet(const Vector_1D& yCoords);
-        void initTemperature( const NcFile& dataFile );
+        void initTemperature();
         void initH2ONoMet( const Vector_1D& yCoords);
-        void initH2O( const NcFile& dataFile, const OptInput& OptInput );
-        void initShear( const NcFile& dataFile );
-        void initVertVeloc ( const NcFile& dataFile );
+        void initH2O( const OptInput& OptInput );
+        void initShear();
+        void initVertVeloc();
 
         Vector_1D interpMetTimeseriesData(double simTime_h, const Vector_2D& ts_data, bool timeseries) const;
 
         void updateTemperature(double solarTime_h, double simTime_h);
         void updateH2O(double simTime_h);
         void updateShear(double simTime_h);
-        void updateAirMolecDens();
+        inline void invalidateFields() {
+            tempFieldValid_ = false;
+            H2OFieldValid_ = false;
+        }
         void updateVertVeloc(double simTime_h);
         void vertAdvectAltPress(double dt);
 
@@ -207,20 +212,14 @@ class Meteorology
 
         /* For processing met input */
         double met_dt_h_;
-        int altitudeDim_;
-        int timeDim_;
-        Vector_1D pressureInit_; 
-        Vector_1D altitudeInit_;
+        //Raw file profiles, shared with every other case reading the same file.
+        std::shared_ptr<const MetDataset> metData_;
+        //Profiles on the file's altitude grid at the current simulation time
         Vector_1D tempInit_;
         Vector_1D shearInit_;
         Vector_1D rhiInit_;
         Vector_1D vertVelocInit_;
 
-	    Vector_2D tempTimeseriesData_;
-        Vector_2D shearTimeseriesData_;
-        Vector_2D rhiTimeseriesData_;
-        Vector_2D vertVelocTimeseriesData_;
-
         /* Ambient input parameters */
         AmbientMetParams ambParams_;
         double altitudeRef_;
@@ -234,16 +233,21 @@ class Meteorology
         double diurnalPhase_; // [hours]
         double diurnalPert_; // [K]
         double turbTempPertAmplitude_; // [K]
+        RandKey turbTempPertKey_;
 
         /* Assume that pressure only depends on the vertical coordinate */
 
-        /* Temperature, air density and humidity fields can potentially be
-         * 2D fields */
-        Vector_2D tempTotal_;
+        /* Temperature and humidity are stored as column profiles. Only the
+         * temperature perturbation is a true 2D field, and it stays empty
+         * until the first call to updateTempPerturb. The air density is
+         * computed from pressure and temperature on the fly. */
         Vector_2D tempPerturbation_;
         Vector_1D tempBase_; //Temp without the perturbations
-        Vector_2D airMolecDens_;
-        Vector_2D H2O_;
+        Vector_1D H2OColumn_;
+        mutable Vector_2D tempTotal_;
+        mutable Vector_2D H2O_;
+        mutable bool tempFieldValid_ = false;
+        mutable bool H2OFieldValid_ = false;
         Vector_1D shear_;
         Vector_1D vertVeloc_; // [m/s]
 
@@ -0,0 +1,58 @@
+#ifndef OUTPUTWRITER_H_INCLUDED
+#define OUTPUTWRITER_H_INCLUDED
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/* The process-wide I/O thread. The netCDF library is not thread-safe, so
+ * every netCDF read or write is handed to this thread, which runs the jobs
+ * one at a time in the order they were submitted, whichever case they come
+ * from. */
+class OutputWriter
+{
+
+    public:
+
+        static OutputWriter& Get();
+
+        /* A writer with its own thread. All netCDF calls must go through
+         * Get(), other writers only order the jobs given to them. */
+        OutputWriter();
+
+        /* Runs the jobs still queued, then stops the thread */
+        ~OutputWriter();
+
+        OutputWriter( const OutputWriter& ) = delete;
+        OutputWriter& operator=( const OutputWriter& ) = delete;
+
+        /* Queues job and returns immediately. The future rethrows any
+         * exception thrown by the job. */
+        std::future<void> Submit( std::function<void()> job );
+
+        /* Runs job on the I/O thread and waits for it to finish */
+        void Run( std::function<void()> job );
+
+    private:
+
+        /* Shared with the thread, so that it can finish the queue after the
+         * writer is gone if the writer is destroyed by one of its own jobs */
+        struct Queue {
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<std::packaged_task<void()>> jobs;
+            bool stop = false;
+        };
+
+        static void Loop( std::shared_ptr<Queue> queue );
+
+        std::shared_ptr<Queue> queue_;
+        std::thread thread_;
+
+};
+
+#endif /* OUTPUTWRITER_H_INCLUDED */
@@ -57,6 +57,7 @@
 #define KPP_ATOLS             1.00E-03    /* Absolute tolerances in KPP */
 #define KPPADJ_RTOLS          1.00E-05    /* Relative tolerances in KPP_Adjoint */
 #define KPPADJ_ATOLS          1.00E-04    /* Absolute tolerances in KPP_Adjoint */
+#define CHEM_CLUSTER_ATOL     1.00E+03    /* Concentration [molec/cm^3] below which cells are not told apart when clustering chemistry */
 
 /* Aerosol parameters */
 #define N_AER                 3           /* Number of aerosols considered */
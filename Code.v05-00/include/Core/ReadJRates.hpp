@@ -18,14 +18,32 @@
 #include <iomanip>
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
 
 #include "Util/ForwardDecl.hpp"
 #include "KPP/KPP_Parameters.h"
+#include "Core/JRateCache.hpp"
 
 #include <netcdf>
 using namespace netCDF;
 using namespace netCDF::exceptions;
 
+/* Reads the noon-time photolysis rates from a JData NetCDF file, grouped by
+ * column in the layout used by JRateCache */
+void ReadJRatesNetCDF( const std::string &fileName, Vector_1D &lon, Vector_1D &lat, \
+                       Vector_1D &pmid, Vector_1D &data );
+
+/* Returns the photolysis rate cache for the given day. On first use in the
+ * process, the cache file of the NetCDF input in the per-user cache folder
+ * ($XDG_CACHE_HOME/APCEMM or ~/.cache/APCEMM) is mapped, or created from
+ * the NetCDF input if it does not exist yet or the input has changed. */
+std::shared_ptr<const JRateCache> OpenJRateCache( const char* ROOTDIR, \
+                                                  const unsigned int MM, const unsigned int DD );
+
+/* Interpolates the noon-time photolysis rates of the given day to
+ * (LON, LAT, P_hPa). Thread-safe. */
 void ReadJRates( const char* ROOTDIR,                          \
                  const unsigned int MM, const unsigned int DD, \
                  const double LON, const double LAT,           \
@@ -70,8 +70,8 @@ class Solution
                          const OptInput &Input_Opt, \
                          double* varSpeciesArray, double* fixSpeciesArray,
                          const bool DBG );
-        void readInputBackgroundConditions(const Input& input, Vector_1D& amb_Value, Vector_2D& aer_Value, const char* filename);
-        void setAmbientConcentrations(const Input& input, Vector_1D& amb_Value);
+        static void readInputBackgroundConditions(const Input& input, Vector_1D& amb_Value, Vector_2D& aer_Value, const char* filename);
+        static void setAmbientConcentrations(const Input& input, Vector_1D& amb_Value);
         void initializeSpeciesH2O(const Input& input, const OptInput& input_Opt, Vector_1D& amb_Value, const double airDens, const Meteorology& met);
         void setSpeciesValues( Vector_1D& AERFRAC,  Vector_1D& SOLIDFRAC, const Vector_1D& stratData);
 
@@ -80,11 +80,11 @@ class Solution
                       const UInt j = 0, \
 		      const bool CHEMISTRY = 0 );
 
-        int SpinUp( Vector_1D &amb_Value,       \
-                    const Input &input,         \
-                    const double airDens,   \
-                    const double startTime, \
-                    double* varSpeciesArray, double* fixSpeciesArray, const bool DGB = 0 );
+        static int SpinUp( Vector_1D &amb_Value,       \
+                           const Input &input,         \
+                           const double airDens,   \
+                           const double startTime, \
+                           double* varSpeciesArray, double* fixSpeciesArray, const bool DGB = 0 );
 
         void applyData( const double* varSpeciesArray, const UInt i = 0, \
                         const UInt j = 0 );
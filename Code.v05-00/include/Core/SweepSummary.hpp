@@ -0,0 +1,57 @@
+#ifndef SWEEPSUMMARY_H_INCLUDED
+#define SWEEPSUMMARY_H_INCLUDED
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Util/ForwardDecl.hpp"
+#include "Core/Status.hpp"
+
+namespace netCDF { class NcFile; }
+namespace AIM { class Grid_Aerosol; }
+
+/* One netCDF file per sweep holding the scalar contrail diagnostics of every
+ * case against time, with dimensions (case, time), along with the case
+ * parameters and the final status of each case.
+ * Cases append their own records as they run, so the file can be read while
+ * the sweep is still going. All file access goes through the OutputWriter
+ * thread, so every method can be called from any case. */
+class SweepSummary
+{
+
+    public:
+
+        struct Scalars {
+            double iceMass;
+            double iceParticles;
+            double width;
+            double depth;
+            double intOD;
+        };
+
+        /* Creates the file, replacing any existing one, and saves the
+         * parameters of every case */
+        SweepSummary( const std::string &fileName,
+                      const std::vector<std::unordered_map<std::string, double>> &parameters );
+        ~SweepSummary();
+
+        SweepSummary( const SweepSummary& ) = delete;
+        SweepSummary& operator=( const SweepSummary& ) = delete;
+
+        /* Appends a record at time_h [hours after the start of the case] */
+        void Record( const UInt iCase, const double time_h, const Scalars &values );
+        void Record( const UInt iCase, const double time_h, const AIM::Grid_Aerosol &iceAer,
+                     const Vector_1D &xCoord, const Vector_1D &yCoord,
+                     const Vector_1D &xEdges, const Vector_1D &yEdges );
+        void SetStatus( const UInt iCase, const SimStatus status );
+
+    private:
+
+        std::unique_ptr<netCDF::NcFile> file_;
+        /* Number of records written for each case */
+        std::vector<size_t> nRecord_;
+
+};
+
+#endif /* SWEEPSUMMARY_H_INCLUDED */
@@ -28,8 +28,10 @@
 #include "Core/Parameters.hpp"
 #include "Core/Monitor.hpp"
 #include "Core/Aircraft.hpp"
+#include "Core/AmbientState.hpp"
 #include "Core/Emission.hpp"
 #include "Core/Status.hpp"
+#include "Core/Input_Mod.hpp"
 #include "AIM/Coagulation.hpp"
 #include "AIM/Nucleation.hpp"
 #include "AIM/Aerosol.hpp"
@@ -50,6 +52,7 @@ namespace EPM
         double area;
         double bypassArea;
         double coreExitTemp;
+        UInt solverSteps = 0; /* Number of ODE solver steps taken */
     };
 
     /* Vortex sinking timescales, taken from Unterstrasser et al., 2008 */
@@ -80,21 +83,36 @@ namespace EPM
     /* const double Ab0 = 1.804; */
     /* double Ab0 */
 
+    MicroOutputSettings microOutputSettings( const OptInput &Input_Opt );
+    EPMIntegrator integratorType( const OptInput &Input_Opt );
+
     SimStatus Integrate( double &temperature_K, double pressure_Pa, double relHumidity_w, double varArray[], \
                    const Vector_2D& aerArray, const Aircraft &AC, const Emission &EI, \
                    double &Ice_rad, double &Ice_den, double &Soot_den, double &H2O_mol, \
                    double &SO4g_mol, double &SO4l_mol, AIM::Aerosol &SO4Aer, AIM::Aerosol &IceAer, \
-                   double &Area, double &Ab0, double &Tc0, const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out );
+                   double &Area, double &Ab0, double &Tc0, const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, \
+                   const MicroOutputSettings &microSettings = MicroOutputSettings(), \
+                   EPMIntegrator integrator = EPMIntegrator::RKF78, UInt *nSteps = nullptr );
 
     std::pair<EPMOutput, SimStatus> Integrate(double tempInit_K, double pressure_Pa, double rhw, double bypassArea, double coreExitTemp, double varArray[], 
-                            const Vector_2D& aerArray, const Aircraft& AC,const Emission& EI, bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out);
+                            const Vector_2D& aerArray, const Aircraft& AC,const Emission& EI, bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, \
+                            const MicroOutputSettings &microSettings = MicroOutputSettings(), \
+                            EPMIntegrator integrator = EPMIntegrator::RKF78 );
+
+    /* Same as above, taking the ambient species and aerosols from ambient */
+    std::pair<EPMOutput, SimStatus> Integrate(double tempInit_K, double pressure_Pa, double rhw, double bypassArea, double coreExitTemp, const AmbientState &ambient,
+                            const Aircraft& AC,const Emission& EI, bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, \
+                            const MicroOutputSettings &microSettings = MicroOutputSettings(), \
+                            EPMIntegrator integrator = EPMIntegrator::RKF78 );
 
     SimStatus RunMicrophysics( double &temperature_K, double pressure_Pa, double relHumidity_w, \
                          double varArray[], const Vector_2D& aerArray, \
                          const Aircraft &AC, const Emission &EI, double delta_T_ad, double delta_T, \
                          double &Ice_rad, double &Ice_den, double &Soot_den, double &H2O_mol, \
                          double &SO4g_mol, double &SO4l_mol, AIM::Aerosol &SO4Aer, AIM::Aerosol &IceAer, \
-                         double &Area, double &Ab0, double &Tc0, const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out );
+                         double &Area, double &Ab0, double &Tc0, const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, \
+                         const MicroOutputSettings &microSettings = MicroOutputSettings(), \
+                         EPMIntegrator integrator = EPMIntegrator::RKF78, UInt *nSteps = nullptr );
     double dT_Vortex( const double time, const double delta_T, bool deriv = 0 );
     double entrainmentRate( const double time );
     double depositionRate( const double r, const double T, const double P, const double H2O, \
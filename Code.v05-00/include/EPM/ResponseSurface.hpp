@@ -0,0 +1,72 @@
+#ifndef EPM_RESPONSESURFACE_H
+#define EPM_RESPONSESURFACE_H
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Util/ForwardDecl.hpp"
+#include "Core/Status.hpp"
+#include "EPM/Integrate.hpp"
+
+namespace EPM
+{
+    /* Pretabulated EPM results on a regular grid in
+     * (T [K], P [Pa], RHw [%], soot EI [g/kg_fuel], soot radius [m], bypass area [m^2], core exit temp. [K]).
+     * Queries are multilinearly interpolated between the nodes of the surrounding cell.
+     * All other EPM inputs (aircraft, fuel, other EIs, background) must be those of the run that built
+     * the table: they are recorded in the table as a context string, which load checks against the run's. */
+    class ResponseSurface {
+        public:
+            static constexpr UInt NDIM = 7;
+            typedef std::array<double, NDIM> Point;
+            typedef std::pair<EPMOutput, SimStatus> NodeResult;
+
+            struct Result {
+                EPMOutput output;
+                SimStatus status;
+                //Estimated relative interpolation error, from the curvature of the table along each axis.
+                //Axes with only 2 nodes carry no curvature information and don't contribute.
+                double relError;
+            };
+
+            ResponseSurface() = default;
+            /* Builds the table from EPM results at arbitrary points, which must cover a full tensor product grid.
+             * Repeated points (e.g. cases only differing in parameters EPM doesn't see) are kept once. */
+            ResponseSurface(const std::vector<Point>& points, const std::vector<NodeResult>& results, const std::string& context = "");
+
+            /* Runs model on every node of the grid defined by axes (in parallel over nodes) */
+            static ResponseSurface build(const std::array<Vector_1D, NDIM>& axes, const std::function<NodeResult(const Point&)>& model,
+                                         const std::string& context = "");
+
+            /* Returns nothing if the query is outside of the table, if the status changes across the cell
+             * or its curvature stencil (regime change), or if the error estimate exceeds maxRelError.
+             * The caller is then expected to run EPM::Integrate. */
+            std::optional<Result> interpolate(const Point& query, double maxRelError = 1.0) const;
+
+            void write(const std::string& fileName) const;
+            static ResponseSurface read(const std::string& fileName);
+            /* Reads the table once per process and shares it between cases. Thread-safe.
+             * Throws if the table was built for another context than the caller's. */
+            static std::shared_ptr<const ResponseSurface> load(const std::string& fileName, const std::string& context);
+
+            inline const Vector_1D& axis(UInt d) const { return axes_[d]; }
+            inline const std::string& context() const { return context_; }
+            inline std::size_t size() const { return nodes_.size(); }
+
+        private:
+            std::size_t flatIndex(const std::array<std::size_t, NDIM>& idx) const;
+            void setStrides();
+
+            std::array<Vector_1D, NDIM> axes_;
+            std::array<std::size_t, NDIM> strides_;
+            std::vector<NodeResult> nodes_;
+            std::string context_;
+    };
+
+}
+
+#endif
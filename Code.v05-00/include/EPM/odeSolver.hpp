@@ -19,11 +19,16 @@
 #include <fstream>
 #include <cmath>
 #include <vector>
+#include <string>
+#include <limits>
+#include <algorithm>
 #include <boost/range/algorithm.hpp>
 #include <boost/numeric/odeint.hpp>
 #include <boost/numeric/odeint/stepper/runge_kutta_cash_karp54.hpp>
 #include <boost/numeric/odeint/stepper/controlled_runge_kutta.hpp>
 #include <boost/numeric/odeint/iterator/adaptive_iterator.hpp>
+#include <boost/numeric/odeint/stepper/rosenbrock4.hpp>
+#include <boost/numeric/odeint/stepper/rosenbrock4_controller.hpp>
 
 #include "Util/ForwardDecl.hpp"
 #include "Core/Parameters.hpp"
@@ -32,6 +37,8 @@
 
 typedef boost::numeric::odeint::runge_kutta_fehlberg78< Vector_1D > error_stepper_type;
 typedef boost::numeric::odeint::controlled_runge_kutta< error_stepper_type > controlled_stepper_type;
+typedef boost::numeric::ublas::vector< double > stiff_state_type;
+typedef boost::numeric::ublas::matrix< double > stiff_matrix_type;
 
 namespace EPM
 {
@@ -39,6 +46,123 @@ namespace EPM
     template<class System> class odeSolver;
     class streamingObserver;
 
+    enum class MicroOutputFormat : unsigned char {
+        None,
+        Text,
+        Binary
+    };
+
+    /* What the streaming observer writes to the micro output file.
+     * A state is recorded every writeEvery accepted steps, or earlier when
+     * one of the observed variables changed by more than relChange (relative)
+     * since the last recorded state. relChange = 0 disables the trigger. */
+    struct MicroOutputSettings {
+        MicroOutputFormat format = MicroOutputFormat::Text;
+        UInt writeEvery = 2;
+        double relChange = 0.0;
+    };
+
+    /* Time integrator for the plume ODE system:
+     * - RKF78: explicit Runge-Kutta-Fehlberg 7(8),
+     * - Rosenbrock4: linearly implicit 4th order Rosenbrock method. Stable
+     *   for stiff states, but each step needs a Jacobian, so it only pays
+     *   off when stability rather than the output interval limits the step. */
+    enum class EPMIntegrator : unsigned char {
+        RKF78,
+        Rosenbrock4
+    };
+
+    /* Adapts a right hand side f( x, dxdt, t ) written for Vector_1D to
+     * odeint's rosenbrock4, which works on ublas types and needs the
+     * Jacobian and df/dt. Those are built by forward differences: the
+     * system is small and dense, so this costs n + 2 evaluations of f. */
+    template<class RHS> class stiffSystem
+    {
+
+        public:
+
+            stiffSystem( const RHS &rhs, double atol ):
+                m_rhs( rhs ),
+                m_atol( atol )
+            {
+            }
+
+            void operator()( const stiff_state_type &xs, stiff_state_type &dxdt, double t ) const
+            {
+                Vector_1D x( xs.begin(), xs.end() );
+                Vector_1D f( x.size() );
+                m_rhs( x, f, t );
+                std::copy( f.begin(), f.end(), dxdt.begin() );
+            }
+
+            void jacobian( const stiff_state_type &xs, stiff_matrix_type &J, double t, stiff_state_type &dfdt ) const
+            {
+                const double sqrtEps = std::sqrt( std::numeric_limits<double>::epsilon() );
+                const std::size_t n = xs.size();
+                Vector_1D x( xs.begin(), xs.end() );
+                Vector_1D f0( n ), f1( n );
+                m_rhs( x, f0, t );
+
+                /* Perturbations are scaled by the absolute tolerance below
+                 * which the error control doesn't resolve a variable anyway */
+                for ( std::size_t j = 0; j < n; j++ ) {
+                    const double xj = x[j];
+                    const double h = sqrtEps * std::max( std::abs( xj ), m_atol );
+                    x[j] = xj + h;
+                    m_rhs( x, f1, t );
+                    x[j] = xj;
+                    const double invh = 1.0 / ( ( xj + h ) - xj );
+                    for ( std::size_t i = 0; i < n; i++ )
+                        J( i, j ) = ( f1[i] - f0[i] ) * invh;
+                }
+
+                const double ht = sqrtEps * std::max( std::abs( t ), 1.0E-10 );
+                m_rhs( x, f1, t + ht );
+                for ( std::size_t i = 0; i < n; i++ )
+                    dfdt[i] = ( f1[i] - f0[i] ) / ht;
+            }
+
+        private:
+
+            const RHS &m_rhs;
+            const double m_atol;
+
+    };
+
+    template<class RHS> struct stiffJacobian
+    {
+        const stiffSystem<RHS> &system;
+        void operator()( const stiff_state_type &x, stiff_matrix_type &J, double t, stiff_state_type &dfdt ) const
+        {
+            system.jacobian( x, J, t, dfdt );
+        }
+    };
+
+    /* Same as integrate_adaptive with a controlled RKF78 stepper, but with
+     * rosenbrock4. x is updated in place and observer sees Vector_1D states. */
+    template<class RHS, class Observer>
+    UInt integrateStiff( const RHS &rhs, Vector_1D &x, double start_time, double end_time, double dt, \
+                         Observer observer, double atol = EPM_ATOLS, double rtol = EPM_RTOLS )
+    {
+        stiffSystem<RHS> system( rhs, atol );
+        stiff_state_type xs( x.size() );
+        std::copy( x.begin(), x.end(), xs.begin() );
+
+        Vector_1D xObs( x.size() );
+        auto stiffObserver = [&observer, &xObs]( const stiff_state_type &state, double t ) {
+            std::copy( state.begin(), state.end(), xObs.begin() );
+            observer( xObs, t );
+        };
+
+        UInt nStep = boost::numeric::odeint::integrate_adaptive( \
+                            boost::numeric::odeint::make_controlled< boost::numeric::odeint::rosenbrock4< double > >( atol, rtol ), \
+                            std::make_pair( system, stiffJacobian<RHS>{ system } ), \
+                            xs, start_time, end_time, dt, stiffObserver );
+
+        std::copy( xs.begin(), xs.end(), x.begin() );
+        return nStep;
+    }
+
 }
 
 template<class System> class EPM::odeSolver
@@ -56,7 +180,7 @@ template<class System> class EPM::odeSolver
         void updateTime( double t );
         void updateStep( double dt );
 
-        UInt integrate( double start_time, double end_time, double dt, streamingObserver observer );
+        UInt integrate( double start_time, double end_time, double dt, streamingObserver &observer );
        
         UInt integrate( double start_time, double end_time, double dt );
        
@@ -83,32 +207,59 @@ template<class System> class EPM::odeSolver
 
 };
 
+/* Observer for the EPM integration with bounded memory:
+ * - the last historySize states are kept in a ring buffer,
+ * - recorded states are streamed to the micro output file as they come
+ *   in (see MicroOutputSettings) instead of being stored.
+ * Holds the output file, so it can't be copied. Pass it to odeint with
+ * std::ref( observer ). */
 class EPM::streamingObserver
 {
 
     public:
 
-        streamingObserver( Vector_2D &states, Vector_1D &times, std::vector<UInt> indices, std::string fileName, UInt write_every = 100 );
+        streamingObserver( std::vector<UInt> indices, std::string fileName, \
+                           const MicroOutputSettings &settings = MicroOutputSettings(), UInt historySize = 2 );
         ~streamingObserver( );
-        streamingObserver& operator=( const streamingObserver &obs );
+        streamingObserver( const streamingObserver &obs ) = delete;
+        streamingObserver& operator=( const streamingObserver &obs ) = delete;
         void operator()( const Vector_1D &x, double t );
-        double getLastElement() const;
-        void print2File( ) const;
-        bool checkwatersat( ) const;
 
-        UInt m_write_every;
-        UInt m_count = 0;
-        //const char* fileName;
-        std::string fileName;
+        /* age = 0 is the last observed state, age = 1 the one before, ... */
+        const Vector_1D& lastState( UInt age = 0 ) const;
+        double lastTime( UInt age = 0 ) const;
+        inline UInt nObserved() const { return m_count; }
+        inline UInt nRecorded() const { return m_nRecorded; }
 
-        Vector_2D &m_states;
-        Vector_1D &m_times;
+        /* Records the last state if it wasn't already, and closes the output file */
+        void close( );
+        /* True if water saturation was reached at any observed state */
+        inline bool checkwatersat( ) const { return m_waterSat; }
+
+        std::string fileName;
 
     protected:
 
     private:
-        
+
+        void writeHeader( );
+        void record( const Vector_1D &x, double t );
+        bool changedSinceRecord( const Vector_1D &x ) const;
+
         const std::vector<UInt> m_indices;
+        MicroOutputSettings m_settings;
+        std::ofstream m_file;
+
+        /* Ring buffer of the last states */
+        Vector_2D m_states;
+        Vector_1D m_times;
+        UInt m_head = 0;
+        UInt m_count = 0;
+
+        Vector_1D m_lastRecorded;
+        UInt m_lastRecordedCount = 0;
+        UInt m_nRecorded = 0;
+        bool m_waterSat = false;
 
 };
 
@@ -8,6 +8,7 @@
 #include "FVM_ANDS/BoundaryCondition.hpp"
 #include "FVM_ANDS_HelperFunctions.hpp"
 #include <memory>
+#include <algorithm>
 
 namespace FVM_ANDS{
     struct AdvDiffParams {
@@ -72,8 +73,13 @@ namespace FVM_ANDS{
             }
             inline void updateDx(double dx_new) { 
                 dx_ = dx_new;
-                invdx_ = dx_new;  
+                invdx_ = 1.0 / dx_new;
+                dxCell_.assign(nx_, dx_new);
+                invdxCell_.assign(nx_, invdx_);
             }
+            //Column-wise cell widths for grids that are non-uniform in x (e.g. coarsened buffer blocks).
+            //Fluxes are still evaluated per face, so the scheme stays conservative across width changes.
+            void updateCellWidthsX(const Vector_1D& dx_new);
             inline void updateYCoord(const Vector_1D& yCoord_new) { 
                 yCoord_ = yCoord_new;
             }
@@ -83,9 +89,9 @@ namespace FVM_ANDS{
             inline void updateSpacing(const Vector_1D& yCoord_new, double dx_new, int nx_new) {
                 updateYCoord(yCoord_new);
                 updateDy(yCoord_new[1] - yCoord_new[0]);
-                updateDy(dx_new);
                 updateNy(yCoord_new.size());
                 updateNx(nx_new);
+                updateDx(dx_new);
             }
             inline void updateTimestep(double dt){ dt_ = dt; }
             inline double courant() const{
@@ -123,6 +129,8 @@ namespace FVM_ANDS{
             double dy_;
             double invdx_;
             double invdy_;
+            Vector_1D dxCell_;
+            Vector_1D invdxCell_;
             int nx_;
             int ny_;
             int nInteriorPoints_;
@@ -149,6 +157,17 @@ namespace FVM_ANDS{
             void buildAdvectionCoeffs(int i, double& coeff_C, double& coeff_N, double& coeff_S, double& coeff_E, double& coeff_W);
             void updateGhostNodes();
 
+            inline int cellColumn(int pointID) const {
+                return format_ == vecFormat::COLMAJOR ? pointID / ny_ : pointID % nx_;
+            }
+            //Distance between the center of the cell and its east / west neighbor. Ghost cells mirror the boundary cell.
+            inline double centerDistE(int col) const {
+                return 0.5 * (dxCell_[col] + (col + 1 < nx_ ? dxCell_[col + 1] : dxCell_[col]));
+            }
+            inline double centerDistW(int col) const {
+                return 0.5 * (dxCell_[col] + (col > 0 ? dxCell_[col - 1] : dxCell_[col]));
+            }
+
             inline bool isValidPointID(int idx) const {
                 return (idx >= 0 && idx < phi_.rows());
             }
@@ -47,6 +47,9 @@ namespace FVM_ANDS{
             inline void updateSpacing(const Vector_1D& yCoords_new, double dx_new, int nx_new) {
                 advDiffSys_.updateSpacing(yCoords_new, dx_new, nx_new);
             }
+            inline void updateCellWidthsX(const Vector_1D& dx) {
+                advDiffSys_.updateCellWidthsX(dx);
+            }
             inline const Eigen::VectorXd& phi(){
                 return advDiffSys_.phi();
             }
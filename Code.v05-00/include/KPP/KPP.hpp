@@ -17,32 +17,89 @@
 
 #include "KPP/KPP_Parameters.h"
 
-#ifdef __cplusplus
-extern "C" {
-#endif /* __cplusplus */
+/* Chemical state of a single grid cell or box: everything the forward
+ * integrator reads and writes besides its arguments. Each concurrently
+ * integrated cell needs its own context; the mechanism tables (sparsity
+ * patterns, species names, ...) are read-only and shared. */
+struct KppContext {
+    double C[NSPEC] = {};           /* Concentration of all species */
+    double RCONST[NREACT] = {};     /* Rate constants */
+    double PHOTOL[NPHOTOL] = {};    /* Photolysis rates */
+    double HET[NSPEC][3] = {};      /* Heterogeneous reaction rates */
+    double TIME = 0.0;              /* Current integration time */
 
-int INTEGRATE( double VAR[] , double FIX[], double TIN   , double TOUT, \
+    /* Integrator statistics of the last call to INTEGRATE */
+    int Nfun = 0, Njac = 0, Nstp = 0, Nacc = 0;
+    int Nrej = 0, Ndec = 0, Nsol = 0, Nsng = 0;
+
+    double * VAR() { return &C[0]; }    /* Concentration of variable species */
+    double * FIX() { return &C[NVAR]; } /* Concentration of fixed species */
+};
+
+int INTEGRATE( KppContext &ctx, double TIN, double TOUT, \
                double ATOL[], double RTOL[], double STEPMIN );
-int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
+/* Number of cells INTEGRATE_BATCH advances in lockstep. 4 doubles fill an
+ * AVX2 register, 8 an AVX-512 one */
+#ifndef KPP_BATCH
+#define KPP_BATCH 4
+#endif
+
+/* Same as INTEGRATE for each cell, with KPP_BATCH cells sharing each step.
+ * Returns the number of cells that had to be finished by INTEGRATE */
+int INTEGRATE_BATCH( KppContext *ctx[], int IERR[], int nCells,  \
+                     double TIN, double TOUT,                    \
+                     double ATOL[], double RTOL[], double STEPMIN );
+/* Thermal rate constants can be cached on temperature and air density
+ * rounded to KPP_RCONST_DT [K] and KPP_RCONST_DLOGM (in ln M). With
+ * KPP_RCONST_DT = 1.0E-02, the steepest rates (E/R ~ 14000 K) change by
+ * 0.15% over half a bin at 220 K.
+ * The default resolution of 0 turns the cache off: rates are exact.
+ * Runs set the temperature resolution from the chemistry menu */
+#ifndef KPP_RCONST_DT
+#define KPP_RCONST_DT 0.0E+00
+#endif
+#ifndef KPP_RCONST_DLOGM
+#define KPP_RCONST_DLOGM 1.0E-04
+#endif
+#ifndef KPP_RCONST_CACHE_MAX
+#define KPP_RCONST_CACHE_MAX 4096
+#endif
+void Update_RCONST( KppContext &ctx, const double TEMP, const double PRESS, \
+                    const double AIRDENS, const double H2O );
+/* Changes the resolution of the thermal rate cache and empties it. A dT of 0
+ * turns the cache off */
+void Set_RCONST_Cache( const double dT, const double dLogM );
+void GC_SETHET( KppContext &ctx,                                            \
+                const double TEMP, const double PATM, const double AIRDENS, \
+                const double RELHUM, const unsigned int STATE_PSC,          \
+                const double SPC[], const double AREA[NAERO],               \
+                const double RADI[NAERO], const double IWC,                 \
+                const double KHETI_SLA[11], double tropopausePressure);
+
+/* The adjoint takes the fixed species and the photolysis rates from the
+ * ambient context, and integrates without heterogeneous chemistry */
+int KPP_Main_ADJ( const KppContext &ambient,                          \
+                  const double finalPlume[], const double initBackg[],  \
                   const double temperature_K, const double pressure_Pa, \
                   const double airDens, const double timeArray[],       \
                   const unsigned int NT,                                \
                   const double RTOLS, const double ATOLS,               \
+                  const int NCHECK,                                     \
                   double VAR_OUTPUT[], double *METRIC,                  \
                   const bool VERBOSE = 0, const bool RETRY = 0 );
-int INTEGRATE_ADJ( int NADJ, double Y[], double Lambda[][NVAR],        \
+/* Rates are read from ctx.RCONST and held constant over [TIN, TOUT] */
+int INTEGRATE_ADJ( KppContext &ctx,                                    \
+                   int NADJ, double Y[], double Lambda[][NVAR],        \
 		           double TIN, double TOUT, double ATOL_adj[][NVAR],   \
         	       double RTOL_adj[][NVAR], double ATOL[],             \
                    double RTOL[], int ICNTRL_U[],                      \
 		           double RCNTRL_U[], int ISTATUS_U[],                 \
                    double RSTATUS_U[], double STEPMIN );
-void Update_RCONST( const double TEMP, const double PRESS,  \
-                    const double AIRDENS, const double H2O );
-void GC_SETHET( const double TEMP, const double PATM, const double AIRDENS, \
-                const double RELHUM, const unsigned int STATE_PSC,          \
-                const double SPC[], const double AREA[NAERO],               \
-                const double RADI[NAERO], const double IWC,                 \
-                const double KHETI_SLA[11], double tropopausePressure);
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
 void Update_JRates ( double JRates[], const double CSZA );
 void ComputeFamilies( const double V[], const double F[], const double RCT[], \
                       double familyRates[] );
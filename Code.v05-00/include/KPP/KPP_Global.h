@@ -25,11 +25,6 @@
 
 /* Declaration of global variables                                  */
 
-extern double C[NSPEC];                         /* Concentration of all species */
-extern double * VAR;
-extern double * FIX;
-extern double RCONST[NREACT];                   /* Rate constants (global) */
-extern double TIME;                             /* Current integration time */
 extern int LOOKAT[NLOOKAT];                     /* Indexes of species to look at */
 extern const char * SPC_NAMES[NSPEC];           /* Names of chemical species */
 extern char * SMASS[NMASS];                     /* Names of atoms for mass balance */
@@ -39,13 +34,10 @@ extern char * EQN_TAGS[NREACT];                 /* Equation tags */
 /* INLINED global variable declarations                             */
 
 extern double NOON_JRATES[NPHOTOL];             /* Noon-time photolysis rates */
-extern double PHOTOL[NPHOTOL];                  /* Photolysis rates */
-extern double HET[NSPEC][3];                    /* Heterogeneous reaction rates */
-extern double SZA_CST[3];                       /* Constants to compute cosSZA */
 
-/* The following variables need to be declared THREADPRIVATE
- * because they get written to within an OpenMP parallel loop */
-#pragma omp threadprivate( C, VAR, FIX, RCONST, NOON_JRATES, PHOTOL, HET, TIME, SZA_CST )
+/* Concentrations, rates and time are kept in a KppContext (KPP.hpp).
+ * NOON_JRATES is set once per case; it is THREADPRIVATE for cases run in parallel */
+#pragma omp threadprivate( NOON_JRATES )
 
 /* INLINED global variable declarations                             */
 
@@ -0,0 +1,48 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/*                                                                  */
+/* KPP_Lanes Header File                                            */
+/*                                                                  */
+/* File                 : KPP_Lanes.hpp                             */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef KPP_LANES_H_INCLUDED
+#define KPP_LANES_H_INCLUDED
+
+#include "KPP/KPP.hpp"
+
+static_assert( ( KPP_BATCH & ( KPP_BATCH - 1 ) ) == 0, "KPP_BATCH must be a power of two" );
+
+/* KPP_BATCH values, one per cell of a batch. The generated ODE function
+ * and Jacobian are written for any type with the arithmetic of a double,
+ * so that on KppLanes every reaction is evaluated for all cells at once
+ * in a single vector register */
+struct KppLanes
+{
+    /* May alias double, so that arrays of lanes can be addressed by lane */
+    typedef double Vec __attribute__(( vector_size( KPP_BATCH * sizeof(double) ), may_alias ));
+    Vec v;
+
+    KppLanes() = default;
+    KppLanes( const double x ) : v( Vec{} + x ) {}
+
+    double  operator[]( const int l ) const { return v[l]; }
+    double& operator[]( const int l )       { return reinterpret_cast<double*>( &v )[l]; }
+};
+
+inline KppLanes operator+( const KppLanes &a, const KppLanes &b ) { KppLanes r; r.v = a.v + b.v; return r; }
+inline KppLanes operator-( const KppLanes &a, const KppLanes &b ) { KppLanes r; r.v = a.v - b.v; return r; }
+inline KppLanes operator*( const KppLanes &a, const KppLanes &b ) { KppLanes r; r.v = a.v * b.v; return r; }
+inline KppLanes operator/( const KppLanes &a, const KppLanes &b ) { KppLanes r; r.v = a.v / b.v; return r; }
+inline KppLanes operator-( const KppLanes &a )                    { KppLanes r; r.v = -a.v;      return r; }
+
+/* Fun and Jac_SP for KPP_BATCH cells, stored as lanes: the value of
+ * cell l of entry i is V[i][l] */
+void Fun_Batch( const KppLanes V[], const KppLanes F[], const KppLanes RCT[], KppLanes Vdot[] );
+void Jac_SP_Batch( const KppLanes V[], const KppLanes F[], const KppLanes RCT[], KppLanes JVS[] );
+
+#endif /* KPP_LANES_H_INCLUDED */
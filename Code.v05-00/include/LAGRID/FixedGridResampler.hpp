@@ -0,0 +1,39 @@
+#ifndef LAGRID_FIXEDGRIDRESAMPLER_H
+#define LAGRID_FIXEDGRIDRESAMPLER_H
+#include "LAGRID/RemapOperator.hpp"
+
+namespace LAGRID {
+    /*
+        Conservative resampling of fields from the model grid (uniform in y, possibly non-uniform in x) onto a fixed,
+        uniform analysis grid, with the same box-overlap weights as the transport remapping.
+        Each analysis cell holds the area average of the field over the part of the cell covered by the model grid,
+        and NaN where the model grid does not reach it. Model cells outside the analysis grid are dropped.
+    */
+    class FixedGridResampler {
+        public:
+            FixedGridResampler() = delete;
+            //xEdges and yEdges are the cell edges of the model grid
+            FixedGridResampler(const Remapping& grid, const Vector_1D& xEdges, const Vector_1D& yEdges);
+
+            Vector_2D apply(const Vector_2D& phi) const;
+            //Profiles along a single axis, averaged over the overlaps along that axis only
+            Vector_1D applyX(const Vector_1D& phi) const;
+            Vector_1D applyY(const Vector_1D& phi) const;
+
+            inline const Vector_1D& xCoords() const { return op_.xCoords(); }
+            inline const Vector_1D& yCoords() const { return op_.yCoords(); }
+
+        private:
+            const Remapping grid_;
+            const Vector_1D xEdges_;
+            const Vector_1D yEdges_;
+            const RemapOperator op_;
+            //Fraction of each analysis cell covered by the model grid
+            const Vector_2D coverage_;
+    };
+
+    //Average of phi, defined on cells with the given edges, over each of the n cells of width dx starting at x0
+    Vector_1D resample1D(const Vector_1D& edges, const Vector_1D& phi, double x0, double dx, int n);
+}
+
+#endif
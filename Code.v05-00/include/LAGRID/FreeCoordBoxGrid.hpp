@@ -25,6 +25,8 @@ namespace LAGRID {
         //Can apply a mask to the cutoff, and then can easily find the boundary nodes in O(N) time using the 0/1 mask.
         FreeCoordBoxGrid(const Vector_1D& dx, const Vector_1D& dy, const Vector_2D& phi, const Vector_1D& x0, double y0, double cutoff);
         FreeCoordBoxGrid(const Vector_1D& dx, const Vector_1D& dy, const Vector_2D& phi, const Vector_1D& x0, double y0, const vector<vector<int>>& mask);
+        //Same as above for grids that are non-uniform in x: xEdges[j] holds the nx + 1 cell edges of row j.
+        FreeCoordBoxGrid(const Vector_2D& xEdges, const Vector_1D& dy, const Vector_2D& phi, double y0, const vector<vector<int>>& mask);
         
         void setMinMaxCoords();
         std::vector<MassBox> boxes;
@@ -0,0 +1,61 @@
+#ifndef LAGRID_PADDEDGRID_H
+#define LAGRID_PADDEDGRID_H
+#include "Util/ForwardDecl.hpp"
+#include <span>
+
+namespace LAGRID {
+    /*
+        2D field stored in one contiguous block with spare zero cells (halo) on all four sides.
+        The logical grid is a window into the block, so growing the domain by buffer rows/columns
+        only moves the window: extend() is O(1) as long as the halo is large enough, and only
+        reallocates (with geometric growth of the halo) once the capacity on one side runs out.
+        Cells outside of the window are always zero, which is what a new buffer cell must hold.
+        Row j is at the bottom, same as Vector_2D fields in LAGRID.
+    */
+    class PaddedGrid {
+        public:
+            PaddedGrid() = delete;
+            PaddedGrid(int ny, int nx, int halo = 0);
+            PaddedGrid(int ny, int nx, int haloLeft, int haloRight, int haloTop, int haloBot);
+            explicit PaddedGrid(const Vector_2D& phi, int halo = 0);
+
+            inline double& operator()(int j, int i) { return data_[offset(j) + i]; }
+            inline double operator()(int j, int i) const { return data_[offset(j) + i]; }
+            //Row access, so that phi[j][i], phi.size() and phi[0].size() read like on a Vector_2D
+            inline std::span<double> operator[](int j) { return std::span<double>(data_.data() + offset(j), nx_); }
+            inline std::span<const double> operator[](int j) const { return std::span<const double>(data_.data() + offset(j), nx_); }
+            inline std::size_t size() const { return ny_; }
+
+            inline int nx() const { return nx_; }
+            inline int ny() const { return ny_; }
+            //Spare cells left on each side before extend() has to reallocate
+            inline int haloLeft() const { return colOrigin_; }
+            inline int haloRight() const { return stride_ - colOrigin_ - nx_; }
+            inline int haloBot() const { return rowOrigin_; }
+            inline int haloTop() const { return rows_ - rowOrigin_ - ny_; }
+
+            //Grows the logical grid by the given number of zero columns/rows on each side.
+            void extend(int nLeft, int nRight, int nTop, int nBot);
+            //Makes sure that at least this many spare cells are available on each side.
+            void reserve(int haloLeft, int haloRight, int haloTop, int haloBot);
+            //Turns this into an all-zero ny x nx grid without halo, keeping the storage if it is large enough.
+            void reset(int ny, int nx);
+            Vector_2D toVector2D() const;
+            //Same as toVector2D, but reuses the rows already allocated in phi.
+            void copyTo(Vector_2D& phi) const;
+
+        private:
+            inline std::size_t offset(int j) const { return static_cast<std::size_t>(j + rowOrigin_) * stride_ + colOrigin_; }
+            void reallocate(int haloLeft, int haloRight, int haloTop, int haloBot);
+
+            Vector_1D data_;
+            int stride_;
+            int rows_;
+            int rowOrigin_;
+            int colOrigin_;
+            int nx_;
+            int ny_;
+    };
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef LAGRID_REMAPOPERATOR_H
+#define LAGRID_REMAPOPERATOR_H
+#include "LAGRID/RemappingFunctions.hpp"
+#include "LAGRID/PaddedGrid.hpp"
+#include <vector>
+
+namespace LAGRID {
+    /*
+        Sparse linear operator equivalent to rectToBoxGrid -> mapToStructuredGrid -> addBuffer.
+        The box/grid-cell overlaps only depend on the geometry and the mask, not on the remapped field,
+        so they are computed once per remap and then applied to every field (pdf and volume for every bin, H2O, ...).
+        Adding buffers only shifts the destination indices, the overlaps are left untouched.
+    */
+    class RemapOperator {
+        public:
+            RemapOperator() = delete;
+            //unitBoxGrid must be the box grid of a field equal to 1 in every masked cell (see buildRemapOperator),
+            //so that box mass is the mass carried per unit of the original concentration.
+            RemapOperator(const FreeCoordBoxGrid& unitBoxGrid, const vector<vector<int>>& mask, const Remapping& remapping);
+
+            void addBuffer(double bufLen_left, double bufLen_right, double bufLen_top, double bufLen_bot);
+            //Same, but the left/right buffers are made of blocks that coarsen outwards (see coarsenedBufferWidths).
+            //The buffers don't receive any remapped mass, so this only changes the destination grid geometry.
+            void addBuffer(double bufLen_left, double bufLen_right, double bufLen_top, double bufLen_bot, int blockCells, int maxLevel);
+
+            Vector_2D apply(const Vector_2D& phi) const;
+            //Remaps phi into phi_new, which is reset to the buffered grid so that its storage is reused from one field to the next.
+            void apply(const Vector_2D& phi, PaddedGrid& phi_new) const;
+            //Remaps every field in place, in parallel over the fields. Each thread remaps through one reused PaddedGrid.
+            void applyInPlace(const std::vector<Vector_2D*>& fields) const;
+
+            inline const Vector_1D& xCoords() const { return xCoords_; }
+            inline const Vector_1D& yCoords() const { return yCoords_; }
+            inline const Vector_1D& xEdges() const { return xEdges_; }
+            //Resolution of the remapping grid, i.e. of the fine block
+            inline double dx() const { return dx_; }
+            inline double dy() const { return dy_; }
+            inline int nx() const { return xCoords_.size(); }
+            inline int ny() const { return yCoords_.size(); }
+            inline std::size_t nonZeros() const { return weights_.size(); }
+
+        private:
+            void addRowBuffers(double bufLen_top, double bufLen_bot);
+
+            //Source cell of each box, CSR layout: entries of box b are [boxStart_[b], boxStart_[b+1])
+            std::vector<int> srcRow_;
+            std::vector<int> srcCol_;
+            std::vector<std::size_t> boxStart_;
+            //Destination cell in the unbuffered remapping grid and weight of each entry
+            std::vector<int> dstRow_;
+            std::vector<int> dstCol_;
+            Vector_1D weights_;
+
+            //Origin of the remapping grid inside the buffered grid
+            int rowOffset_ = 0;
+            int colOffset_ = 0;
+            Vector_1D xCoords_;
+            Vector_1D xEdges_;
+            Vector_1D yCoords_;
+            double dx_;
+            double dy_;
+    };
+
+    RemapOperator buildRemapOperator(double dy_old, const Vector_1D& dy_new, double dx_old, double x0_old, double y0_new,
+                                     const vector<vector<int>>& mask, const Remapping& remapping);
+    RemapOperator buildRemapOperator(double dy_old, const Vector_1D& dy_new, const Vector_1D& xEdges_old, double y0_new,
+                                     const vector<vector<int>>& mask, const Remapping& remapping);
+}
+
+#endif
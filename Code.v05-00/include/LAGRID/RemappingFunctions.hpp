@@ -1,6 +1,7 @@
 #ifndef LAGRID_REMAPPINGFUNCTIONS_H
 #define LAGRID_REMAPPINGFUNCTIONS_H
 #include "LAGRID/FreeCoordBoxGrid.hpp"
+#include "LAGRID/PaddedGrid.hpp"
 #include "Util/PhysConstant.hpp"
 #include "Util/VectorUtils.hpp"
 #include <numeric>
@@ -33,26 +34,27 @@ namespace LAGRID {
         twoDGridVariable() = delete;
 
         //A little bit of template / universal reference magic to minimize the # of copy operations on these huge vectors.
-        //Enforces that Vec2D is of type Vector_2D and that Vec1D is of type Vec1D. And then we need the decay on the types because 
+        //Enforces that Vec2D is of type Vector_2D (or PaddedGrid) and that Vec1D is of type Vec1D. And then we need the decay on the types because 
         //with a forwarding reference, passing in a Vector_2D by value gets it deduced as a Vector_2D&
         //-Michael
         template <typename Vec2D, typename Vec1D,
-                    typename = std::enable_if_t<std::is_same_v<std::decay_t<Vec2D>, Vector_2D>>,
+                    typename = std::enable_if_t<std::is_same_v<std::decay_t<Vec2D>, Vector_2D> || std::is_same_v<std::decay_t<Vec2D>, PaddedGrid>>,
                     typename = std::enable_if_t<std::is_same_v<std::decay_t<Vec1D>, Vector_1D>>
                  >
         twoDGridVariable(Vec2D&& phi, Vec1D&& xCoords, Vec1D&& yCoords) :
-            phi(std::forward<Vector_2D>(phi)),
+            phi(std::forward<Vec2D>(phi)),
             xCoords(std::forward<Vector_1D>(xCoords)),
             yCoords(std::forward<Vector_1D>(yCoords)),
             dx(this->xCoords[1] - this->xCoords[0]),
             dy(this->yCoords[1] - this->yCoords[0])
         {
         }
-        Vector_2D phi;
+        PaddedGrid phi;
         Vector_1D xCoords;
         Vector_1D yCoords;
         double dx;
         double dy;
+        //Only moves the origin of phi inside its halo, see PaddedGrid
         void addBuffer(double bufLen_left, double bufLen_right, double bufLen_top, double bufLen_bot);
     };
 
@@ -73,10 +75,19 @@ namespace LAGRID {
     }
 
     FreeCoordBoxGrid rectToBoxGrid(double dy_old, const Vector_1D& dy_new, double dx_old, double x0_old, double y0_new, const Vector_2D& phi_old, const vector<vector<int>>& mask); 
+    //Non-uniform x version: every row is stretched by dy_new / dy_old about the center of the domain.
+    FreeCoordBoxGrid rectToBoxGrid(double dy_old, const Vector_1D& dy_new, const Vector_1D& xEdges_old, double y0_new, const Vector_2D& phi_old, const vector<vector<int>>& mask); 
+
+    //Widths of the cells of a buffer of length bufLen next to a block of resolution dx, ordered from the block outwards.
+    //The width doubles every blockCells cells until it reaches dx * 2^maxLevel. The last cell is kept if at least half of it
+    //lies within bufLen, so the buffer length is matched to within half of the coarsest cell.
+    Vector_1D coarsenedBufferWidths(double bufLen, double dx, int blockCells, int maxLevel);
 
     double diffusionLossFunctionExact(const FreeCoordBoxGrid& boxGrid, const Remapping& remapping);
     double diffusionLossFunctionBoundaryEstimate(const FreeCoordBoxGrid& boxGrid, const Remapping& remapping);
-    twoDGridVariable mapToStructuredGrid(const FreeCoordBoxGrid& boxGrid, const Remapping& remapping);
+    //The buffer lengths reserve a halo around phi, so that a later addBuffer with the same lengths does not reallocate.
+    twoDGridVariable mapToStructuredGrid(const FreeCoordBoxGrid& boxGrid, const Remapping& remapping,
+                                         double bufLen_left = 0, double bufLen_right = 0, double bufLen_top = 0, double bufLen_bot = 0);
 
     Vector_2D initVarToGrid(double mass, const Vector_1D& xEdges, const Vector_1D& yEdges,
                             std::function<double(double, double)> weightFunction, double logBinRatio = 1 );
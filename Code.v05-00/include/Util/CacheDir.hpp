@@ -0,0 +1,18 @@
+#ifndef CACHEDIR_H_INCLUDED
+#define CACHEDIR_H_INCLUDED
+
+#include <string>
+
+/* Per-user folder for the caches built from input files, so that input
+ * folders can be shared and read-only: $XDG_CACHE_HOME/APCEMM, or
+ * ~/.cache/APCEMM. The folder is created if needed. Returns an empty string
+ * if there is no such folder or it cannot be created. */
+std::string UserCacheDir();
+
+/* Name of the cache of sourceFile in UserCacheDir(), with the given prefix
+ * and extension. Inputs with the same name in different folders get
+ * different caches. Returns an empty string if there is no cache folder. */
+std::string UserCacheFile( const std::string &sourceFile, const std::string &prefix, \
+                           const std::string &extension );
+
+#endif /* CACHEDIR_H_INCLUDED */
@@ -14,14 +14,63 @@
 #ifndef MC_RAND_H_INCLUDED
 #define MC_RAND_H_INCLUDED
 
-#include <iostream>
-#include <cstdlib>
+#include <array>
+#include <cstdint>
+#include <string>
 
-/* Set seed for pseudo-random generator */
-void setSeed();
+/* Counter-based pseudo-random numbers (Philox4x32-10, Salmon et al.,
+ * "Parallel random numbers: as easy as 1, 2, 3", SC'11).
+ * Each draw is a pure function of a key (the seed) and a counter (e.g.
+ * case, timestep and cell indices): there is no generator state, so
+ * draws can be made in any order, by any number of threads, and give
+ * the same values. */
 
-/* Generates a random number of type T between fMin and fMax */
+typedef std::array<std::uint32_t, 4> RandCounter;
+typedef std::array<std::uint32_t, 2> RandKey;
+
+inline RandKey randKey( const std::uint64_t seed )
+{
+    return { (std::uint32_t) seed, (std::uint32_t) ( seed >> 32 ) };
+}
+
+/* Four independent 32-bit words for each counter */
+inline RandCounter philox4x32( RandCounter ctr, RandKey key )
+{
+
+    const std::uint32_t M0 = 0xD2511F53;
+    const std::uint32_t M1 = 0xCD9E8D57;
+    const std::uint32_t W0 = 0x9E3779B9;
+    const std::uint32_t W1 = 0xBB67AE85;
+
+    for ( int round = 0; round < 10; round++ ) {
+        const std::uint64_t p0 = (std::uint64_t) M0 * ctr[0];
+        const std::uint64_t p1 = (std::uint64_t) M1 * ctr[2];
+        ctr = { (std::uint32_t) ( p1 >> 32 ) ^ ctr[1] ^ key[0], (std::uint32_t) p1, \
+                (std::uint32_t) ( p0 >> 32 ) ^ ctr[3] ^ key[1], (std::uint32_t) p0 };
+        key[0] += W0;
+        key[1] += W1;
+    }
+    return ctr;
+
+}
+
+/* Uniform number in [0, 1) with 53 random bits from two words */
+inline double uniform01( const std::uint32_t hi, const std::uint32_t lo )
+{
+    return ( ( ( (std::uint64_t) hi << 32 ) | lo ) >> 11 ) * 0x1.0p-53;
+}
+
+/* Generates a random number of type T between fMin and fMax, from the
+ * first two words drawn for counter */
 template <typename T>
-T fRand(const T fMin, const T fMax);
+inline T fRand( const T fMin, const T fMax, const RandKey &key, const RandCounter &counter )
+{
+    const RandCounter words = philox4x32( counter, key );
+    return (T) ( fMin + uniform01( words[0], words[1] ) * ( fMax - fMin ) );
+}
+
+/* Stable identifier of a named stream of draws (e.g. a parameter name), to
+ * be put in a counter word */
+std::uint32_t randStream( const std::string &name );
 
 #endif /* MC_RAND_H_INCLUDED */
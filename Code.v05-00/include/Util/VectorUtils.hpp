@@ -7,6 +7,7 @@
 namespace VectorUtils {
     using std::vector;
     Vector_2D cellAreas (const Vector_1D& xEdges, const Vector_1D& yEdges);
+    Vector_1D cellWidths (const Vector_1D& edges);
     
     double VecMin2D (const Vector_2D& vec);
 
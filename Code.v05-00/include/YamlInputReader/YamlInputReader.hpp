@@ -25,7 +25,7 @@ namespace YamlInputReader{
     
     void performOtherInputValidnessChecks(OptInput& input);
     vector<std::unordered_map<string, double>> generateCases(const OptInput& input);
-    Vector_1D parseParamSweepInput(const string paramString, const string paramLocation = "", bool monteCarlo = false, int nRuns = 0);
+    Vector_1D parseParamSweepInput(const string paramString, const string paramLocation = "", bool monteCarlo = false, int nRuns = 0, std::uint64_t seed = 0);
     vector<string> split(const string str, const string delimiter);
 
     inline string trim(const string str){
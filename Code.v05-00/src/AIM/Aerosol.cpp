@@ -11,7 +11,9 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <map>
 #include "AIM/Aerosol.hpp"
+#include "AIM/KernelCache.hpp"
 #include "Core/Structure.hpp"
 
 namespace AIM
@@ -683,6 +685,192 @@ Aerosol::Aerosol(const Vector_1D& bin_Centers_, const Vector_1D& bin_Edges_, dou
 
     } /* End of Grid_Aerosol::Coagulate */
 
+    void Grid_Aerosol::Coagulate(const double dt, const Vector_2D &T, const Vector_1D &P, const char* phase, const double rho, const UInt N, const UInt SYM)
+    {
+
+        /* DESCRIPTION:
+         * Performs self-coagulation with a kernel evaluated at the local
+         * temperature and pressure. Updates Aerosol.pdf
+         * Same mass-conserving scheme as the Coagulate overload above, but
+         * grid cells are processed in parallel, each thread owning its own
+         * sparse f/indices scratch (CoagulationMap). Within a cell, bins are
+         * updated in increasing order so that production uses the updated
+         * volume of smaller bins, and the number concentrations of the
+         * collision partners are taken at the start of the step.
+         * The kernel is bilinearly interpolated in (T, ln P) between the
+         * KernelCache nodes around each cell.
+         * Active cells are sorted by thermodynamic state and volume-center
+         * structure so that consecutive cells handled by a thread can reuse
+         * the same map. */
+
+        /* INPUT:
+         * - double dt     :: Timestep in s
+         * - Vector_2D T   :: Temperature [K] ( Ny x Nx )
+         * - Vector_1D P   :: Pressure [Pa] ( Ny )
+         * - char* phase   :: Kernel phase (see buildTotalKernel)
+         * - double rho    :: Particle density [kg/m^3]
+         * - UInt N        :: Coagulation scenarios ( 0, 1 or 2 )
+         * - UInt SYM      :: Symmetry?
+         *
+         * OUTPUT:
+         *
+         */
+
+        UInt Nx_max, Ny_max;
+
+        bool performCoag = CheckCoagAndGrowInputs(N, SYM, Nx_max, Ny_max, "Coagulation");
+        if(performCoag == false) { return; }
+
+        /* Particle volume in each bin */
+        const Vector_3D v = Volume(); /* Expressed in [m^3/cm^3] */
+        Vector_3D v_new = v;
+
+        /* Node indices and kernels below are for the same resolution */
+        KernelCache& cache = KernelCache::getInstance();
+        const KernelCache::Resolution resolution = cache.resolution();
+        const double dT = resolution.dT_K;
+        const double dlnP = resolution.dlnP;
+
+        struct ActiveCell {
+            UInt jNy, iNx;
+            long iT, iP;
+            double wT, wP;
+            std::size_t vHash;
+            std::size_t nodes[4];
+        };
+
+        /* Only run coagulation where aerosol volume is greater than 0.1 um^3/cm^3 */
+        std::vector<ActiveCell> cells;
+        for (UInt jNy = 0; jNy < Ny_max; jNy++) {
+            const double tP = log(P[jNy]) / dlnP;
+            const long iP = static_cast<long>(std::floor(tP));
+            for (UInt iNx = 0; iNx < Nx_max; iNx++) {
+                double totVol = 0.0E+00;
+                std::size_t vHash = nBin;
+                for (UInt iBin = 0; iBin < nBin; iBin++) {
+                    totVol += v[iBin][jNy][iNx];
+                    vHash ^= std::hash<double>{}(bin_VCenters[iBin][jNy][iNx]) + 0x9e3779b97f4a7c15ULL + (vHash << 6) + (vHash >> 2);
+                }
+                if (totVol * 1E18 > 0.1) {
+                    const double tT = T[jNy][iNx] / dT;
+                    const long iT = static_cast<long>(std::floor(tT));
+                    cells.push_back({ jNy, iNx, iT, iP, tT - iT, tP - iP, vHash, { 0, 0, 0, 0 } });
+                }
+            }
+        }
+
+        std::sort(cells.begin(), cells.end(), [](const ActiveCell& a, const ActiveCell& b) {
+            return std::tie(a.iT, a.iP, a.vHash) < std::tie(b.iT, b.iP, b.vHash);
+        });
+
+        /* Kernels are evaluated on the cache nodes surrounding each cell's
+         * (T, ln P), all built in parallel, and bilinearly interpolated per
+         * cell. Beta is linear in the kernel, so interpolating beta is the
+         * same as interpolating the kernel. */
+        std::map<std::pair<long, long>, std::size_t> nodeIndex;
+        std::vector<long> nodeT, nodeP;
+        for (ActiveCell& cell: cells) {
+            for (int n = 0; n < 4; n++) {
+                const std::pair<long, long> node(cell.iT + n % 2, cell.iP + n / 2);
+                auto inserted = nodeIndex.emplace(node, nodeT.size());
+                if (inserted.second) {
+                    nodeT.push_back(node.first);
+                    nodeP.push_back(node.second);
+                }
+                cell.nodes[n] = inserted.first->second;
+            }
+        }
+        const std::vector<Vector_2D> kernels = cache.getNodeKernels(phase, resolution, nodeT, nodeP, bin_Centers, rho);
+        Vector_3D betas(kernels.size());
+        for (std::size_t s = 0; s < kernels.size(); s++) {
+            Coagulation coag;
+            coag.updateKernel(phase, kernels[s], bin_Centers);
+            betas[s] = coag.getBeta();
+        }
+
+        Vector_1D binWidth(nBin);
+        for (UInt iBin = 0; iBin < nBin; iBin++)
+            binWidth[iBin] = log(bin_Edges[iBin + 1] / bin_Edges[iBin]);
+
+        #pragma omp parallel if (!PARALLEL_CASES) default(shared)
+        {
+
+            /* All declarations here are enforced as thread private */
+            CoagulationMap map;
+            Vector_1D vCenters(nBin), vCell(nBin), vCell_new(nBin), nPart(nBin), Prod(nBin), Loss(nBin);
+            Vector_2D beta(nBin, Vector_1D(nBin));
+
+            /* Contiguous chunks keep cells with the same kernel and map on the same thread */
+            #pragma omp for schedule(static)
+            for (std::size_t c = 0; c < cells.size(); c++) {
+                const UInt jNy = cells[c].jNy;
+                const UInt iNx = cells[c].iNx;
+                const ActiveCell& cell = cells[c];
+                const double weights[4] = { (1.0 - cell.wT) * (1.0 - cell.wP), cell.wT * (1.0 - cell.wP),
+                                            (1.0 - cell.wT) * cell.wP,         cell.wT * cell.wP };
+                const Vector_2D& beta0 = betas[cell.nodes[0]];
+                const Vector_2D& beta1 = betas[cell.nodes[1]];
+                const Vector_2D& beta2 = betas[cell.nodes[2]];
+                const Vector_2D& beta3 = betas[cell.nodes[3]];
+                for (UInt iBin = 0; iBin < nBin; iBin++) {
+                    for (UInt jBin = 0; jBin < nBin; jBin++) {
+                        beta[iBin][jBin] = weights[0] * beta0[iBin][jBin] + weights[1] * beta1[iBin][jBin]
+                                         + weights[2] * beta2[iBin][jBin] + weights[3] * beta3[iBin][jBin];
+                    }
+                }
+
+                for (UInt iBin = 0; iBin < nBin; iBin++) {
+                    vCenters[iBin] = bin_VCenters[iBin][jNy][iNx];
+                    vCell[iBin] = v[iBin][jNy][iNx];
+                    nPart[iBin] = pdf[iBin][jNy][iNx] * binWidth[iBin];
+                    Prod[iBin] = 0.0E+00;
+                }
+                if (vCenters != map.vCenters)
+                    map.build(vCenters);
+
+                for (UInt iBin = 0; iBin < nBin; iBin++) {
+
+                    /* i coagulating with j to deplete i */
+                    Loss[iBin] = 0.0E+00;
+                    for (UInt jBin = 0; jBin < nBin; jBin++) {
+                        const double f_ii = map.f(iBin, jBin, iBin);
+                        if (f_ii != 1.0)
+                            Loss[iBin] += (1.0 - f_ii) * beta[iBin][jBin] * nPart[jBin];
+                    }
+
+                    /* Mass conserving scheme: */
+                    vCell_new[iBin] = (vCell[iBin] + dt * Prod[iBin]) / (1.0 + dt * Loss[iBin]);
+
+                    /* i coagulating with j to form larger bins */
+                    for (UInt jBin = 0; jBin < nBin; jBin++) {
+                        const UInt kBin = map.target(iBin, jBin);
+                        const double rate = beta[iBin][jBin] * vCell_new[iBin] * nPart[jBin];
+                        /* [cm^3/#/s] * [m^3/cm^3] * [#/cm^3] = [m^3/cm^3/s] */
+                        if (kBin > iBin && jBin <= kBin)
+                            Prod[kBin] += map.fLow(iBin, jBin) * rate;
+                        if (map.splits(iBin, jBin) && kBin + 1 > iBin && jBin <= kBin + 1)
+                            Prod[kBin + 1] += (1.0 - map.fLow(iBin, jBin)) * rate;
+                    }
+                }
+
+                for (UInt iBin = 0; iBin < nBin; iBin++) {
+                    v_new[iBin][jNy][iNx] = vCell_new[iBin];
+                    if (vCell[iBin] > 0.0E+00)
+                        pdf[iBin][jNy][iNx] *= vCell_new[iBin] / vCell[iBin];
+                }
+            }
+
+        } /* pragma omp parallel */
+
+        /* Update bin centers */
+        UpdateCenters(v_new, pdf);
+
+        //Apply Symmetry
+        Vector_2D temp = Vector_2D();
+        CoagAndGrowApplySymmetry(N, SYM, Nx_max, Ny_max, "Coagulate", temp);
+
+    } /* End of Grid_Aerosol::Coagulate */
+
     void Grid_Aerosol::Grow( const double dt, Vector_2D &H2O, const Vector_2D &T, const Vector_1D &P, const UInt N, const UInt SYM )
     {
 
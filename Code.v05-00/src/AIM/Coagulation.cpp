@@ -23,165 +23,39 @@ namespace AIM
 
     } /* End of Coagulation::Coagulation */
 
-    Coagulation::Coagulation( const char* phase, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1, double rho_1, Vector_1D const &bin_Centers_2, double rho_2, double temperature_K_, double pressure_Pa_ ): Kernel( bin_Centers_1.size() )
+    Coagulation::Coagulation( const char* phase, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1, double rho_1, Vector_1D const &bin_Centers_2, double rho_2, double temperature_K_, double pressure_Pa_ )
     {
 
         /* Constructor */
 
-        double temperature_K = temperature_K_;
-        double pressure_Pa = pressure_Pa_;
-
-        /* Set shape */
-        for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-            Kernel[iBin_1].resize( bin_Centers_2.size() );
-        }
-
-        if ( ( strcmp ( phase, "liq" ) == 0) || ( strcmp( phase, "liquid" ) == 0) || ( strcmp( phase, "sulfate" ) == 0) ) {
-            /* Liquid-liquid coagulation */
-
-            /* Declare and assign coagulation kernels for different physical processes */
-            Vector_2D K_Brow = buildBrownianKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
-            Vector_2D K_DE   = buildDEKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2, K_Brow );
-
-            /* Fill in total coagulation kernel */
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_2.size(); iBin_2++ ) {
-                    Kernel[iBin_1][iBin_2] = ( K_Brow[iBin_1][iBin_2] + K_DE[iBin_1][iBin_2] ) * 1.00E+06; /* Conversion from m^3/s to cm^3/s */
-                }
-            }
-
-        } 
-        else if ( ( strcmp ( phase, "ice" ) == 0) ) { 
-            /* Ice-Ice coagulation */
-
-            /* Declare and assign coagulation kernels for different physical processes */
-            Vector_2D K_Brow = buildBrownianKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
-            Vector_2D K_DE   = buildDEKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2, K_Brow );
-            Vector_2D K_GC   = buildGCKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
-            Vector_2D K_TI   = buildTIKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
-            Vector_2D K_TS   = buildTSKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
-            
-            /* Fill in total coagulation kernel */
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_2.size(); iBin_2++ ) {
-                    Kernel[iBin_1][iBin_2] = ( K_Brow[iBin_1][iBin_2] + K_DE[iBin_1][iBin_2] + K_GC[iBin_1][iBin_2] + K_TI[iBin_1][iBin_2] + K_TS[iBin_1][iBin_2] ) * 1.00E+06; /* Conversion from m^3/s to cm^3/s */
-                }
-            }
-
-        }
-        else if ( ( strcmp ( phase, "soot" ) == 0) || ( strcmp( phase, "bc" ) == 0) ) {
-            /* Soot-soot coagulation */
-
-            /* Declare and assign coagulation kernels for different physical processes */
-            Vector_2D K_Brow = buildBrownianKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
-            Vector_2D K_DE   = buildDEKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2, K_Brow );
+        /* Total coagulation kernel in cm^3/s */
+        Kernel = buildTotalKernel( phase, temperature_K_, pressure_Pa_, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
 
-            /* Fill in total coagulation kernel */
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_2.size(); iBin_2++ ) {
-                    Kernel[iBin_1][iBin_2] = ( K_Brow[iBin_1][iBin_2] + K_DE[iBin_1][iBin_2] ) * 1.00E+06; /* Conversion from m^3/s to cm^3/s */
-                }
-            }
-
-        }
-        else {
-            std::cout << "\nIn AIM::Coagulation::Coagulation: phase " << phase << " is not defined.";
-            std::cout << "\nOptions are: liquid, ice or soot.";
-        }
-
-        if ( strcmp( phase, "liq" ) == 0 )
-            buildBeta( bin_Centers_1 );
-        else {
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                beta.push_back( Vector_1D( bin_Centers_1.size() ) );
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_2.size(); iBin_2++ ) {
-                    /* Assuming an aggregation efficiency of 1 */
-                    beta[iBin_1][iBin_2] = Kernel[iBin_1][iBin_2];
-                }
-            }
-        }
+        buildBeta( phase, bin_Centers_1 );
         buildF   ( bin_VCenters_1 );
 
-
     } /* End of Coagulation::Coagulation */
 
-    Coagulation::Coagulation( const char* phase, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1, double rho_1, double temperature_K_, double pressure_Pa_ ): Kernel( bin_Centers_1.size() )
+    Coagulation::Coagulation( const char* phase, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1, double rho_1, double temperature_K_, double pressure_Pa_ )
     {
 
         /* Constructor */
 
-        double temperature_K = temperature_K_;
-        double pressure_Pa = pressure_Pa_;
-
-        /* Set shape */
-        for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-            Kernel[iBin_1].resize( bin_Centers_1.size() );
-        }
-
-        if ( ( strcmp ( phase, "liq" ) == 0) || ( strcmp( phase, "liquid" ) == 0) || ( strcmp( phase, "sulfate" ) == 0) ) {
-            /* Liquid-liquid coagulation */
-
-            /* Declare and assign coagulation kernels for different physical processes */
-            Vector_2D K_Brow = buildBrownianKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1 );
-            Vector_2D K_DE   = buildDEKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1, K_Brow );
-
-            /* Fill in total coagulation kernel */
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_1.size(); iBin_2++ ) {
-                    Kernel[iBin_1][iBin_2] = ( K_Brow[iBin_1][iBin_2] + K_DE[iBin_1][iBin_2] ) * 1.00E+06; /* Conversion from m^3/s to cm^3/s */
-                }
-            }
-
-        } 
-        else if ( ( strcmp ( phase, "ice" ) == 0) ) { 
-            /* Ice-Ice coagulation */
+        /* Total coagulation kernel in cm^3/s */
+        Kernel = buildTotalKernel( phase, temperature_K_, pressure_Pa_, bin_Centers_1, rho_1, bin_Centers_1, rho_1 );
 
-            /* Declare and assign coagulation kernels for different physical processes */
-            Vector_2D K_Brow = buildBrownianKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1 );
-            Vector_2D K_DE   = buildDEKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1, K_Brow );
-            Vector_2D K_GC   = buildGCKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1 );
-            Vector_2D K_TI   = buildTIKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1 );
-            Vector_2D K_TS   = buildTSKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1 );
-            
-            /* Fill in total coagulation kernel */
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_1.size(); iBin_2++ ) {
-                    Kernel[iBin_1][iBin_2] = ( K_Brow[iBin_1][iBin_2] + K_DE[iBin_1][iBin_2] + K_GC[iBin_1][iBin_2] + K_TI[iBin_1][iBin_2] + K_TS[iBin_1][iBin_2] ) * 1.00E+06; /* Conversion from m^3/s to cm^3/s */
-                }
-            }
-
-        }
-        else if ( ( strcmp ( phase, "soot" ) == 0) || ( strcmp( phase, "bc" ) == 0) ) {
-            /* Soot-soot coagulation */
+        buildBeta( phase, bin_Centers_1 );
+        buildF   ( bin_VCenters_1 );
 
-            /* Declare and assign coagulation kernels for different physical processes */
-            Vector_2D K_Brow = buildBrownianKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1 );
-            Vector_2D K_DE   = buildDEKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_1, rho_1, K_Brow );
+    } /* End of Coagulation::Coagulation */
 
-            /* Fill in total coagulation kernel */
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_1.size(); iBin_2++ ) {
-                    Kernel[iBin_1][iBin_2] = ( K_Brow[iBin_1][iBin_2] + K_DE[iBin_1][iBin_2] ) * 1.00E+06; /* Conversion from m^3/s to cm^3/s */
-                }
-            }
+    Coagulation::Coagulation( const char* phase, const Vector_2D &kernel, Vector_1D const &bin_Centers_1, Vector_1D &bin_VCenters_1 ):
+        Kernel( kernel )
+    {
 
-        }
-        else {
-            std::cout << "\nIn AIM::Coagulation::Coagulation: phase " << phase << " is not defined.";
-            std::cout << "\nOptions are: liquid, ice or soot.";
-        }
+        /* Constructor from a precomputed (e.g. cached) kernel in cm^3/s */
 
-        if ( strcmp( phase, "liq" ) == 0 )
-            buildBeta( bin_Centers_1 );
-        else {
-            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
-                beta.push_back( Vector_1D( bin_Centers_1.size() ) );
-                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_1.size(); iBin_2++ ) {
-                    /* Assuming an aggregation efficiency of 1 */
-                    beta[iBin_1][iBin_2] = Kernel[iBin_1][iBin_2];
-                }
-            }
-        }
+        buildBeta( phase, bin_Centers_1 );
         buildF   ( bin_VCenters_1 );
 
     } /* End of Coagulation::Coagulation */
@@ -279,6 +153,33 @@ namespace AIM
 
     } /* End of Coagulation::operator= */
 
+    void Coagulation::updateKernel( const char* phase, const Vector_2D &kernel, const Vector_1D &bin_Centers )
+    {
+
+        /* Swap in a new kernel (e.g. from the KernelCache) for the current
+         * local conditions. f and indices only depend on the volume grid and
+         * are left untouched. */
+
+        Kernel = kernel;
+        buildBeta( phase, bin_Centers );
+
+    } /* End of Coagulation::updateKernel */
+
+    void Coagulation::buildBeta( const char* phase, const Vector_1D &bin_Centers )
+    {
+
+        beta.clear();
+
+        if ( strcmp( phase, "liq" ) == 0 ) {
+            buildBeta( bin_Centers );
+            return;
+        }
+
+        /* Assuming an aggregation efficiency of 1 */
+        beta = Kernel;
+
+    } /* End of Coagulation::buildBeta */
+
     void Coagulation::buildBeta( const Vector_1D &bin_Centers )
     {
 
@@ -422,6 +323,36 @@ namespace AIM
 
     } /* End of Coagulation::buildF */
 
+    void CoagulationMap::build( const Vector_1D &bin_VCenters )
+    {
+
+        /* Same partitioning as Coagulation::buildF, stored sparsely */
+
+        double vij;
+        UInt iBin, jBin, index;
+
+        nBin = bin_VCenters.size();
+        vCenters = bin_VCenters;
+        targets.assign( nBin * nBin, 0 );
+        fractions.assign( nBin * nBin, 0.0E+00 );
+
+        for ( iBin = 0; iBin < nBin; iBin++ ) {
+            for ( jBin = 0; jBin < nBin; jBin++ ) {
+                vij = bin_VCenters[iBin] + bin_VCenters[jBin];
+                index = std::distance( bin_VCenters.begin(), std::upper_bound( bin_VCenters.begin(), bin_VCenters.end(), vij ) ) - 1;
+
+                if ( index < nBin-1 ) {
+                    targets[iBin * nBin + jBin]   = index;
+                    fractions[iBin * nBin + jBin] = ( bin_VCenters[index+1] - vij ) / ( bin_VCenters[index+1] - bin_VCenters[index] ) * bin_VCenters[index] / vij;
+                } else {
+                    targets[iBin * nBin + jBin]   = nBin-1;
+                    fractions[iBin * nBin + jBin] = 1.0;
+                }
+            }
+        }
+
+    } /* End of CoagulationMap::build */
+
     Vector_2D Coagulation::getKernel() const
     {
 
@@ -0,0 +1,272 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include "Core/Parameters.hpp"
+#include "AIM/KernelCache.hpp"
+
+namespace AIM {
+
+    KernelCache& KernelCache::getInstance() {
+        static KernelCache instance;
+        return instance;
+    }
+
+    std::size_t KernelCache::KeyHash::operator()(const Key& key) const {
+        std::size_t seed = std::hash<std::string>{}(key.phase);
+        auto combine = [&seed](std::size_t h) {
+            seed ^= h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        };
+        combine(key.grid->hash);
+        combine(std::hash<long>{}(key.iT));
+        combine(std::hash<long>{}(key.iP));
+        return seed;
+    }
+
+    KernelCache::GridPtr KernelCache::makeGrid(const Vector_1D& bin_Centers_1, double rho_1, const Vector_1D& bin_Centers_2, double rho_2) {
+        //FNV-1a over the raw bytes of the bin centers and densities
+        std::uint64_t h = 14695981039346656037ULL;
+        auto hashDouble = [&h](double x) {
+            unsigned char bytes[sizeof(double)];
+            std::memcpy(bytes, &x, sizeof(double));
+            for (unsigned char b: bytes) {
+                h ^= b;
+                h *= 1099511628211ULL;
+            }
+        };
+        hashDouble(static_cast<double>(bin_Centers_1.size()));
+        for (double r: bin_Centers_1) hashDouble(r);
+        hashDouble(rho_1);
+        hashDouble(static_cast<double>(bin_Centers_2.size()));
+        for (double r: bin_Centers_2) hashDouble(r);
+        hashDouble(rho_2);
+        return std::make_shared<const Grid>(Grid{ bin_Centers_1, rho_1, bin_Centers_2, rho_2, static_cast<std::size_t>(h) });
+    }
+
+    KernelCache::NodeStencil KernelCache::stencil(const std::string& phase, const GridPtr& grid, const Resolution& resolution,
+                                                  double temperature_K, double pressure_Pa) {
+        if (temperature_K <= 0 || pressure_Pa <= 0) {
+            throw std::invalid_argument("KernelCache: temperature and pressure must be positive");
+        }
+        //States on a node up to round-off use that node alone
+        auto snap = [](double t) {
+            const double nearest = std::round(t);
+            return std::abs(t - nearest) <= 1.0e-9 * std::max(1.0, std::abs(t)) ? nearest : t;
+        };
+        const double tT = snap(temperature_K / resolution.dT_K);
+        const double tP = snap(std::log(pressure_Pa) / resolution.dlnP);
+        const long iT = static_cast<long>(std::floor(tT));
+        const long iP = static_cast<long>(std::floor(tP));
+        const double wT = tT - iT;
+        const double wP = tP - iP;
+
+        NodeStencil nodes;
+        nodes.keys[0] = Key{ phase, grid, iT,     iP     };
+        nodes.keys[1] = Key{ phase, grid, iT + 1, iP     };
+        nodes.keys[2] = Key{ phase, grid, iT,     iP + 1 };
+        nodes.keys[3] = Key{ phase, grid, iT + 1, iP + 1 };
+        nodes.weights[0] = (1.0 - wT) * (1.0 - wP);
+        nodes.weights[1] = wT * (1.0 - wP);
+        nodes.weights[2] = (1.0 - wT) * wP;
+        nodes.weights[3] = wT * wP;
+        return nodes;
+    }
+
+    std::vector<KernelCache::KernelPtr> KernelCache::acquire(const std::vector<Key>& keys, const Resolution& resolution) {
+        std::vector<KernelPtr> kernels(keys.size());
+        std::vector<std::size_t> missing;
+        const double dT = resolution.dT_K;
+        const double dlnP = resolution.dlnP;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            //Nodes of another resolution are not in the cache
+            const bool current = (dT == dT_ && dlnP == dlnP_);
+            for (std::size_t i = 0; i < keys.size(); i++) {
+                auto it = current ? cache_.find(keys[i]) : cache_.end();
+                if (it != cache_.end()) {
+                    kernels[i] = it->second;
+                } else {
+                    missing.push_back(i);
+                }
+            }
+        }
+        if (missing.empty()) return kernels;
+
+        //Kernel builds are independent and dominate the cost, so they run outside of the lock.
+        //Nested inside an already parallel region this just runs on the calling thread.
+        #pragma omp parallel for schedule(dynamic, 1) if(!PARALLEL_CASES)
+        for (std::size_t m = 0; m < missing.size(); m++) {
+            const Key& key = keys[missing[m]];
+            const double T = key.iT * dT;
+            const double P = std::exp(key.iP * dlnP);
+            kernels[missing[m]] = std::make_shared<const Vector_2D>(
+                buildTotalKernel(key.phase.c_str(), T, P, key.grid->bin_Centers_1, key.grid->rho_1, key.grid->bin_Centers_2, key.grid->rho_2));
+        }
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        //Not the current resolution, or it changed while we were building: hand out the kernels but don't store them
+        if (dT != dT_ || dlnP != dlnP_) return kernels;
+        if (cache_.size() + missing.size() > maxEntries_) {
+            cache_.clear();
+        }
+        for (std::size_t idx: missing) {
+            cache_.emplace(keys[idx], kernels[idx]);
+        }
+        return kernels;
+    }
+
+    Vector_2D KernelCache::interpolate(const KernelPtr* kernels, const double* weights, std::size_t nNodes) {
+        Vector_2D result;
+        for (std::size_t n = 0; n < nNodes; n++) {
+            if (weights[n] == 0.0) continue;
+            const Vector_2D& K = *kernels[n];
+            if (result.empty()) {
+                result.assign(K.size(), Vector_1D());
+                for (std::size_t i = 0; i < K.size(); i++) {
+                    result[i].assign(K[i].size(), 0.0);
+                }
+            }
+            for (std::size_t i = 0; i < K.size(); i++) {
+                for (std::size_t j = 0; j < K[i].size(); j++) {
+                    result[i][j] += weights[n] * K[i][j];
+                }
+            }
+        }
+        return result;
+    }
+
+    Vector_2D KernelCache::getKernel(const char* phase, double temperature_K, double pressure_Pa,
+                                     const Vector_1D& bin_Centers_1, double rho_1,
+                                     const Vector_1D& bin_Centers_2, double rho_2) {
+        const GridPtr grid = makeGrid(bin_Centers_1, rho_1, bin_Centers_2, rho_2);
+        const Resolution res = resolution();
+        const NodeStencil nodes = stencil(phase, grid, res, temperature_K, pressure_Pa);
+
+        std::vector<Key> keys;
+        std::vector<double> weights;
+        for (int n = 0; n < 4; n++) {
+            if (nodes.weights[n] == 0.0) continue;
+            keys.push_back(nodes.keys[n]);
+            weights.push_back(nodes.weights[n]);
+        }
+        const std::vector<KernelPtr> kernels = acquire(keys, res);
+        return interpolate(kernels.data(), weights.data(), kernels.size());
+    }
+
+    std::vector<Vector_2D> KernelCache::getKernels(const char* phase, const Vector_1D& temperature_K, const Vector_1D& pressure_Pa,
+                                                   const Vector_1D& bin_Centers, double rho) {
+        if (temperature_K.size() != pressure_Pa.size()) {
+            throw std::invalid_argument("KernelCache::getKernels: temperature and pressure arrays differ in size");
+        }
+        const GridPtr grid = makeGrid(bin_Centers, rho, bin_Centers, rho);
+        const std::size_t nStates = temperature_K.size();
+
+        const Resolution res = resolution();
+        std::vector<NodeStencil> stencils(nStates);
+        for (std::size_t s = 0; s < nStates; s++) {
+            stencils[s] = stencil(phase, grid, res, temperature_K[s], pressure_Pa[s]);
+        }
+
+        //Collect the distinct nodes needed by all states so each one is built at most once
+        std::unordered_map<Key, std::size_t, KeyHash> uniqueIndex;
+        std::vector<Key> uniqueKeys;
+        for (const NodeStencil& nodes: stencils) {
+            for (int n = 0; n < 4; n++) {
+                if (nodes.weights[n] == 0.0) continue;
+                if (uniqueIndex.emplace(nodes.keys[n], uniqueKeys.size()).second) {
+                    uniqueKeys.push_back(nodes.keys[n]);
+                }
+            }
+        }
+        const std::vector<KernelPtr> kernels = acquire(uniqueKeys, res);
+
+        std::vector<Vector_2D> result(nStates);
+        #pragma omp parallel for if(!PARALLEL_CASES)
+        for (std::size_t s = 0; s < nStates; s++) {
+            KernelPtr stateKernels[4];
+            double weights[4];
+            std::size_t nNodes = 0;
+            for (int n = 0; n < 4; n++) {
+                if (stencils[s].weights[n] == 0.0) continue;
+                stateKernels[nNodes] = kernels[uniqueIndex.at(stencils[s].keys[n])];
+                weights[nNodes] = stencils[s].weights[n];
+                nNodes++;
+            }
+            result[s] = interpolate(stateKernels, weights, nNodes);
+        }
+        return result;
+    }
+
+    std::vector<Vector_2D> KernelCache::getNodeKernels(const char* phase, const Resolution& resolution,
+                                                       const std::vector<long>& iT, const std::vector<long>& iP,
+                                                       const Vector_1D& bin_Centers, double rho) {
+        if (iT.size() != iP.size()) {
+            throw std::invalid_argument("KernelCache::getNodeKernels: temperature and pressure node arrays differ in size");
+        }
+        const GridPtr grid = makeGrid(bin_Centers, rho, bin_Centers, rho);
+        std::vector<Key> keys;
+        keys.reserve(iT.size());
+        for (std::size_t s = 0; s < iT.size(); s++) {
+            keys.push_back(Key{ phase, grid, iT[s], iP[s] });
+        }
+        const std::vector<KernelPtr> kernels = acquire(keys, resolution);
+
+        std::vector<Vector_2D> result(kernels.size());
+        for (std::size_t s = 0; s < kernels.size(); s++) {
+            result[s] = *kernels[s];
+        }
+        return result;
+    }
+
+    void KernelCache::precompute(const char* phase, double Tmin_K, double Tmax_K, double Pmin_Pa, double Pmax_Pa,
+                                 const Vector_1D& bin_Centers, double rho) {
+        if (Tmin_K > Tmax_K || Pmin_Pa > Pmax_Pa) {
+            throw std::invalid_argument("KernelCache::precompute: empty temperature or pressure range");
+        }
+        const GridPtr grid = makeGrid(bin_Centers, rho, bin_Centers, rho);
+        const Resolution res = resolution();
+        const NodeStencil lo = stencil(phase, grid, res, Tmin_K, Pmin_Pa);
+        const NodeStencil hi = stencil(phase, grid, res, Tmax_K, Pmax_Pa);
+        std::vector<Key> keys;
+        for (long iT = lo.keys[0].iT; iT <= hi.keys[3].iT; iT++) {
+            for (long iP = lo.keys[0].iP; iP <= hi.keys[3].iP; iP++) {
+                keys.push_back(Key{ phase, grid, iT, iP });
+            }
+        }
+        acquire(keys, res);
+    }
+
+    void KernelCache::setResolution(double dT_K, double dlnP) {
+        if (dT_K <= 0 || dlnP <= 0) {
+            throw std::invalid_argument("KernelCache::setResolution: node spacing must be positive");
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (dT_K == dT_ && dlnP == dlnP_) return;
+        dT_ = dT_K;
+        dlnP_ = dlnP;
+        cache_.clear();
+    }
+
+    void KernelCache::setMaxEntries(std::size_t maxEntries) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        maxEntries_ = maxEntries;
+        if (cache_.size() > maxEntries_) cache_.clear();
+    }
+
+    void KernelCache::clear() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        cache_.clear();
+    }
+
+    std::size_t KernelCache::size() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return cache_.size();
+    }
+
+    KernelCache::Resolution KernelCache::resolution() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return Resolution{ dT_, dlnP_ };
+    }
+
+}
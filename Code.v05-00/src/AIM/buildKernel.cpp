@@ -318,5 +318,59 @@ namespace AIM
         return K_TS;
 
     } /* End of buildTSKernel */
+
+    Vector_2D buildTotalKernel( const char* phase, double temperature_K, double pressure_Pa, Vector_1D const &bin_Centers_1, double rho_1, Vector_1D const &bin_Centers_2, double rho_2 )
+    {
+
+        /* Returns the total coagulation kernel in cm^3/s for the given
+         * phase. An undefined phase yields a zero kernel. */
+
+        Vector_2D Kernel( bin_Centers_1.size(), Vector_1D( bin_Centers_2.size(), 0.0E+00 ) );
+
+        const bool isLiquid = ( strcmp( phase, "liq" ) == 0 ) || ( strcmp( phase, "liquid" ) == 0 ) || ( strcmp( phase, "sulfate" ) == 0 );
+        const bool isIce    = ( strcmp( phase, "ice" ) == 0 );
+        const bool isSoot   = ( strcmp( phase, "soot" ) == 0 ) || ( strcmp( phase, "bc" ) == 0 );
+
+        if ( !isLiquid && !isIce && !isSoot ) {
+            std::cout << "\nIn AIM::Coagulation::Coagulation: phase " << phase << " is not defined.";
+            std::cout << "\nOptions are: liquid, ice or soot.";
+            return Kernel;
+        }
+
+        /* Declare and assign coagulation kernels for different physical processes */
+        Vector_2D K_Brow = buildBrownianKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
+        Vector_2D K_DE   = buildDEKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2, K_Brow );
+
+        for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
+            for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_2.size(); iBin_2++ ) {
+                Kernel[iBin_1][iBin_2] = K_Brow[iBin_1][iBin_2] + K_DE[iBin_1][iBin_2];
+            }
+        }
+
+        if ( isIce ) {
+            /* Ice-Ice coagulation also includes gravitational collection and turbulence */
+            Vector_2D K_GC   = buildGCKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
+            Vector_2D K_TI   = buildTIKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
+            Vector_2D K_TS   = buildTSKernel( temperature_K, pressure_Pa, bin_Centers_1, rho_1, bin_Centers_2, rho_2 );
+
+            for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
+                for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_2.size(); iBin_2++ ) {
+                    Kernel[iBin_1][iBin_2] += K_GC[iBin_1][iBin_2] + K_TI[iBin_1][iBin_2] + K_TS[iBin_1][iBin_2];
+                }
+            }
+        }
+
+        /* Conversion from m^3/s to cm^3/s */
+        for ( unsigned int iBin_1 = 0; iBin_1 < bin_Centers_1.size(); iBin_1++ ) {
+            for ( unsigned int iBin_2 = 0; iBin_2 < bin_Centers_2.size(); iBin_2++ ) {
+                Kernel[iBin_1][iBin_2] *= 1.00E+06;
+            }
+        }
+
+        return Kernel;
+
+    } /* End of buildTotalKernel */
+
 }
 
+/* End of buildKernel.cpp */
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include "Core/AmbientState.hpp"
+#include "Core/Structure.hpp"
+#include "Core/LiquidAer.hpp"
+
+AmbientState::AmbientState( const char *fileName,      \
+                            const Input &input,        \
+                            const double airDens,      \
+                            const Meteorology &met,    \
+                            const OptInput &Input_Opt, \
+                            const UInt i, const UInt j,
+                            const bool DBG ):
+    species_( NSPEC, 0.0 ),
+    aerosol_( N_AER, Vector_1D( 3, 0.0 ) ),
+    KHETI_SLA_( 11, 0.0 ),
+    STATE_PSC_( 0 )
+{
+
+    Vector_1D amb_Value(NSPECALL, 0.0);
+    Vector_2D aer_Value(N_AER, Vector_1D(2, 0.0));
+
+    /* Same steps as Solution::Initialize */
+    Solution::readInputBackgroundConditions(input, amb_Value, aer_Value, fileName);
+
+    /* The spun-up concentrations are taken from amb_Value */
+    double VAR[NVAR];
+    double FIX[NFIX];
+    const double AMBIENT_VALID_TIME = 8.0; //hours
+    Solution::SpinUp( amb_Value, input, airDens, AMBIENT_VALID_TIME, VAR, FIX );
+
+    Solution::setAmbientConcentrations(input, amb_Value);
+
+    Vector_1D value(NSPECALL, 0.0);
+    for ( UInt N = 0; N < NSPECALL; N++ )
+        value[N] = amb_Value[N] * airDens;
+
+    /* Only H2O varies across the grid. The stratospheric aerosol
+     * partitioning uses H2O at the first cell, the species at (i, j). */
+    double H2Omet_0, H2Omet_ij;
+    if ( Input_Opt.MET_LOADMET ) {
+        H2Omet_0  = met.H2O_field()[0][0];
+        H2Omet_ij = met.H2O_field()[j][i];
+    } else {
+        H2Omet_0 = (input.relHumidity_w()/((double) 100.0) * \
+                    physFunc::pSat_H2Ol( input.temperature_K() ) / ( physConst::kB * input.temperature_K() )) / 1.00E+06;
+        H2Omet_ij = H2Omet_0;
+    }
+    value[ind_H2Omet] = H2Omet_ij;
+    value[ind_H2O]    = H2Omet_ij + value[ind_H2Oplume];
+
+    Vector_1D stratData{ value[ind_SO4],   value[ind_HNO3],  \
+                         value[ind_HCl],   value[ind_HOCl],  \
+                         value[ind_HBr],   value[ind_HOBr],  \
+                         H2Omet_0 + value[ind_H2Oplume], value[ind_ClNO3], \
+                         value[ind_BrNO3], value[ind_NIT],   \
+                         value[ind_NAT] };
+
+    Vector_1D AERFRAC( 7, 0.0 );
+    Vector_1D SOLIDFRAC( 7, 0.0 );
+    Vector_1D RAD( 2, 0.0 ), RHO( 2, 0.0 ), KG( 2, 0.0 ), NDENS( 2, 0.0 ), SAD( 2, 0.0 );
+
+    const double boxArea = (Input_Opt.ADV_GRID_XLIM_LEFT + Input_Opt.ADV_GRID_XLIM_RIGHT) * (Input_Opt.ADV_GRID_YLIM_UP + Input_Opt.ADV_GRID_YLIM_DOWN);
+    STATE_PSC_ = STRAT_AER( input.temperature_K(), input.pressure_Pa(), airDens,  \
+                            input.latitude_deg(), stratData,                      \
+                            boxArea, KHETI_SLA_, SOLIDFRAC,                       \
+                            AERFRAC, RAD, RHO, KG, NDENS, SAD, Input_Opt.ADV_TROPOPAUSE_PRESSURE, DBG );
+
+    /* Liquid/solid species, as in Solution::setSpeciesValues */
+    value[ind_SO4L]  = AERFRAC[0]                          * stratData[0];
+    value[ind_SO4]   = ( 1.0 - AERFRAC[0] )                * stratData[0];
+    value[ind_H2OL]  = 0.0E+00;
+    value[ind_H2OS]  = 0.0E+00;
+    value[ind_HNO3L] = AERFRAC[1]                          * stratData[1];
+    value[ind_HNO3S] = SOLIDFRAC[1]                        * stratData[1];
+    value[ind_HNO3]  = ( 1.0 - AERFRAC[1] - SOLIDFRAC[1] ) * stratData[1];
+    value[ind_HClL]  = AERFRAC[2]                          * stratData[2];
+    value[ind_HCl]   = ( 1.0 - AERFRAC[2] )                * stratData[2];
+    value[ind_HOClL] = AERFRAC[3]                          * stratData[3];
+    value[ind_HOCl]  = ( 1.0 - AERFRAC[3] )                * stratData[3];
+    value[ind_HBrL]  = AERFRAC[4]                          * stratData[4];
+    value[ind_HBr]   = ( 1.0 - AERFRAC[4] )                * stratData[4];
+    value[ind_HOBrL] = AERFRAC[5]                          * stratData[5];
+    value[ind_HOBr]  = ( 1.0 - AERFRAC[5] )                * stratData[5];
+    value[ind_NIT]   = stratData[ 9];
+    value[ind_NAT]   = stratData[10];
+
+    std::copy( value.begin(), value.begin() + NSPEC, species_.begin() );
+
+    /* Aerosols, as in Solution::getAerosol */
+    /* Assume that soot particles are monodisperse */
+    aerosol_[0][0] = aer_Value[0][0];
+    aerosol_[0][1] = aer_Value[0][1];
+    aerosol_[0][2] = 4.0 / double(3.0) * physConst::PI * aer_Value[0][0] * aer_Value[0][1] * aer_Value[0][1] * aer_Value[0][1];
+    aerosol_[1][0] = NDENS[0] * 1.00E-06; /* [#/cm^3]      */
+    aerosol_[1][1] = RAD[0]   * 1.00E+09; /* [nm]          */
+    aerosol_[1][2] = SAD[0]   * 1.00E+06; /* [\mum^2/cm^3] */
+    aerosol_[2][0] = NDENS[1] * 1.00E-06;
+    aerosol_[2][1] = RAD[1]   * 1.00E+09;
+    aerosol_[2][2] = SAD[1]   * 1.00E+06;
+
+} /* End of AmbientState::AmbientState */
+
+void AmbientState::getData( double* varSpeciesArray, double* fixSpeciesArray ) const
+{
+
+    std::copy( species_.begin(), species_.begin() + NVAR, varSpeciesArray );
+    std::copy( species_.begin() + NVAR, species_.begin() + NVAR + NFIX, fixSpeciesArray );
+
+} /* End of AmbientState::getData */
+
+/* End of AmbientState.cpp */
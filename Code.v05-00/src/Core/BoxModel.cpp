@@ -11,18 +11,13 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-
-static int SUCCESS     =  1;
-
 /* STL includes */
 #include <iostream>
 #include <vector>
-#include <numeric>
 #include <cmath>
 #include <algorithm>
-#include <complex>
-#include <ctime>
-#include <sys/stat.h>
+#include <chrono>
+#include <memory>
 #ifdef OMP
     #include "omp.h"
 #endif /* OMP */
@@ -32,421 +27,285 @@ static int SUCCESS     =  1;
 #include "Core/Parameters.hpp"
 #include "Core/Interface.hpp"
 #include "Core/Input.hpp"
-#include "Core/Structure.hpp"
-#include "Core/Monitor.hpp"
+#include "Core/AmbientState.hpp"
+#include "Core/BoxModel.hpp"
+#include "Core/Mesh.hpp"
+#include "Core/Cluster.hpp"
+#include "Core/Meteorology.hpp"
 #include "KPP/KPP.hpp"
 #include "KPP/KPP_Parameters.h"
 #include "KPP/KPP_Global.h"
 #include "Core/SZA.hpp"
-#include "Core/Ambient.hpp"
 #include "Core/Fuel.hpp"
 #include "Core/Engine.hpp"
 #include "Core/Aircraft.hpp"
 #include "Core/Emission.hpp"
+#include "Core/ReadJRates.hpp"
+#include "Core/TimestepVarsWrapper.hpp"
+#include "Core/MPMSimVarsWrapper.hpp"
+#include "Util/PlumeModelUtils.hpp"
+#include "Core/Diag_Mod.hpp"
+#include "Core/OutputWriter.hpp"
+#include "Core/Status.hpp"
+
+double BoxPlume::area( const double t ) const
+{
+
+    /* Gaussian spreading: sigma^2 grows by 2 D t along each axis */
+    const double a = sqrt( sigmaX * sigmaX + 2.0 * horizDiff * t );
+    const double b = sqrt( sigmaY * sigmaY + 2.0 * vertiDiff * t );
+    return std::min( physConst::PI * a * b, maxArea );
 
-#include "Core/Save.hpp"
-static int SAVE_FAIL    = -2;
+} /* End of BoxPlume::area */
 
-Vector_1D BuildTime( const double tStart, const double tEnd,    \
-                     const double sunRise, const double sunSet, \
-                     const double DYN_DT );
-int BoxModel( const OptInput &Input_Opt, const Input &input )
+int BoxIntegrate( KppContext &boxKPP, KppContext &ambientKPP,                        \
+                  const BoxPlume &plume, const Vector_1D &timeArray,                 \
+                  const std::function<void( KppContext&, double, double )> &setRates, \
+                  double ATOL[], double RTOL[], Vector_2D &boxSpecies )
 {
 
-    bool printDEBUG = 0;
-    int isSaved_Box = 0;
+    const double STEPMIN = (double)0.0;
+    const UInt nT = timeArray.size();
 
-#ifdef DEBUG
+    double * VAR    = boxKPP.VAR();
+    double * ambVAR = ambientKPP.VAR();
 
-    std::cout << "\n DEBUG is turned ON!\n\n";
-    printDEBUG = 1;
+    for ( UInt N = 0; N < NVAR; N++ )
+        boxSpecies[N][0] = VAR[N];
 
-#endif /* DEBUG */
-    
-    /* ======================================================================= */
-    /* --- Input options from the SIMULATION MENU ---------------------------- */
-    /* ======================================================================= */
-    
-    const bool BUILD_LUT      = Input_Opt.SIMULATION_PARAMETER_SWEEP;
-    /* Filename for background conditions */
-    const char* BACKG_FILENAME= Input_Opt.SIMULATION_INPUT_BACKG_COND.c_str();
-    
-    /* ======================================================================= */
-    /* ---- Input options from the CHEMISTRY MENU ---------------------------- */
-    /* ======================================================================= */
+    int IERR = 0;
+    for ( UInt nTime = 0; nTime + 1 < nT; nTime++ ) {
 
-    const bool HETCHEM        = Input_Opt.CHEMISTRY_HETCHEM;
-    /* Folder for photolysis rates */
-    const char* JRATE_FOLDER  = Input_Opt.CHEMISTRY_JRATE_FOLDER.c_str();
-   
-    /* Make sure that same timesteps as plume model are used */
+        const double tCurr = timeArray[nTime];
+        const double dt    = timeArray[nTime+1] - timeArray[nTime];
 
-    const double CHEMISTRY_DT = Input_Opt.CHEMISTRY_TIMESTEP;
+        setRates( boxKPP, tCurr, dt );
+        IERR = INTEGRATE( boxKPP, tCurr, tCurr + dt, ATOL, RTOL, STEPMIN );
 
-    /* ======================================================================= */
-    /* ---- Input options from the TRANSPORT MENU ---------------------------- */
-    /* ======================================================================= */
+        if ( IERR >= 0 ) {
+            setRates( ambientKPP, tCurr, dt );
+            IERR = INTEGRATE( ambientKPP, tCurr, tCurr + dt, ATOL, RTOL, STEPMIN );
+        }
 
-    const double TRANSPORT_DT = Input_Opt.TRANSPORT_TIMESTEP;
+        if ( IERR < 0 ) {
+            /* Integration failed */
 
-    /* ======================================================================= */
-    /* ---- Input options from the TIMESERIES MENU --------------------------- */
-    /* ======================================================================= */
+            std::cout << "Integration failed";
+            #ifdef OMP
+                std::cout << " on " << omp_get_thread_num();
+            #endif /* OMP */
+            std::cout << " for box model at time t = " << tCurr/3600.0 << " ( nTime = " << nTime << " )\n";
+            return IERR;
+        }
+
+        /* Entrain ambient air into the growing cross-section */
+        const double ratio = plume.area( tCurr - timeArray[0] ) / plume.area( tCurr + dt - timeArray[0] );
+        for ( UInt N = 0; N < NVAR; N++ ) {
+            VAR[N] = ambVAR[N] + ( VAR[N] - ambVAR[N] ) * ratio;
+            boxSpecies[N][nTime+1] = VAR[N];
+        }
 
-    const std::vector<int> TS_SPEC_LIST = Input_Opt.TS_SPECIES;
-
-    /* Define dynamic timestep in s */
-    double DYN_DT;
-
-    /* If either TRANSPORT or CHEMISTRY is set to 0, then pick the non-zero 
-     * timestep.
-     * If both are non-zero, then pick the smallest timestep.
-     *
-     * Both TRANSPORT_DT and CHEMISTRY_DT are expressed in minutes! */
-
-    if ( ( TRANSPORT_DT == 0.0E+00 ) || ( CHEMISTRY_DT == 0.0E+00 ) )
-        DYN_DT = std::max( TRANSPORT_DT, CHEMISTRY_DT ) * 60.0;
-    else if ( ( TRANSPORT_DT > 0.0E+00 ) && ( CHEMISTRY_DT > 0.0E+00 ) )
-        DYN_DT = std::min( TRANSPORT_DT, CHEMISTRY_DT ) * 60.0;
-    else {
-        std::cout << " Invalid option when setting the dynamic timestep. Abort!" << std::endl;
-        std::cout << " TRANSPORT_DT = " << TRANSPORT_DT << " min" << std::endl;
-        std::cout << " CHEMISTRY_DT = " << CHEMISTRY_DT << " min" << std::endl;
-        exit(1);
     }
 
-    const double BOX_AREA = ( Input_Opt.ADV_GRID_XLIM_LEFT + Input_Opt.ADV_GRID_XLIM_RIGHT ) * ( Input_Opt.ADV_GRID_YLIM_UP + Input_Opt.ADV_GRID_YLIM_DOWN );
+    return IERR;
+
+} /* End of BoxIntegrate */
+
+/* Single well-mixed parcel: the emissions of one meter of flight path are
+ * released into the inner ring of the plume model and the chemistry is
+ * integrated without transport or microphysics, while the parcel entrains
+ * ambient air as it spreads. Meant as a cheap first pass over large parameter
+ * sweeps. */
+SimStatus BoxModel( OptInput &Input_Opt, const Input &input )
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    KppContext boxKPP;                  /* Chemical state of the box */
+    KppContext ambientKPP;              /* Chemical state of the ambient air */
+    double * VAR = boxKPP.VAR();        /* Concentration of variable species */
+    double * FIX = boxKPP.FIX();        /* Concentration of fixed species */
 
-    /* Assign parameters */
-    
-    double temperature_K = input.temperature_K();
-    double pressure_Pa   = input.pressure_Pa();
-    double relHumidity_w = input.relHumidity_w();
-    double relHumidity;
-    double AerosolArea[NAERO];
-    double AerosolRadi[NAERO];
-    double IWC = 0;
+    bool printDEBUG = false;
 
-    /* Compute relative humidity w.r.t ice */
-    double relHumidity_i = relHumidity_w * physFunc::pSat_H2Ol( temperature_K )\
-                                             / physFunc::pSat_H2Os( temperature_K );
+#ifdef DEBUG
 
-    int IERR;
+    std::cout << "\n DEBUG is turned ON!\n\n";
+    printDEBUG = true;
+
+#endif /* DEBUG */
+
+    MPMSimVarsWrapper simVars = MPMSimVarsWrapper(input, Input_Opt);
 
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
-    /* -------------- SOLAR ZENITH ANGLE ------------------------------------- */
+    /* --------------------------------- MESH -------------------------------- */
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
-    /* Define sun parameters, this include sunrise and sunset hours and updates
-     * the local solar zenith angle. */
-    SZA *sun = new SZA( input.latitude_deg(), input.emissionDOY() ); 
+    /* The mesh only sets the domain area and the background initialization */
+    Mesh m(Input_Opt);
+    const Vector_1D xE = m.xE();
+    const Vector_1D yE = m.yE();
+
+    double domainArea = 0.0E+00;
+    for ( const Vector_1D &row : m.areas() ) {
+        for ( const double area : row )
+            domainArea += area;
+    }
 
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
-    /* ------------------------------ TIMESTEPS ------------------------------ */
+    /* -------------- SOLAR ZENITH ANGLE + PHOTOLYSIS RATES ------------------ */
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
-    /*  
-     *  - tEmission is the local emission time expressed in hours 
-     *  (between 0.0 and 24.0)
-     *  - tInitial is the local time at which the simulation starts in hours
-     *  - simulationTime represents the simulation time (in hours) (now read from
-     *    input file)
-     *  - tFinal corresponds to the final time of the simulation expressed in hours
-     */ 
+    /* Allocate photolysis rate array */
+    double jRate[NPHOTOL];
 
-    /* Define emission and simulation time */
-    const double tEmission_h = input.emissionTime();                 /* [hr] */
-    const double tInitial_h  = tEmission_h;                          /* [hr] */
-    const double tFinal_h    = tInitial_h + input.simulationTime();  /* [hr] */
-    const double tInitial_s  = tInitial_h * 3600.0;                  /* [s] */
-    const double tFinal_s    = tFinal_h   * 3600.0;                  /* [s] */
+    std::unique_ptr<SZA> sun = std::make_unique<SZA>(input.latitude_deg(), input.emissionDOY() );
 
-    /* Current time in [s] */
-    double curr_Time_s = tInitial_s; /* [s] */
-    /* Time step in [s] */
-    double dt = 0;                   /* [s] */
+    for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
+        NOON_JRATES[iPhotol] = 0.0E+00;
 
-    /* Create time array */
+    ReadJRates( simVars.JRATE_FOLDER.c_str(),  \
+        input.emissionMonth(), \
+        input.emissionDay(),   \
+        input.longitude_deg(), \
+        input.latitude_deg(),  \
+        simVars.pressure_Pa/100.0,     \
+        NOON_JRATES );
 
-    /* Vector of time in [s] */
-    const Vector_1D timeArray = BuildTime ( tInitial_s, tFinal_s, 3600.0*sun->sunRise, 3600.0*sun->sunSet, DYN_DT );
+    /* ======================================================================= */
+    /* ----------------------------------------------------------------------- */
+    /* ------------------------------ TIMESTEPS ------------------------------ */
+    /* ----------------------------------------------------------------------- */
+    /* ======================================================================= */
 
-    /* Time counter [-] */
-    UInt nTime = 0;
+    /* Without transport, the box only steps at the chemistry timestep */
+    TimestepVarsWrapper timestepVars(input, Input_Opt);
+    const double boxDT = ( timestepVars.CHEMISTRY_DT > 0.0E+00 ) ? timestepVars.CHEMISTRY_DT : timestepVars.dt;
+    timestepVars.setTimeArray(PlumeModelUtils::BuildTime ( timestepVars.tInitial_s, timestepVars.tFinal_s, 3600.0*sun->sunRise, 3600.0*sun->sunSet, boxDT ));
 
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
     /* ------------------------ BACKGROUND CONDITIONS ------------------------ */
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
-    
-    /* Declare solution structure */
-    Solution Data(Input_Opt);
 
-    /* Compute airDens from pressure and temperature */
-    double airDens = pressure_Pa / ( physConst::kB   * temperature_K ) * 1.00E-06;
-    /* [molec/cm3] = [Pa = J/m3] / ([J/K]            * [K]           ) * [m3/cm3] */
-   
-    /* Read ambient concentrations */
-    Vector_1D amb_Value(NSPEC, 0.0);
-    Vector_2D aer_Value(N_AER, Vector_1D(2, 0.0));
-    std::ifstream file;
-
-    file.open( BACKG_FILENAME );
-
-    if ( file.is_open() ) {
-        std::string line;
-        UInt i = 0;
-
-        while ( ( std::getline( file, line ) ) && ( i < NSPEC + N_AER ) ) {
-            if ( ( line.length() > 0 ) && ( line != "\r" ) && ( line != "\n" ) && ( line[0] != '#' ) ) {
-                std::istringstream iss(line);
-                if ( i < NSPEC ) {
-                    iss >> amb_Value[i];
-                }
-                else if ( ( i >= NSPEC ) && ( i < NSPEC + N_AER ) ) {
-                    iss >> aer_Value[i - NSPEC][0];
-                    std::getline( file, line );
-                    std::istringstream iss(line);
-                    iss >> aer_Value[i - NSPEC][1];
-                }
-                i++;
-            }
-        }
-        file.close();
-    }
-    else {
-        std::cout << "ERROR: Can't read (" << BACKG_FILENAME << ")" << std::endl;
-        exit(-1);
-    }
-
-    Data.SpinUp( amb_Value, input, airDens, \
-            /* Time for which ambient file is valid in hr */ (const double) 8.0 );
-
-    /* Enforce pre-defined values? *
-     * Read input defined values for background concentrations */
+    AmbientMetParams ambMetParams;
+    ambMetParams.solarTime_h = timestepVars.curr_Time_s / 3600.0;
+    ambMetParams.rhi = simVars.relHumidity_i;
+    ambMetParams.temp_K = simVars.temperature_K;
+    ambMetParams.press_Pa = simVars.pressure_Pa;
+    ambMetParams.shear = input.shear();
 
-    /* Split NOx as NO and NO2 using the current NO/NO2 ratio */
+    Meteorology Met( Input_Opt, ambMetParams, m.y(), m.yE());
 
-    /* Inputs are in ppb */
-
-    if ( input.backgNOx() > 0.0E+00 ) {
-        const double NONO2rat = amb_Value[ind_NO]/amb_Value[ind_NO2];
-        /* NOx = NO + NO2 = NO2 * ( r + 1 ) 
-         * NO2 = NOx / ( r + 1 );
-         * NO  = NOx - NO2; */
-        amb_Value[ind_NO2] = input.backgNOx() / ( NONO2rat + 1 );
-        amb_Value[ind_NO]  = input.backgNOx() - amb_Value[ind_NO2];
-
-        /* Convert to mixing ratio */
-        amb_Value[ind_NO2] /= 1.0E+09;
-        amb_Value[ind_NO]  /= 1.0E+09;
+    if ( Input_Opt.MET_LOADMET && Input_Opt.MET_LOADTEMP ) {
+        simVars.temperature_K = Met.tempRef();
     }
-
-    if ( input.backgHNO3() > 0.0E+00 ) {
-        /* Convert from ppb to mixing ratio */
-        amb_Value[ind_HNO3] = input.backgHNO3() / 1.0E+09;
-    }
-        
-    if ( input.backgO3() > 0.0E+00 ) {
-        /* Convert from ppb to mixing ratio */
-        amb_Value[ind_O3] = input.backgO3() / 1.0E+09;
-    }
-
-    if ( input.backgCO() > 0.0E+00 ) {
-        /* Convert from ppb to mixing ratio */
-        amb_Value[ind_CO] = input.backgCO() / 1.0E+09;
+    if ( Input_Opt.MET_LOADMET && Input_Opt.MET_LOADRH ) {
+        simVars.relHumidity_w = Met.rhwRef();
+        simVars.relHumidity_i = simVars.relHumidity_w * physFunc::pSat_H2Ol( simVars.temperature_K )\
+                                      / physFunc::pSat_H2Os( simVars.temperature_K );
     }
 
-    if ( input.backgCH4() > 0.0E+00 ) {
-        /* Convert from ppb to mixing ratio */
-        amb_Value[ind_CH4] = input.backgCH4() / 1.0E+09;
-    }
-    
-    if ( input.backgSO2() > 0.0E+00 ) {
-        /* Convert from ppb to mixing ratio */
-        amb_Value[ind_SO2] = input.backgSO2() / 1.0E+09;
+    /* Compute airDens from pressure and temperature */
+    const double airDens = simVars.pressure_Pa / ( physConst::kB   * simVars.temperature_K ) * 1.00E-06;
+    /*     [molec/cm3] = [Pa = J/m3] / ([J/K]            * [K]           ) * [m3/cm3] */
+
+    /* The box starts from the ambient state at the center of the domain */
+    const UInt i_0 = std::floor( xE[0]/(xE[0]-xE[1]) ); //index i where x = 0
+    const UInt j_0 = std::floor( yE[0]/(yE[0]-yE[1]) ); //index j where y = 0
+    const AmbientState ambient( simVars.BACKG_FILENAME.c_str(), input, airDens, Met, \
+                                Input_Opt, i_0, j_0, printDEBUG );
+    ambient.getData( VAR, FIX );
+    ambient.getData( ambientKPP.VAR(), ambientKPP.FIX() );
+
+    /* Background liquid aerosols are the only aerosols in the box. Without
+     * microphysics they do not evolve */
+    double AerosolArea[NAERO] = { 0.0E+00 };
+    double AerosolRadi[NAERO] = { 1.0E-10, 1.0E-10, 1.0E-07, 1.0E-10 };
+    const Vector_1D &liquidAer = ambient.aerosol()[2];
+    if ( liquidAer[0] > 0.0E+00 ) {
+        AerosolArea[1] = liquidAer[2] * 1.00E-12; /* [\mum^2/cm^3] -> [m^2/cm^3] */
+        AerosolRadi[1] = std::max( std::min( liquidAer[1] * 1.00E-09, 1.00E-06 ), 1.00E-10 );
     }
 
-    for ( UInt iSpec = 0; iSpec < amb_Value.size(); iSpec++ )
-        amb_Value[iSpec] *= airDens;
-
-    amb_Value[ind_H2O] = input.relHumidity_w() / ((double) 100.0) * \
-                         physFunc::pSat_H2Ol( input.temperature_K() ) / ( physConst::kB * input.temperature_K() ) / 1.00E+06;
-
-    /* Create ambient struture */
-    Ambient ambientData( timeArray.size(), amb_Value, aer_Value, Vector_1D( 9, 0.0E+00 ) );
-
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
     /* ----------------------------- EMISSIONS ------------------------------- */
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
-    /* Emission
-     * The emissions is a combination of 
-     * engine-fuel characteristics.
-     * - CO2, H2O and FSC are fuel characteristics
-     * - NOx, CO, HC and Soot are engine dependent.
-     * An aircraft is paired with its engine.
-     */
-
     /* Define fuel */
     char const *ChemFormula("C12H24");
     Fuel JetA( ChemFormula );
 
     /* Define aircraft */
-    char const *aircraftName("B747-800");
-    double aircraftMass = input.aircraftMass();
-    std::string engineInputFile = Input_Opt.SIMULATION_INPUT_ENG_EI;
-    Aircraft aircraft( aircraftName, engineInputFile, aircraftMass, \
-                       temperature_K, pressure_Pa, \
-                       relHumidity_w, input.nBV() );
-
-    if ( BUILD_LUT ) {
-        aircraft.setEI_NOx( input.EI_NOx() );
-        aircraft.setEI_CO( input.EI_CO() );
-        aircraft.setEI_HC( input.EI_HC() );
-        aircraft.setEI_Soot( input.EI_Soot() );
-        aircraft.setSootRad( input.sootRad() );
-        aircraft.setFuelFlow( input.fuelFlow() );
-        JetA.setFSC( input.EI_SO2() * (double) 500.0 );
-    }
+    std::string engineInputFilePath = Input_Opt.SIMULATION_INPUT_ENG_EI;
+    Aircraft aircraft = Aircraft(input, engineInputFilePath);
 
-    /* Print AC Debug? */
-    if ( DEBUG_AC_INPUT )
-        aircraft.Debug();
+    /* Multiply by 500 since it gets multiplied by 1/500
+    * within the Emission object ... */
+    JetA.setFSC( input.EI_SO2() * (double) 500.0 );
 
     /* Aggregate emissions from engine and fuel characteristics */
     const Emission EI( aircraft.engine(), JetA );
 
-    /* Print Emission Debug? */
-    if ( DEBUG_EI_INPUT )
-        EI.Debug();
-
-    /* Add emissions */
-    double E_CO2, E_H2O, E_NO, E_NO2, E_HNO2, E_SO2, E_CO, E_CH4, E_C2H6, E_PRPE, E_ALK4, E_CH2O, E_ALD2, E_GLYX, E_MGLY;
-    double E_Soot;
-    const double rad = EI.getSootRad();
+    /* The box starts as the inner ring of the plume model, with the default
+     * ring size of Cluster, and spreads until it covers the domain */
+    const Cluster ringCluster( NRING, 0 );
+    BoxPlume plume;
+    plume.sigmaX    = ringCluster.getRings()[0].getHAxis();
+    plume.sigmaY    = ringCluster.getRings()[0].getVAxis();
+    plume.horizDiff = input.horizDiff();
+    plume.vertiDiff = input.vertiDiff();
+    plume.maxArea   = domainArea;
+
+    /* Emissions per meter of flight path, released into the initial box */
     const double fuelPerDist = aircraft.FuelFlow() / aircraft.VFlight();
-    /* Unit check:  [kg/m]   =   [kg fuel/s]    /     [m/s] */
-    E_CO2  = EI.getCO2()  / ( MW_CO2  * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    /*     = [g/kg fuel]  / ( [kg/mol]* [g/kg]  ) * [kg fuel/m] * [molec/mol]   / [m^2]    * [m^3/cm^3]
-     *     = [molec/cm^3]
-     */
-    E_NO   = EI.getNO()   / ( MW_NO   * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_NO2  = EI.getNO2()  / ( MW_NO2  * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_HNO2 = EI.getHNO2() / ( MW_HNO2 * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_CO   = EI.getCO()   / ( MW_CO   * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_CH4  = EI.getCH4()  / ( MW_CH4  * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_C2H6 = EI.getC2H6() / ( MW_C2H6 * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_PRPE = EI.getPRPE() / ( MW_PRPE * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_ALK4 = EI.getALK4() / ( MW_ALK4 * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_CH2O = EI.getCH2O() / ( MW_CH2O * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_ALD2 = EI.getALD2() / ( MW_ALD2 * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_GLYX = EI.getGLYX() / ( MW_GLYX * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_MGLY = EI.getMGLY() / ( MW_MGLY * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_H2O  = EI.getH2O()  / ( MW_H2O  * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-    E_SO2  = ( 1.0 - SO2TOSO4 ) * \
-             EI.getSO2()  / ( MW_SO2  * 1.0E+03 ) * fuelPerDist * physConst::Na / BOX_AREA * 1.0E-06;
-
-    E_Soot = EI.getSoot() / ( 4.0 / 3.0 * physConst::PI * physConst::RHO_SOOT * 1.00E+03 * rad * rad * rad ) * fuelPerDist / BOX_AREA * 1.0E-06;
-    /*     = [g_soot/kg_fuel]/ (                        * [kg_soot/m^3]       * [g/kg]   * [m^3]           ) * [kg_fuel/m] / [m^2] * [m^3/cm^3]
-     *     = [part/cm^3]
-     */
-
-    ambientData.Species[ind_CO2][0]      += E_CO2;
-    ambientData.Species[ind_NO][0]       += E_NO;
-    ambientData.Species[ind_NO2][0]      += E_NO2;
-    ambientData.Species[ind_HNO2][0]     += E_HNO2;
-    ambientData.Species[ind_CO][0]       += E_CO;
-    ambientData.Species[ind_CH4][0]      += E_CH4;
-    ambientData.Species[ind_C2H6][0]     += E_C2H6;
-    ambientData.Species[ind_PRPE][0]     += E_PRPE;
-    ambientData.Species[ind_ALK4][0]     += E_ALK4;
-    ambientData.Species[ind_CH2O][0]     += E_CH2O;
-    ambientData.Species[ind_ALD2][0]     += E_ALD2;
-    ambientData.Species[ind_GLYX][0]     += E_GLYX;
-    ambientData.Species[ind_MGLY][0]     += E_MGLY;
-    ambientData.Species[ind_H2O][0]      += E_H2O;
-    ambientData.Species[ind_SO2][0]      += E_SO2;
-    ambientData.sootDens[0] += E_Soot;
-
-    
+    const double EtoBox = fuelPerDist * physConst::Na / plume.area( 0.0E+00 ) * 1.0E-06;
+    /* Unit check: [kg fuel/m] * [molec/mol] / [m^2] * [m^3/cm^3]
+     * multiplied by [g/kg fuel] / [g/mol] gives [molec/cm^3] */
+
+    VAR[ind_CO2]  += EI.getCO2()  / ( MW_CO2  * 1.0E+03 ) * EtoBox;
+    VAR[ind_NO]   += EI.getNO()   / ( MW_NO   * 1.0E+03 ) * EtoBox;
+    VAR[ind_NO2]  += EI.getNO2()  / ( MW_NO2  * 1.0E+03 ) * EtoBox;
+    VAR[ind_HNO2] += EI.getHNO2() / ( MW_HNO2 * 1.0E+03 ) * EtoBox;
+    VAR[ind_CO]   += EI.getCO()   / ( MW_CO   * 1.0E+03 ) * EtoBox;
+    VAR[ind_CH4]  += EI.getCH4()  / ( MW_CH4  * 1.0E+03 ) * EtoBox;
+    VAR[ind_C2H6] += EI.getC2H6() / ( MW_C2H6 * 1.0E+03 ) * EtoBox;
+    VAR[ind_PRPE] += EI.getPRPE() / ( MW_PRPE * 1.0E+03 ) * EtoBox;
+    VAR[ind_ALK4] += EI.getALK4() / ( MW_ALK4 * 1.0E+03 ) * EtoBox;
+    VAR[ind_CH2O] += EI.getCH2O() / ( MW_CH2O * 1.0E+03 ) * EtoBox;
+    VAR[ind_ALD2] += EI.getALD2() / ( MW_ALD2 * 1.0E+03 ) * EtoBox;
+    VAR[ind_GLYX] += EI.getGLYX() / ( MW_GLYX * 1.0E+03 ) * EtoBox;
+    VAR[ind_MGLY] += EI.getMGLY() / ( MW_MGLY * 1.0E+03 ) * EtoBox;
+    VAR[ind_H2O]  += EI.getH2O()  / ( MW_H2O  * 1.0E+03 ) * EtoBox;
+    VAR[ind_SO2]  += ( 1.0 - SO2TOSO4 ) * \
+                     EI.getSO2()  / ( MW_SO2  * 1.0E+03 ) * EtoBox;
+
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
     /* ----------------------------- CHEMISTRY ------------------------------- */
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
-    /* Allocate arrays for KPP */
-
-    double STEPMIN = (double)0.0;
-
     double RTOL[NVAR];
     double ATOL[NVAR];
 
-    /* Allocate photolysis rate array */
-    double jRate[NPHOTOL];
-
     for( UInt i = 0; i < NVAR; i++ ) {
-        RTOL[i] = KPP_RTOLS; 
-        ATOL[i] = KPP_ATOLS; 
+        RTOL[i] = KPP_RTOLS;
+        ATOL[i] = KPP_ATOLS;
     }
 
-    /* aerArray stores all the number concentrations of aerosols */
-    double aerArray[N_AER][2];
+    /* Photolysis, heterogeneous and thermal rates of the box and of the
+     * ambient air, each from its own concentrations */
+    auto setRates = [&] ( KppContext &ctx, const double tCurr, const double dt ) {
 
-    /* Ambient chemistry */
-    ambientData.getData( aerArray, nTime );
-
-    
-    /* ======================================================================= */
-    /* ----------------------------------------------------------------------- */
-    /* ------------------------ TIME LOOP STARTS HERE ------------------------ */
-    /* ----------------------------------------------------------------------- */
-    /* ======================================================================= */
-
-    while ( curr_Time_s < tFinal_s ) {
-        if ( printDEBUG ) {
-            /* Print message */
-            std::cout << "\n";
-            std::cout << "\n - Time step: " << nTime + 1 << " out of " << timeArray.size();
-            #ifdef OMP
-                std::cout << " (thread: " << omp_get_thread_num() << ")";
-            #endif /* OMP */
-            std::cout << "\n -> Solar time: " << std::fmod( curr_Time_s/3600.0, 24.0 ) << " [hr]" << std::endl;
-        }
-
-        /* ======================================================================= */
-        /* ----------------------------------------------------------------------- */
-        /* --------------------------- UPDATE TIMESTEP --------------------------- */
-        /* ----------------------------------------------------------------------- */
-        /* ======================================================================= */
-
-        /* Compute time step */
-        dt = timeArray[nTime+1] - timeArray[nTime];
-
-        /* ======================================================================= */
-        /* ----------------------------------------------------------------------- */
-        /* ----------- UPDATE SOLAR ZENITH ANGLE AND PHOTOLYSIS RATES ------------ */
-        /* ----------------------------------------------------------------------- */
-        /* ======================================================================= */
-
-        /* Compute the cosize of solar zenith angle midway through the integration step */
-        sun->Update( curr_Time_s + dt/2 );
-
-        /* Store cosine of solar zenith angle */
-        ambientData.cosSZA[nTime] = sun->CSZA;
-
-        if ( printDEBUG ) {
-            std::cout << "\n DEBUG : \n";
-            std::cout << "         CSZA = " << sun->CSZA << "\n";
-        }
+        /* Compute the cosine of solar zenith angle midway through the integration step */
+        sun->Update( tCurr + dt/2 );
 
         /* Reset photolysis rates */
         for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
@@ -456,99 +315,54 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
         if ( sun->CSZA > 0.0E+00 )
             Update_JRates( jRate, sun->CSZA );
 
-        if ( printDEBUG ) {
-            std::cout << "\n DEBUG : \n";
-            for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                std::cout << "         PHOTOL[" << iPhotol << "] = " << jRate[iPhotol] << "\n";
-        }
-
-
-        /* ======================================================================= */
-        /* ----------------------------------------------------------------------- */
-        /* ------------------------------- RUN KPP ------------------------------- */
-        /* ------------------------ The Kinetics Pre-Processor ------------------- */
-        /* ----------------------------------------------------------------------- */
-        /* ======================================================================= */
+        /* Update heterogeneous chemistry reaction rates */
+        if ( simVars.HETCHEM ) {
 
-        /* Ambient chemistry */
-        ambientData.getData( aerArray, nTime );
+            for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
+                ctx.HET[iSpec][0] = 0.0E+00;
+                ctx.HET[iSpec][1] = 0.0E+00;
+                ctx.HET[iSpec][2] = 0.0E+00;
+            }
 
-        /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
-        /* ~~~~ Chemical rates ~~~~ */
-        /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
+            const double relHumidity = ctx.VAR()[ind_H2O] * \
+                                       physConst::kB * simVars.temperature_K * 1.00E+06 / \
+                                       physFunc::pSat_H2Ol( simVars.temperature_K );
+            GC_SETHET( ctx, simVars.temperature_K, simVars.pressure_Pa, airDens, relHumidity, \
+                       ambient.STATE_PSC(), ctx.VAR(), AerosolArea, AerosolRadi, 0.0E+00, \
+                       &(ambient.KHETI_SLA()[0]), Input_Opt.ADV_TROPOPAUSE_PRESSURE );
+        }
 
         /* Zero-out reaction rate */
         for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-            RCONST[iReact] = 0.0E+00;
+            ctx.RCONST[iReact] = 0.0E+00;
 
         /* Update photolysis rates */
         for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-            PHOTOL[iPhotol] = jRate[iPhotol];
+            ctx.PHOTOL[iPhotol] = jRate[iPhotol];
 
         /* Update reaction rates */
-        Update_RCONST( temperature_K, pressure_Pa, airDens, VAR[ind_H2O] );
+        Update_RCONST( ctx, simVars.temperature_K, simVars.pressure_Pa, airDens, ctx.VAR()[ind_H2O] );
 
-        /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
-        /* ~~~~~ Integration ~~~~~~ */
-        /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
+    };
 
-        IERR = INTEGRATE( VAR, curr_Time_s, curr_Time_s + dt, \
-                          ATOL, RTOL, STEPMIN );
+    const Vector_1D &timeArray = timestepVars.timeArray;
 
-        if ( IERR < 0 ) {
-            /* Integration failed */
-
-                std::cout << "Integration failed";
-                #ifdef OMP
-                    std::cout << " on " << omp_get_thread_num();
-                #endif /* OMP */
-                std::cout << " for ambient conditions at time t = " << curr_Time_s/3600.0 << " ( nTime = " << nTime << " )\n";
-
-            if ( printDEBUG ) {
-                std::cout << " ~~~ Printing reaction rates:\n";
-                for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                    std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
-                }
-                std::cout << " ~~~ Printing concentrations:\n";
-                for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                    std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
-                }
-            }
+    /* Concentrations of the variable species at each time [molec/cm^3] */
+    Vector_2D boxSpecies( NVAR, Vector_1D( timeArray.size(), 0.0E+00 ) );
 
-            /* Clear dynamically allocated variable(s) */
-            if ( sun != NULL )
-                sun->~SZA();
-            return KPP_FAIL;
-        }
-
-        ambientData.FillIn( nTime + 1 );
-        
-        curr_Time_s += dt;
-        nTime++;
-    }
+    if ( BoxIntegrate( boxKPP, ambientKPP, plume, timeArray, setRates, \
+                       ATOL, RTOL, boxSpecies ) < 0 )
+        return SimStatus::Failed;
 
-    /* ======================================================================= */
-    /* ----------------------------------------------------------------------- */
-    /* ------------------------- TIME LOOP ENDS HERE ------------------------- */
-    /* ----------------------------------------------------------------------- */
-    /* ======================================================================= */
+    OutputWriter::Get().Run( [&] () {
+        Diag::Diag_Box( input.fileName_BOX2char(), timeArray, boxSpecies, airDens );
+    } );
 
-    
-    #pragma omp critical
-    {
-        isSaved_Box = output::Write_Box( input.fileName_BOX2char(), \
-                                         TS_SPEC_LIST,              \
-                                         ambientData,               \
-                                         timeArray,                 \
-                                         input,                     \
-                                         airDens, relHumidity_i );
-    }
-    if ( isSaved_Box == output::SAVE_FAILURE ) {
-        std::cout << " Saving to ring-averaged concentrations to file failed...\n";
-        return SAVE_FAIL;
-    }
+    auto stop = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop-start);
+    std::cout << "APCEMM Box Model Run Finished! Run time: " << duration.count() << "ms" << std::endl;
 
-    return SUCCESS;
+    return SimStatus::Complete;
 
 } /* End of BoxModel */
 
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <stdexcept>
+#include "Core/ChemCluster.hpp"
+#include "Core/Parameters.hpp"
+#include "KPP/KPP.hpp"
+
+ChemCluster::ChemCluster( const double relTol_, const Vector_1D &floor_ ):
+    relTol( relTol_ ),
+    logWidth( std::log1p( relTol_ ) ),
+    floor( floor_ ),
+    maxSpread( 0.0E+00 )
+{
+
+    if ( relTol <= 0.0E+00 )
+        throw std::invalid_argument("Chemistry clustering tolerance must be positive!");
+
+} /* End of ChemCluster::ChemCluster */
+
+long ChemCluster::Bin( const double x, const UInt iComp ) const
+{
+
+    if ( x <= floor[iComp] )
+        return LONG_MIN;
+    return (long) std::floor( std::log( x ) / logWidth );
+
+} /* End of ChemCluster::Bin */
+
+UInt ChemCluster::Add( const Vector_1D &state )
+{
+
+    if ( state.size() != floor.size() )
+        throw std::invalid_argument("Cell state does not match the size of the clustering floor!");
+
+    std::vector<long> key( state.size() );
+    for ( UInt i = 0; i < state.size(); i++ )
+        key[i] = Bin( state[i], i );
+
+    auto it = bins.find( key );
+    if ( it == bins.end() ) {
+        const UInt iCluster = representatives.size();
+        bins.emplace( std::move( key ), iCluster );
+        representatives.push_back( clusterIndex.size() );
+        repStates.push_back( state );
+        clusterIndex.push_back( iCluster );
+        return iCluster;
+    }
+
+    const UInt iCluster = it->second;
+    const Vector_1D &rep = repStates[iCluster];
+    for ( UInt i = 0; i < state.size(); i++ ) {
+        if ( key[i] != LONG_MIN )
+            maxSpread = std::max( maxSpread, std::abs( state[i] - rep[i] ) / rep[i] );
+    }
+    clusterIndex.push_back( iCluster );
+    return iCluster;
+
+} /* End of ChemCluster::Add */
+
+ChemCluster IntegrateClustered( const UInt nCell, const double relTol, const double concFloor, \
+                                const std::function<void( KppContext&, UInt )> &setupCell,    \
+                                const std::function<void( UInt, const double[] )> &applyCell,  \
+                                const std::function<void( const KppContext&, UInt )> &failedCell, \
+                                double TIN, double TOUT, double ATOL[], double RTOL[], double STEPMIN )
+{
+
+    Vector_1D clusterFloor( NSPEC + NREACT, 0.0E+00 );
+    std::fill( clusterFloor.begin(), clusterFloor.begin() + NSPEC, concFloor );
+    ChemCluster chemCluster( relTol, clusterFloor );
+
+    /* Cells are set up in parallel, a block at a time, and added in order.
+     * The representatives keep their whole state for the integration, the
+     * other cells only their concentrations */
+    const UInt SETUP_BLOCK = 1024;
+    std::vector<KppContext> blockKPP( std::min( nCell, SETUP_BLOCK ) );
+    std::vector<KppContext> repKPP;
+    std::vector<double> cellVAR( (std::size_t) nCell * NVAR );
+    Vector_1D cellState( NSPEC + NREACT );
+
+    for ( UInt first = 0; first < nCell; first += SETUP_BLOCK ) {
+        const int nBlock = std::min( SETUP_BLOCK, nCell - first );
+
+        #pragma omp parallel for             \
+        if      ( !PARALLEL_CASES         ) \
+        default ( shared                   ) \
+        schedule( dynamic, 1               )
+        for ( int iBlock = 0; iBlock < nBlock; iBlock++ ) {
+            blockKPP[iBlock] = KppContext();
+            setupCell( blockKPP[iBlock], first + iBlock );
+        }
+
+        for ( int iBlock = 0; iBlock < nBlock; iBlock++ ) {
+            const KppContext &cellKPP = blockKPP[iBlock];
+            std::copy( cellKPP.C, cellKPP.C + NSPEC, cellState.begin() );
+            std::copy( cellKPP.RCONST, cellKPP.RCONST + NREACT, cellState.begin() + NSPEC );
+            std::copy( cellKPP.C, cellKPP.C + NVAR, cellVAR.begin() + (std::size_t) ( first + iBlock ) * NVAR );
+            if ( chemCluster.Add( cellState ) == repKPP.size() )
+                repKPP.push_back( cellKPP );
+        }
+    }
+
+    const UInt nCluster = chemCluster.getnCluster();
+    const std::vector<UInt> &repCell = chemCluster.getRepresentatives();
+    const std::vector<UInt> &cellCluster = chemCluster.getClusterIndex();
+    std::vector<int> repIERR( nCluster );
+
+    /* Integrate the representatives, KPP_BATCH at a time */
+    const int nChunk = ( nCluster + KPP_BATCH - 1 ) / KPP_BATCH;
+    #pragma omp parallel for             \
+    if      ( !PARALLEL_CASES         ) \
+    default ( shared                   ) \
+    schedule( dynamic, 1               )
+    for ( int iChunk = 0; iChunk < nChunk; iChunk++ ) {
+        const UInt first = iChunk * KPP_BATCH;
+        const int nRep = std::min<UInt>( KPP_BATCH, nCluster - first );
+        KppContext *repPtr[KPP_BATCH];
+        for ( int iRep = 0; iRep < nRep; iRep++ )
+            repPtr[iRep] = &repKPP[first+iRep];
+        INTEGRATE_BATCH( repPtr, &repIERR[first], nRep, TIN, TOUT, ATOL, RTOL, STEPMIN );
+    }
+
+    /* Apply the increments to every cell */
+    #pragma omp parallel for             \
+    if      ( !PARALLEL_CASES         ) \
+    default ( shared                   ) \
+    schedule( dynamic, 64              )
+    for ( int iCell = 0; iCell < (int) nCell; iCell++ ) {
+        const UInt iCluster = cellCluster[iCell];
+        KppContext &rep = repKPP[iCluster];
+
+        if ( repIERR[iCluster] < 0 ) {
+            if ( repCell[iCluster] == (UInt) iCell ) {
+                failedCell( rep, iCell );
+                applyCell( iCell, rep.VAR() );
+            } else {
+                KppContext cellKPP;
+                setupCell( cellKPP, iCell );
+                if ( INTEGRATE( cellKPP, TIN, TOUT, ATOL, RTOL, STEPMIN ) < 0 )
+                    failedCell( cellKPP, iCell );
+                applyCell( iCell, cellKPP.VAR() );
+            }
+            continue;
+        }
+
+        const double *VAR0 = &cellVAR[(std::size_t) iCell * NVAR];
+        const double *repVAR0 = &cellVAR[(std::size_t) repCell[iCluster] * NVAR];
+        double VAR[NVAR];
+        for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ )
+            VAR[iSpec] = std::max( VAR0[iSpec] + rep.C[iSpec] - repVAR0[iSpec], 0.0E+00 );
+        applyCell( iCell, VAR );
+    }
+
+    return chemCluster;
+
+} /* End of IntegrateClustered */
+
+/* End of ChemCluster.cpp */
@@ -11,7 +11,12 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include "Core/Diag_Mod.hpp"
+#include "LAGRID/FixedGridResampler.hpp"
 namespace Diag {
 
     static const NcType& varDataType = ncFloat;
@@ -268,20 +273,295 @@ namespace Diag {
         delete[] array;
     }
 
+    bool TSOutputOptions::wants( const string& key ) const
+    {
+        return vars.empty() || std::find( vars.begin(), vars.end(), key ) != vars.end();
+    }
+
+    int TSOutputOptions::digits( const string& key ) const
+    {
+        auto it = sigDigits.find( key );
+        if ( it == sigDigits.end() )
+            it = sigDigits.find( "all" );
+        return it == sigDigits.end() ? 0 : it->second;
+    }
+
+    void TSOutputOptions::compress( NcVar& var ) const
+    {
+        if ( deflate > 0 )
+            var.setCompression( true, true, deflate );
+    }
+
+    void GroomFloats( float* array, const size_t n, const int digits )
+    {
+        /* Explicit mantissa bits needed to keep the requested number of
+         * significant decimal digits (Zender, GMD 2016) */
+        static const int MANTISSA_BITS = 23;
+        if ( digits <= 0 )
+            return;
+        const int keepBits = std::ceil( digits * std::log2( 10.0 ) ) + 1;
+        if ( keepBits >= MANTISSA_BITS )
+            return;
+
+        const std::uint32_t shaveMask = ~( ( std::uint32_t(1) << ( MANTISSA_BITS - keepBits ) ) - 1 );
+        const std::uint32_t setMask = ~shaveMask;
+        for ( size_t i = 0; i < n; i++ ) {
+            if ( !std::isfinite( array[i] ) || array[i] == 0.0f )
+                continue;
+            std::uint32_t bits;
+            std::memcpy( &bits, &array[i], sizeof( bits ) );
+            /* Alternately shave and set the discarded bits so that errors cancel on average */
+            bits = ( i % 2 == 0 ) ? ( bits & shaveMask ) : ( bits | setMask );
+            std::memcpy( &array[i], &bits, sizeof( bits ) );
+        }
+    }
+
+    namespace {
+
+        enum class TSDim { X, Y, R };
+
+        /* Receives the Diag_TS_Phys fields, so that the list of fields is
+         * shared by the per-save files and the single time-series file.
+         * Each field is identified by a short key from TS_AERO_VARS. */
+        class TSPhysSink {
+            public:
+                TSPhysSink( const TSOutputOptions& options ): options_( options ) {}
+                virtual ~TSPhysSink() = default;
+                bool wants( const string& key ) const { return options_.wants( key ); }
+                virtual void put0D( const string& key, const float toSave, const string& name, const string& desc, const string& units ) = 0;
+                virtual void put1D( const string& key, const Vector_1D& toSave, const TSDim dim, const string& name, const string& desc, const string& units ) = 0;
+                virtual void put2D( const string& key, const Vector_2D& toSave, const string& name, const string& desc, const string& units ) = 0;
+
+            protected:
+                const TSOutputOptions& options_;
+        };
+
+        void writeTSPhysFields( TSPhysSink& sink,
+                                const AIM::Grid_Aerosol& iceAer, const Vector_2D& H2O,
+                                const Vector_1D& xCoord, const Vector_1D& yCoord,
+                                const Vector_1D& xEdges, const Vector_1D& yEdges,
+                                const TSMetFields &met )
+        {
+            long unsigned int ny = yCoord.size();
+
+            Vector_2D areas = VectorUtils::cellAreas(xEdges, yEdges);
+            Vector_1D dx_vec = VectorUtils::cellWidths(xEdges);
+            Vector_1D dy_vec(ny, yCoord[1] - yCoord[0]);
+
+            /* Output met */
+
+            /* Check if evolving met. If not only save met in one file */
+
+            /* Saving meteorological pressure */
+            if ( sink.wants("Pressure") )
+                sink.put1D("Pressure", met.pressure, TSDim::Y, "Pressure", "Pressure", "Pa");
+
+            //Save Altitude
+            if ( sink.wants("Altitude") )
+                sink.put1D("Altitude", met.altitude, TSDim::Y, "Altitude", "Altitude", "m");
+
+            /* Saving H2O gaseous concentration */
+            if ( sink.wants("H2O") )
+                sink.put2D("H2O", H2O, "H2O", "H2O molecular concentration", "molec / cm^3");
+
+            /* Saving meteorological temperature */
+            if ( sink.wants("Temperature") )
+                sink.put2D("Temperature", met.temperature, "Temperature", "Temperature", "K");
+
+            /* Saving ice aerosol particle number */
+            if ( sink.wants("IceNumber") )
+                sink.put2D("IceNumber", iceAer.TotalNumber(), "Ice aerosol particle number", "Ice aerosol particle number concentration", "# / cm^3");
+
+            // /* Saving ice aerosol surface area 
+            if ( sink.wants("IceArea") )
+                sink.put2D("IceArea", iceAer.TotalArea(), "Ice aerosol surface area", "Ice aerosol surface area", "m^2 / cm^3");
+
+            /* Saving ice aerosol volume */
+            if ( sink.wants("IceVolume") )
+                sink.put2D("IceVolume", iceAer.TotalVolume(), "Ice aerosol volume", "Ice aerosol volume", "m^3 / cm^3");
+
+            /* Saving ice aerosol effective radius */
+            if ( sink.wants("EffRadius") )
+                sink.put2D("EffRadius", iceAer.EffRadius(), "Effective radius", "Ice aerosol effective radius", "m");
+
+            /* Saving horizontal optical depth */
+            if ( sink.wants("xOD") )
+                sink.put1D("xOD", iceAer.xOD(dx_vec), TSDim::Y, "Horizontal optical depth", "Horizontally-integrated optical depth", "-");
+
+            /* Saving vertical optical depth */
+            if ( sink.wants("yOD") )
+                sink.put1D("yOD", iceAer.yOD(dy_vec), TSDim::X, "Vertical optical depth", "Vertically-integrated optical depth", "-");
+
+            /* Saving overall size distribution */ 
+            if ( sink.wants("SizeDist") )
+                sink.put1D("SizeDist", iceAer.Overall_Size_Dist(areas), TSDim::R, "Overall size distribution", "Overall size distribution of ice particles", "part / m");
+
+            /* Saving Total Ice Mass [kg/m] */
+            if ( sink.wants("IceMass") )
+                sink.put0D("IceMass", iceAer.TotalIceMass_sum(areas), "Ice Mass", "Total Mass of Ice Crystals of Cross Section", "kg / m");
+
+            /* Saving Num Ice Particles [#/m] */
+            if ( sink.wants("IceParticles") )
+                sink.put0D("IceParticles", iceAer.TotalNumber_sum(areas), "Number Ice Particles", "Total Number of Ice Particles of Cross Section", "# / m");
+
+            /* Saving Extinction [-/m]*/
+            if ( sink.wants("Extinction") )
+                sink.put2D("Extinction", iceAer.Extinction(), "Extinction", "Extinction", "m^-1");
+
+            /* Saving IWC */
+            if ( sink.wants("IWC") )
+                sink.put2D("IWC", iceAer.IWC(), "IWC", "Ice Water Content", "kg / m^3");
+
+            /* Saving RHi */
+            if ( sink.wants("RHi") )
+                sink.put2D("RHi", physFunc::RHi_Field(H2O, met.temperature, met.pressure), "RHi", "Relative Humidity w.r.t. Ice", "%");
+
+            //Contrail width, depth, and integrated OD
+            if ( sink.wants("width") )
+                sink.put0D("width", iceAer.extinctionWidth(xCoord), "width", "Contrail Extinction-Defined Width", "m");
+            if ( sink.wants("depth") )
+                sink.put0D("depth", iceAer.extinctionDepth(yCoord), "depth", "Contrail Extinction-Defined Depth", "m");
+            if ( sink.wants("intOD") )
+                sink.put0D("intOD", iceAer.intYOD(dx_vec, dy_vec), "intOD", "Integrated Vertical Optical Depth", "m");
+        }
+
+        /* One file per save: every field gets its own variable */
+        class SnapshotSink : public TSPhysSink {
+            public:
+                SnapshotSink( const TSOutputOptions& options, NcFile& file, const NcDim& xDim, const NcDim& yDim, const NcDim& binRadDim, const NcDim& tDim ):
+                    TSPhysSink( options ), file_( file ), xDim_( xDim ), yDim_( yDim ), binRadDim_( binRadDim ), tDim_( tDim ) {}
+
+                void put0D( const string& key, const float toSave, const string& name, const string& desc, const string& units ) override {
+                    float value = toSave;
+                    GroomFloats( &value, 1, options_.digits( key ) );
+                    add0DVar(file_, value, tDim_, name, desc, units);
+                }
+                void put1D( const string& key, const Vector_1D& toSave, const TSDim dim, const string& name, const string& desc, const string& units ) override {
+                    const NcDim& nDim = dim == TSDim::X ? xDim_ : ( dim == TSDim::Y ? yDim_ : binRadDim_ );
+                    std::vector<float> array( toSave.begin(), toSave.end() );
+                    GroomFloats( array.data(), array.size(), options_.digits( key ) );
+                    putVar( { nDim }, array.data(), name, desc, units );
+                }
+                void put2D( const string& key, const Vector_2D& toSave, const string& name, const string& desc, const string& units ) override {
+                    const double scalingFactor = 1;
+                    float* array = util::vect2float( toSave, toSave.size(), toSave[0].size(), scalingFactor );
+                    GroomFloats( array, toSave.size() * toSave[0].size(), options_.digits( key ) );
+                    putVar( { yDim_, xDim_ }, array, name, desc, units );
+                    delete[] array;
+                }
+
+            private:
+                void putVar( const vector<NcDim>& dims, const float* array, const string& name, const string& desc, const string& units ) {
+                    NcVar var = file_.addVar( name, varDataType, dims );
+                    options_.compress( var );
+                    var.putAtt("units", units );
+                    var.putAtt("long_name", desc );
+                    var.putVar( array );
+                }
+
+                NcFile& file_;
+                const NcDim xDim_, yDim_, binRadDim_, tDim_;
+        };
+
+        /* Single file: every field is written into record iT of its variable */
+        class RecordSink : public TSPhysSink {
+            public:
+                typedef std::function<NcVar( const string&, const vector<NcDim>&, const string&, const string& )> VarFactory;
+
+                RecordSink( const TSOutputOptions& options, const VarFactory& factory, const size_t iT, const size_t nx, const size_t ny,
+                            const NcDim& tDim, const NcDim& xDim, const NcDim& yDim, const NcDim& binRadDim ):
+                    TSPhysSink( options ), factory_( factory ), iT_( iT ), nx_( nx ), ny_( ny ),
+                    tDim_( tDim ), xDim_( xDim ), yDim_( yDim ), binRadDim_( binRadDim ) {}
+
+                void put0D( const string& key, const float toSave, const string& name, const string& desc, const string& units ) override {
+                    float value = toSave;
+                    GroomFloats( &value, 1, options_.digits( key ) );
+                    factory_( name, { tDim_ }, desc, units ).putVar( { iT_ }, { 1 }, &value );
+                }
+                void put1D( const string& key, const Vector_1D& toSave, const TSDim dim, const string& name, const string& desc, const string& units ) override {
+                    const NcDim& nDim = dim == TSDim::X ? xDim_ : ( dim == TSDim::Y ? yDim_ : binRadDim_ );
+                    std::vector<float> array( toSave.begin(), toSave.end() );
+                    GroomFloats( array.data(), array.size(), options_.digits( key ) );
+                    factory_( name, { tDim_, nDim }, desc, units ).putVar( { iT_, 0 }, { 1, array.size() }, array.data() );
+                }
+                void put2D( const string& key, const Vector_2D& toSave, const string& name, const string& desc, const string& units ) override {
+                    const double scalingFactor = 1;
+                    float* array = util::vect2float( toSave, ny_, nx_, scalingFactor );
+                    GroomFloats( array, ny_ * nx_, options_.digits( key ) );
+                    factory_( name, { tDim_, yDim_, xDim_ }, desc, units ).putVar( { iT_, 0, 0 }, { 1, ny_, nx_ }, array );
+                    delete[] array;
+                }
+
+            private:
+                const VarFactory& factory_;
+                const size_t iT_, nx_, ny_;
+                const NcDim tDim_, xDim_, yDim_, binRadDim_;
+        };
+
+        /* Resamples the gridded fields onto the analysis grid before handing
+         * them to the sink that writes them */
+        class ResampleSink : public TSPhysSink {
+            public:
+                ResampleSink( const TSOutputOptions& options, TSPhysSink& sink, const LAGRID::FixedGridResampler& resampler ):
+                    TSPhysSink( options ), sink_( sink ), resampler_( resampler ) {}
+
+                void put0D( const string& key, const float toSave, const string& name, const string& desc, const string& units ) override {
+                    sink_.put0D( key, toSave, name, desc, units );
+                }
+                void put1D( const string& key, const Vector_1D& toSave, const TSDim dim, const string& name, const string& desc, const string& units ) override {
+                    if ( dim == TSDim::X )
+                        sink_.put1D( key, resampler_.applyX( toSave ), dim, name, desc, units );
+                    else if ( dim == TSDim::Y )
+                        sink_.put1D( key, resampler_.applyY( toSave ), dim, name, desc, units );
+                    else
+                        sink_.put1D( key, toSave, dim, name, desc, units );
+                }
+                void put2D( const string& key, const Vector_2D& toSave, const string& name, const string& desc, const string& units ) override {
+                    sink_.put2D( key, resampler_.apply( toSave ), name, desc, units );
+                }
+
+            private:
+                TSPhysSink& sink_;
+                const LAGRID::FixedGridResampler& resampler_;
+        };
+
+        /* Writes the fields through sink, resampled onto the analysis grid
+         * if the options ask for one */
+        void writeTSPhysFields( TSPhysSink& sink, const TSOutputOptions& options,
+                                const std::optional<LAGRID::FixedGridResampler>& resampler,
+                                const AIM::Grid_Aerosol& iceAer, const Vector_2D& H2O,
+                                const Vector_1D& xCoord, const Vector_1D& yCoord,
+                                const Vector_1D& xEdges, const Vector_1D& yEdges,
+                                const TSMetFields &met )
+        {
+            if ( resampler ) {
+                ResampleSink resampleSink( options, sink, *resampler );
+                writeTSPhysFields( resampleSink, iceAer, H2O, xCoord, yCoord, xEdges, yEdges, met );
+            }
+            else {
+                writeTSPhysFields( sink, iceAer, H2O, xCoord, yCoord, xEdges, yEdges, met );
+            }
+        }
+
+    }
+
     void Diag_TS_Phys( const char* rootName,
                     const int hh, const int mm, const int ss,
                     const AIM::Grid_Aerosol& iceAer, const Vector_2D& H2O,
                     const Vector_1D& xCoord, const Vector_1D& yCoord,
                     const Vector_1D& xEdges, const Vector_1D& yEdges,
-                    const Meteorology &met)
+                    const TSMetFields &met, const TSOutputOptions& options)
     {   
+        std::optional<LAGRID::FixedGridResampler> resampler;
+        if ( options.analysisGrid )
+            resampler.emplace( *options.analysisGrid, xEdges, yEdges );
+        const Vector_1D& xSave = resampler ? resampler->xCoords() : xCoord;
+        const Vector_1D& ySave = resampler ? resampler->yCoords() : yCoord;
+
         long unsigned int nBin = iceAer.getNBin();
-        long unsigned int nx = xCoord.size();
-        long unsigned int ny = yCoord.size();
+        long unsigned int nx = xSave.size();
+        long unsigned int ny = ySave.size();
 
-        Vector_2D areas = VectorUtils::cellAreas(xEdges, yEdges);
-        Vector_1D dx_vec(nx, xCoord[1] - xCoord[0]);
-        Vector_1D dy_vec(ny, yCoord[1] - yCoord[0]);
         std::filesystem::path rootPath( rootName );
         std::string fileName = rootPath.filename().generic_string();
 
@@ -308,12 +588,6 @@ namespace Diag {
         const NcDim binRadDim  = currFile.addDim( "r", nBin );
         const NcDim tDim       = currFile.addDim( "t" , 1);
 
-        // For storing 2D data
-        std::vector<NcDim> xyDims{ yDim, xDim };
-
-        // For storing bin radius data
-        std::vector<NcDim> xycDims{ binRadDim, yDim, xDim };
-
         // Add the variables corresponding to the dimensions
         NcVar xVar       = currFile.addVar( "x", ncFloat, xDim );
         NcVar yVar       = currFile.addVar( "y", ncFloat, yDim );
@@ -324,10 +598,10 @@ namespace Diag {
         // Put the data values and attributes into the dimension variables
         xVar.putAtt("units", "m");
         xVar.putAtt("long_name", "Grid cell horizontal centers");
-        xVar.putVar(xCoord.data());
+        xVar.putVar(xSave.data());
         yVar.putAtt("units", "m");
         yVar.putAtt("long_name", "Grid cell vertical centers");
-        yVar.putVar(&(yCoord)[0]);
+        yVar.putVar(&(ySave)[0]);
         binEdgeVar.putAtt("units", "m");
         binEdgeVar.putAtt("long_name", "ice bin edge radius");
         binEdgeVar.putVar(&(iceAer.getBinEdges())[0]);
@@ -345,63 +619,212 @@ namespace Diag {
         currFile.putAtt( "Generation Date", buffer );
         currFile.putAtt( "Format", "NetCDF-4" );
 
-        /* Output met */
+        SnapshotSink sink( options, currFile, xDim, yDim, binRadDim, tDim );
+        writeTSPhysFields( sink, options, resampler, iceAer, H2O, xCoord, yCoord, xEdges, yEdges, met );
+    } /* End of Diag_TS_Phys */
 
-        /* Check if evolving met. If not only save met in one file */
+    string TSSeriesFileName( const string& rootName )
+    {
+        std::filesystem::path rootPath( rootName );
+        std::string fileName = rootPath.filename().generic_string();
 
-        /* Saving meteorological pressure */
-        add1DVar(currFile, met.Press(), yDim, "Pressure", "Pressure", "Pa");
+        for ( const string placeholder: { "hhmmss", "hhmm" } ) {
+            size_t start_pos = fileName.find( placeholder );
+            if ( start_pos != std::string::npos ) {
+                fileName.replace( start_pos, placeholder.size(), "series" );
+                break;
+            }
+        }
+
+        return std::filesystem::path(rootPath.parent_path() / fileName).generic_string();
+    } /* End of TSSeriesFileName */
+
+    TSPhysFile::TSPhysFile( const string& fileName, const AIM::Grid_Aerosol& iceAer, const TSOutputOptions& options ):
+        file_( fileName, NcFile::replace ),
+        options_( options ),
+        nRecord_( 0 ),
+        xChunk_( 0 ),
+        yChunk_( 0 )
+    {
+        time_t rawtime;
+        char buffer[80];
+        time( &rawtime );
+        strftime(buffer, sizeof(buffer),"%d-%m-%Y %H:%M:%S", localtime(&rawtime));
+
+        tDim_      = file_.addDim( "t" );
+        xDim_      = file_.addDim( "x" );
+        yDim_      = file_.addDim( "y" );
+        binRadDim_ = file_.addDim( "r", iceAer.getNBin() );
+        const NcDim binEdgeDim = file_.addDim( "r_b", iceAer.getNBin() + 1 );
+
+        /* The ice bins do not change during a simulation */
+        NcVar binEdgeVar = file_.addVar( "r_e", ncFloat, binEdgeDim );
+        NcVar binRadVar  = file_.addVar( "r", ncFloat, binRadDim_ );
+        binEdgeVar.putAtt("units", "m");
+        binEdgeVar.putAtt("long_name", "ice bin edge radius");
+        binEdgeVar.putVar(&(iceAer.getBinEdges())[0]);
+        binRadVar.putAtt("units", "m");
+        binRadVar.putAtt("long_name", "Ice bin center radius");
+        binRadVar.putVar(&(iceAer.getBinCenters())[0]);
+
+        tVar_ = file_.addVar( "t", ncFloat, tDim_ );
+        tVar_.putAtt("units", "hours since simulation start");
+        tVar_.putAtt("long_name", "time");
+
+        std::string author = "Thibaud M. Fritz (fritzt@mit.edu)";
+        file_.putAtt( "FileName", fileName );
+        file_.putAtt( "Author", author );
+        file_.putAtt( "Contact", author );
+        file_.putAtt( "Generation Date", buffer );
+        file_.putAtt( "Format", "NetCDF-4" );
+    } /* End of TSPhysFile::TSPhysFile */
+
+    NcVar TSPhysFile::recordVar( const string& name, const NcType& type, const vector<NcDim>& dims,
+                                 const string& desc, const string& units )
+    {
+        auto it = vars_.find( name );
+        if ( it != vars_.end() )
+            return it->second;
+
+        /* One chunk holds one record of a field on a grid the size of the
+         * first one. Scalar time series are chunked along time instead. */
+        static const size_t SCALAR_CHUNK = 1024;
+        NcVar var = file_.addVar( name, type, dims );
+        vector<size_t> chunks;
+        for ( const NcDim& dim: dims ) {
+            if ( dim == tDim_ )
+                chunks.push_back( dims.size() == 1 ? SCALAR_CHUNK : 1 );
+            else if ( dim == xDim_ )
+                chunks.push_back( xChunk_ );
+            else if ( dim == yDim_ )
+                chunks.push_back( yChunk_ );
+            else
+                chunks.push_back( dim.getSize() );
+        }
+        var.setChunking( NcVar::nc_CHUNKED, chunks );
+        options_.compress( var );
+        var.putAtt("units", units );
+        var.putAtt("long_name", desc );
+        vars_.emplace( name, var );
+        return var;
+    } /* End of TSPhysFile::recordVar */
+
+    void TSPhysFile::Append( const int hh, const int mm, const int ss,
+                             const AIM::Grid_Aerosol& iceAer, const Vector_2D& H2O,
+                             const Vector_1D& xCoord, const Vector_1D& yCoord,
+                             const Vector_1D& xEdges, const Vector_1D& yEdges,
+                             const TSMetFields &met )
+    {
+        std::optional<LAGRID::FixedGridResampler> resampler;
+        if ( options_.analysisGrid )
+            resampler.emplace( *options_.analysisGrid, xEdges, yEdges );
+        const Vector_1D& xSave = resampler ? resampler->xCoords() : xCoord;
+        const Vector_1D& ySave = resampler ? resampler->yCoords() : yCoord;
+
+        const size_t nx = xSave.size();
+        const size_t ny = ySave.size();
+        if ( nRecord_ == 0 ) {
+            xChunk_ = nx;
+            yChunk_ = ny;
+        }
 
-        //Save Altitude
-        add1DVar(currFile, met.Altitude(), yDim, "Altitude", "Altitude", "m");
+        const float cur_time = hh+mm/60.0+ss/3600.0;
+        tVar_.putVar( { nRecord_ }, { 1 }, &cur_time );
+
+        const int nx_int = nx;
+        const int ny_int = ny;
+        recordVar( "nx", ncInt, { tDim_ }, "Number of grid cells along x in this record", "-" ).putVar( { nRecord_ }, { 1 }, &nx_int );
+        recordVar( "ny", ncInt, { tDim_ }, "Number of grid cells along y in this record", "-" ).putVar( { nRecord_ }, { 1 }, &ny_int );
+
+        RecordSink::VarFactory factory = [this]( const string& name, const vector<NcDim>& dims, const string& desc, const string& units ) {
+            return recordVar( name, varDataType, dims, desc, units );
+        };
+        RecordSink sink( options_, factory, nRecord_, nx, ny, tDim_, xDim_, yDim_, binRadDim_ );
+
+        /* The grid is always saved, and never quantised */
+        const TSOutputOptions gridOptions;
+        RecordSink gridSink( gridOptions, factory, nRecord_, nx, ny, tDim_, xDim_, yDim_, binRadDim_ );
+        gridSink.put1D( "", xSave, TSDim::X, "x_centers", "Grid cell horizontal centers", "m" );
+        gridSink.put1D( "", ySave, TSDim::Y, "y_centers", "Grid cell vertical centers", "m" );
+        writeTSPhysFields( sink, options_, resampler, iceAer, H2O, xCoord, yCoord, xEdges, yEdges, met );
+
+        /* Keep the file readable if the run stops before it is closed */
+        file_.sync();
+        nRecord_++;
+    } /* End of TSPhysFile::Append */
+
+    void Diag_Box( const char* fileName, const Vector_1D& timeArray,
+                   const Vector_2D& boxSpecies, const double airDens )
+    {
+        NcFile currFile(fileName,NcFile::replace);
 
-        /* Saving H2O gaseous concentration */
-        add2DVar(currFile, H2O, xyDims, "H2O", "H2O molecular concentration", "molec / cm^3");
+        time_t rawtime;
+        char buffer[80];
+        time( &rawtime );
+        strftime(buffer, sizeof(buffer),"%d-%m-%Y %H:%M:%S", localtime(&rawtime));
 
-        /* Saving meteorological temperature */
-        add2DVar(currFile, met.Temp(), xyDims, "Temperature", "Temperature", "K");
+        std::string author = "Thibaud M. Fritz (fritzt@mit.edu)";
+        currFile.putAtt( "FileName", fileName );
+        currFile.putAtt( "Author", author );
+        currFile.putAtt( "Contact", author );
+        currFile.putAtt( "Generation Date", buffer );
+        currFile.putAtt( "Format", "NetCDF-4" );
 
-        /* Saving ice aerosol particle number */
-        add2DVar(currFile, iceAer.TotalNumber(), xyDims, "Ice aerosol particle number", "Ice aerosol particle number concentration", "# / cm^3");
+        const NcDim tDim   = currFile.addDim( "t", timeArray.size() );
+        const NcDim airDim = currFile.addDim( "scalar", 1 );
 
-        // /* Saving ice aerosol surface area 
-        add2DVar(currFile, iceAer.TotalArea(), xyDims, "Ice aerosol surface area", "Ice aerosol surface area", "m^2 / cm^3");
-    
-        /* Saving ice aerosol volume */
-        add2DVar(currFile, iceAer.TotalVolume(), xyDims, "Ice aerosol volume", "Ice aerosol volume", "m^3 / cm^3");
+        Vector_1D time_h( timeArray.size() );
+        for ( UInt iT = 0; iT < timeArray.size(); iT++ )
+            time_h[iT] = ( timeArray[iT] - timeArray[0] ) / 3600.0;
 
-        /* Saving ice aerosol effective radius */
-        add2DVar(currFile, iceAer.EffRadius(), xyDims, "Effective radius", "Ice aerosol effective radius", "m");
+        add1DVar(currFile, time_h, tDim, "t", "Time since simulation start", "hr");
+        add0DVar(currFile, airDens, airDim, "Air density", "Air molecular density", "molec/cm^3");
 
-        /* Saving horizontal optical depth */
-        add1DVar(currFile, iceAer.xOD(dx_vec), yDim, "Horizontal optical depth", "Horizontally-integrated optical depth", "-");
+        for ( UInt N = 0; N < boxSpecies.size(); N++ ) {
+            std::string name = SPC_NAMES[N];
+            add1DVar(currFile, boxSpecies[N], tDim, name, name + " molecular concentration", "molec/cm^3");
+        }
 
-        /* Saving vertical optical depth */
-        add1DVar(currFile, iceAer.yOD(dy_vec), xDim, "Vertical optical depth", "Vertically-integrated optical depth", "-");
-    
-        /* Saving overall size distribution */ 
-        add1DVar(currFile, iceAer.Overall_Size_Dist(areas), binRadDim, "Overall size distribution", "Overall size distribution of ice particles", "part / m");
+    } /* End of Diag_Box */
 
-        /* Saving Total Ice Mass [kg/m] */
-        add0DVar(currFile, iceAer.TotalIceMass_sum(areas), tDim, "Ice Mass", "Total Mass of Ice Crystals of Cross Section", "kg / m");
+    void Diag_Adjoint( const char* fileName,
+                       const Vector_1D& finalPlume, const Vector_1D& initBackg,
+                       const Vector_1D& initBox, const double metric,
+                       const double tStart, const double tEnd )
+    {
+        NcFile currFile(fileName,NcFile::replace);
 
-        /* Saving Num Ice Particles [#/m] */
-        add0DVar(currFile, iceAer.TotalNumber_sum(areas), tDim, "Number Ice Particles", "Total Number of Ice Particles of Cross Section", "# / m");
+        time_t rawtime;
+        char buffer[80];
+        time( &rawtime );
+        strftime(buffer, sizeof(buffer),"%d-%m-%Y %H:%M:%S", localtime(&rawtime));
+
+        std::string species;
+        for ( UInt N = 0; N < NVAR; N++ ) {
+            if ( N > 0 )
+                species += ",";
+            species += SPC_NAMES[N];
+        }
 
-        /* Saving Extinction [-/m]*/
-        add2DVar(currFile, iceAer.Extinction(), xyDims, "Extinction", "Extinction", "m^-1");
+        std::string author = "Thibaud M. Fritz (fritzt@mit.edu)";
+        currFile.putAtt( "FileName", fileName );
+        currFile.putAtt( "Author", author );
+        currFile.putAtt( "Contact", author );
+        currFile.putAtt( "Generation Date", buffer );
+        currFile.putAtt( "Format", "NetCDF-4" );
+        currFile.putAtt( "Species", species );
 
-        /* Saving IWC */
-        add2DVar(currFile, iceAer.IWC(), xyDims, "IWC", "Ice Water Content", "kg / m^3");
+        const NcDim spcDim = currFile.addDim( "species", NVAR );
+        const NcDim tDim   = currFile.addDim( "t", 1 );
 
-        /* Saving RHi */
-        add2DVar(currFile, physFunc::RHi_Field(H2O, met.Temp(), met.Press()), xyDims, "RHi", "Relative Humidity w.r.t. Ice", "%");
+        add1DVar(currFile, finalPlume, spcDim, "Plume final", "Area-averaged plume concentration at the end of the simulation", "molec/cm^3");
+        add1DVar(currFile, initBackg, spcDim, "Ambient initial", "Ambient concentration at the start of the simulation", "molec/cm^3");
+        add1DVar(currFile, initBox, spcDim, "Box initial", "Optimized box model initial concentration", "molec/cm^3");
+        add0DVar(currFile, metric, tDim, "Metric", "Weighted residual of the optimized box model", "-");
+        add0DVar(currFile, tStart, tDim, "Start time", "Start time of the box model", "s");
+        add0DVar(currFile, tEnd, tDim, "End time", "End time of the box model", "s");
 
-        //Contrail width, depth, and integrated OD
-        add0DVar(currFile, iceAer.extinctionWidth(xCoord), tDim, "width", "Contrail Extinction-Defined Width", "m");
-        add0DVar(currFile, iceAer.extinctionDepth(yCoord), tDim, "depth", "Contrail Extinction-Defined Depth", "m");
-        add0DVar(currFile, iceAer.intYOD(dx_vec, dy_vec), tDim, "intOD", "Integrated Vertical Optical Depth", "m");
-    } /* End of Diag_TS_Phys */
+    } /* End of Diag_Adjoint */
 
 }
 
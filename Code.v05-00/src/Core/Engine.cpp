@@ -12,6 +12,7 @@
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "Core/Engine.hpp"
+#include "Core/InputDatabase.hpp"
 
 Engine::Engine( )
 {
@@ -24,28 +25,28 @@ Engine::Engine( const char *engineName, std::string engineFileName, double tempe
 {
     Name = engineName;
 
-    std::ifstream engineFile;
-    OpenFile( engineFileName.c_str(), engineFile );
-    
-    std::string idle, approach, climbout, takeoff;
-    bool foundEngine;
-    
     /* Get value at specific thrust settings from the EDB database */
-    foundEngine = GetEDB( engineFile, engineName, idle, approach, climbout, takeoff );
-    
-    if ( foundEngine == 0 ) {
+    std::shared_ptr<const EngineDatabase> database;
+    try {
+        database = EngineDatabase::Get( engineFileName );
+    }
+    catch ( const std::runtime_error &e ) {
+        std::cout << "ERROR: In Engine::Engine: Cannot read (" << engineFileName << ")" << std::endl;
+    }
+
+    std::string search( engineName );
+    if ( !search.empty() && search.back() == ',' )
+        search.pop_back();
+    const EngineDatabase::Entry *entry = database ? database->find( search ) : nullptr;
+
+    if ( entry == nullptr ) {
         std::cout << "Engine " << engineName << " was not found in " << engineFileName << std::endl;
         return;
     }
 
-    CloseFile( engineFile );
-
     /* Set fuelflow */
     fuelflow = 0.8;
 
-
-    std::string delimiter = ",";
-
     ratedThrust.push_back(4);
     LTO_fuelflow.push_back(4);
     LTO_NOx.push_back(4);
@@ -64,62 +65,39 @@ Engine::Engine( const char *engineName, std::string engineFileName, double tempe
     /* Adjustment/correction factor for installation effects (engine air bleed) */
     std::vector<double> fuelAdjustmentFactor = {1.100, 1.020, 1.013, 1.010};
 
-    std::vector<std::string> tokens;
-    std::string token;
-    std::string::size_type sz;
-    std::istringstream tokenStream;
+    /* Records are stored as approach, climb out, take off, idle */
+    const EngineDatabase::Mode &idle     = (*entry)[3];
+    const EngineDatabase::Mode &approach = (*entry)[0];
+    const EngineDatabase::Mode &climbout = (*entry)[1];
+    const EngineDatabase::Mode &takeoff  = (*entry)[2];
 
     /* Idle */
-    tokenStream.str(idle);
-    while ( std::getline( tokenStream, token, delimiter.c_str()[0] ) )
-        tokens.push_back( token );
-  
     ratedThrust[0]  = 0.07;
-    LTO_fuelflow[0] = std::stod(tokens[7]) * fuelAdjustmentFactor[0];
-    LTO_NOx[0]      = std::stod(tokens[4]);
-    LTO_CO[0]       = std::stod(tokens[2]);
-    LTO_HC[0]       = std::stod(tokens[3]);
-    tokens.clear();
-    tokenStream.clear();
+    LTO_fuelflow[0] = idle.fuelflow * fuelAdjustmentFactor[0];
+    LTO_NOx[0]      = idle.NOx;
+    LTO_CO[0]       = idle.CO;
+    LTO_HC[0]       = idle.HC;
 
     /* Approach */
-    tokenStream.str(approach);
-    while ( std::getline( tokenStream, token, delimiter.c_str()[0] ) )
-        tokens.push_back( token );
-  
     ratedThrust[1]  = 0.30;
-    LTO_fuelflow[1] = std::stod(tokens[7]) * fuelAdjustmentFactor[1];
-    LTO_NOx[1]      = std::stod(tokens[4]);
-    LTO_CO[1]       = std::stod(tokens[2]);
-    LTO_HC[1]       = std::stod(tokens[3]);
-    tokens.clear();
-    tokenStream.clear();
+    LTO_fuelflow[1] = approach.fuelflow * fuelAdjustmentFactor[1];
+    LTO_NOx[1]      = approach.NOx;
+    LTO_CO[1]       = approach.CO;
+    LTO_HC[1]       = approach.HC;
 
     /* Climb out */
-    tokenStream.str(climbout);
-    while ( std::getline( tokenStream, token, delimiter.c_str()[0] ) )
-        tokens.push_back( token );
-  
     ratedThrust[2]  = 0.70;
-    LTO_fuelflow[2] = std::stod(tokens[7]) * fuelAdjustmentFactor[2];
-    LTO_NOx[2]      = std::stod(tokens[4]);
-    LTO_CO[2]       = std::stod(tokens[2]);
-    LTO_HC[2]       = std::stod(tokens[3]);
-    tokens.clear();
-    tokenStream.clear();
+    LTO_fuelflow[2] = climbout.fuelflow * fuelAdjustmentFactor[2];
+    LTO_NOx[2]      = climbout.NOx;
+    LTO_CO[2]       = climbout.CO;
+    LTO_HC[2]       = climbout.HC;
 
     /* Take off */
-    tokenStream.str(takeoff);
-    while ( std::getline( tokenStream, token, delimiter.c_str()[0] ) )
-        tokens.push_back( token );
-  
     ratedThrust[3]  = 1.00;
-    LTO_fuelflow[3] = std::stod(tokens[7]) * fuelAdjustmentFactor[3];
-    LTO_NOx[3]      = std::stod(tokens[4]);
-    LTO_CO[3]       = std::stod(tokens[2]);
-    LTO_HC[3]       = std::stod(tokens[3]);
-    tokens.clear();
-    tokenStream.clear();
+    LTO_fuelflow[3] = takeoff.fuelflow * fuelAdjustmentFactor[3];
+    LTO_NOx[3]      = takeoff.NOx;
+    LTO_CO[3]       = takeoff.CO;
+    LTO_HC[3]       = takeoff.HC;
 
     /* Check that all values are strictly positives */
     for ( unsigned int i = 0; i < 4; i++ ) {
@@ -357,57 +335,6 @@ Engine::~Engine( )
 
 } /* End of Engine::~Engine */
 
-void Engine::OpenFile( const char *fileName, std::ifstream &file )
-{
-    
-    file.open( fileName );
-
-    if ( !file ) {
-        std::string const currFunc("Engine::OpenFile");
-        std::cout << "ERROR: In " << currFunc << ": Cannot read (" << fileName << ")" << std::endl;
-        return;
-    }
-
-} /* End of Engine::OpenFile */
-
-void Engine::CloseFile( std::ifstream &file )
-{
-    file.close( );
-
-} /* End of Engine::CloseFile */
-
-bool Engine::GetEDB( std::ifstream &enginefile, const char *engineName, std::string &idle, std::string &approach, std::string &climbout, std::string &takeoff )
-{
-    
-    std::string search( engineName );
-    std::string delimiter = ",";
-
-    std::string endch(1,search.back());
-    if ( delimiter.compare(endch) != 0 )
-        search += delimiter;
-
-    size_t pos;
-    bool found = 0;
-    std::string line;
-    while ((enginefile.eof() == 0) && (found == 0)) {
-        getline( enginefile, line );
-        pos = line.find( search );
-        if ( pos != std::string::npos ) {
-            approach = line;
-            getline( enginefile, line );
-            climbout = line;
-            getline( enginefile, line );
-            takeoff = line;
-            getline( enginefile, line );
-            idle = line;
-            found = 1;
-        }
-    }
-
-    return found;
-
-} /* End of Engine::GetEDB */
-
 std::string Engine::getName() const
 {
 
@@ -0,0 +1,439 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+#include "Core/InputDatabase.hpp"
+#include "Util/CacheDir.hpp"
+
+namespace {
+
+    const char ENGINEDB_MAGIC[8] = { 'A', 'P', 'C', 'E', 'N', 'G', 'D', 'B' };
+    const char BACKGDB_MAGIC[8]  = { 'A', 'P', 'C', 'B', 'A', 'C', 'K', 'G' };
+    const std::uint32_t INPUTDB_VERSION = 2;
+    /* Bound on the entry count of a precompiled file, against corrupt headers */
+    const std::uint32_t MAX_ENTRIES = 1 << 20;
+
+    std::atomic<bool> precompiledInputs( false );
+
+    /* Returns false if the file cannot be stamped */
+    bool Stamp( const std::string &fileName, InputFileStamp &stamp )
+    {
+        std::error_code ec;
+        const std::uintmax_t size = std::filesystem::file_size( fileName, ec );
+        if ( ec )
+            return false;
+        const auto mtime = std::filesystem::last_write_time( fileName, ec );
+        if ( ec )
+            return false;
+
+        stamp.size  = size;
+        stamp.mtime = std::chrono::duration_cast<std::chrono::nanoseconds>( mtime.time_since_epoch() ).count();
+        return true;
+    }
+
+    std::string Trim( const std::string &str )
+    {
+        const std::size_t first = str.find_first_not_of( " \t\r\n" );
+        if ( first == std::string::npos )
+            return "";
+        const std::size_t last = str.find_last_not_of( " \t\r\n" );
+        return str.substr( first, last - first + 1 );
+    }
+
+    std::vector<std::string> SplitCSV( const std::string &line )
+    {
+        std::vector<std::string> tokens;
+        std::string token;
+        std::istringstream tokenStream( line );
+        while ( std::getline( tokenStream, token, ',' ) )
+            tokens.push_back( token );
+        return tokens;
+    }
+
+    /* Minimal native-endian serialization of the databases */
+    class BinaryOut {
+        public:
+            BinaryOut( const std::string &fileName ): out_( fileName, std::ios::binary | std::ios::trunc ) {}
+            template <typename T> void put( const T &value ) { out_.write( reinterpret_cast<const char*>( &value ), sizeof( T ) ); }
+            void put( const std::string &str ) {
+                put<std::uint32_t>( str.size() );
+                out_.write( str.data(), str.size() );
+            }
+            void put( const Vector_1D &vec ) { out_.write( reinterpret_cast<const char*>( vec.data() ), sizeof( double ) * vec.size() ); }
+            void header( const char (&magic)[8], const InputFileStamp &stamp ) {
+                out_.write( magic, sizeof( magic ) );
+                put( INPUTDB_VERSION );
+                put( stamp.size );
+                put( stamp.mtime );
+            }
+            bool good() const { return bool( out_ ); }
+            void close() { out_.close(); }
+        private:
+            std::ofstream out_;
+    };
+
+    class BinaryIn {
+        public:
+            BinaryIn( const std::string &fileName ): in_( fileName, std::ios::binary ) {}
+            template <typename T> T get() {
+                T value{};
+                in_.read( reinterpret_cast<char*>( &value ), sizeof( T ) );
+                return value;
+            }
+            std::string getString() {
+                const std::uint32_t size = get<std::uint32_t>();
+                if ( !in_ || size > MAX_STRING )
+                    return "";
+                std::string str( size, '\0' );
+                in_.read( &str[0], size );
+                return str;
+            }
+            void get( Vector_1D &vec ) { in_.read( reinterpret_cast<char*>( vec.data() ), sizeof( double ) * vec.size() ); }
+            /* Checks the header: format, version and stamp of the text file */
+            bool header( const char (&expected)[8], const InputFileStamp &stamp ) {
+                char found[8] = {};
+                in_.read( found, sizeof( found ) );
+                if ( !in_ || std::memcmp( found, expected, sizeof( found ) ) != 0 || get<std::uint32_t>() != INPUTDB_VERSION )
+                    return false;
+                InputFileStamp written;
+                written.size  = get<std::uint64_t>();
+                written.mtime = get<std::int64_t>();
+                return in_ && written == stamp;
+            }
+            bool good() const { return bool( in_ ); }
+            /* Nothing is left after the last entry */
+            bool atEnd() { return in_.peek() == std::char_traits<char>::eof(); }
+        private:
+            static const std::uint32_t MAX_STRING = 4096;
+            std::ifstream in_;
+    };
+
+    /* Written under a temporary name and renamed, so that a concurrent
+     * reader never sees a partial file */
+    template <typename WriteFunction>
+    bool WriteAtomically( const std::string &binFileName, WriteFunction write )
+    {
+        const std::string tmpFile = binFileName + ".tmp" + std::to_string( getpid() );
+        {
+            BinaryOut out( tmpFile );
+            if ( out.good() )
+                write( out );
+            if ( !out.good() ) {
+                out.close();
+                std::remove( tmpFile.c_str() );
+                return false;
+            }
+        }
+        if ( std::rename( tmpFile.c_str(), binFileName.c_str() ) != 0 ) {
+            std::remove( tmpFile.c_str() );
+            return false;
+        }
+        return true;
+    }
+
+    /* Name of the precompiled copy of fileName, and the current stamp of
+     * fileName. Empty if precompiled inputs are off, or there is no cache
+     * folder, or fileName cannot be stamped */
+    std::string BinFileName( const std::string &fileName, InputFileStamp &stamp )
+    {
+        if ( !precompiledInputs || !Stamp( fileName, stamp ) )
+            return "";
+        return UserCacheFile( fileName, std::filesystem::path( fileName ).filename().string(), ".bin" );
+    }
+
+    /* The copy is not written if the text file changed while it was parsed */
+    bool Unchanged( const std::string &fileName, const InputFileStamp &stamp )
+    {
+        InputFileStamp parsedStamp;
+        return Stamp( fileName, parsedStamp ) && ( parsedStamp == stamp );
+    }
+
+}
+
+void SetPrecompiledInputs( const bool enable )
+{
+
+    precompiledInputs = enable;
+
+} /* End of SetPrecompiledInputs */
+
+std::shared_ptr<const EngineDatabase> EngineDatabase::Get( const std::string &fileName )
+{
+
+    static std::mutex registryMutex;
+    static std::map<std::string, std::shared_ptr<const EngineDatabase>> registry;
+
+    std::lock_guard<std::mutex> lock( registryMutex );
+    auto it = registry.find( fileName );
+    if ( it != registry.end() )
+        return it->second;
+
+    InputFileStamp stamp;
+    const std::string binFileName = BinFileName( fileName, stamp );
+    std::shared_ptr<const EngineDatabase> database;
+    if ( !binFileName.empty() )
+        database = Load( binFileName, stamp );
+    if ( database == nullptr ) {
+        database = Parse( fileName );
+        if ( !binFileName.empty() && Unchanged( fileName, stamp ) )
+            database->Write( binFileName, stamp );
+    }
+
+    registry.emplace( fileName, database );
+    return database;
+
+} /* End of EngineDatabase::Get */
+
+const EngineDatabase::Entry* EngineDatabase::find( const std::string &engineName ) const
+{
+
+    auto it = index_.find( engineName );
+    return it == index_.end() ? nullptr : &entries_[it->second];
+
+} /* End of EngineDatabase::find */
+
+std::shared_ptr<const EngineDatabase> EngineDatabase::Parse( const std::string &fileName )
+{
+
+    std::ifstream file( fileName );
+    if ( !file )
+        throw std::runtime_error("Cannot read engine emission database " + fileName);
+
+    std::vector<std::vector<std::string>> rows;
+    std::string line;
+    while ( std::getline( file, line ) )
+        rows.push_back( SplitCSV( line ) );
+
+    /* An engine is the first row with its name and the three rows after it.
+     * Rows are: name, mode, CO, HC, NOx, SOx, smoke number, fuel flow, ICAO UID, ... */
+    std::shared_ptr<EngineDatabase> database( new EngineDatabase() );
+    for ( std::size_t iRow = 0; iRow + 3 < rows.size(); iRow++ ) {
+        if ( rows[iRow].empty() || database->index_.count( rows[iRow][0] ) )
+            continue;
+
+        Entry entry;
+        bool valid = true;
+        for ( UInt iMode = 0; iMode < 4 && valid; iMode++ ) {
+            const std::vector<std::string> &tokens = rows[iRow + iMode];
+            try {
+                valid = ( tokens.size() >= 8 );
+                if ( valid )
+                    entry[iMode] = Mode{ std::stod( tokens[2] ), std::stod( tokens[3] ), \
+                                         std::stod( tokens[4] ), std::stod( tokens[7] ) };
+            }
+            catch ( const std::exception &e ) {
+                valid = false;
+            }
+        }
+        if ( !valid )
+            continue;
+
+        const UInt iEntry = database->entries_.size();
+        database->entries_.push_back( entry );
+        database->index_.emplace( rows[iRow][0], iEntry );
+        if ( rows[iRow].size() > 8 ) {
+            const std::string uid = Trim( rows[iRow][8] );
+            if ( !uid.empty() && uid != "-" )
+                database->index_.emplace( uid, iEntry );
+        }
+    }
+    return database;
+
+} /* End of EngineDatabase::Parse */
+
+std::shared_ptr<const EngineDatabase> EngineDatabase::Load( const std::string &binFileName, \
+                                                           const InputFileStamp &stamp )
+{
+
+    BinaryIn in( binFileName );
+    if ( !in.header( ENGINEDB_MAGIC, stamp ) )
+        return nullptr;
+
+    std::shared_ptr<EngineDatabase> database( new EngineDatabase() );
+    const std::uint32_t nEntry = in.get<std::uint32_t>();
+    const std::uint32_t nName  = in.get<std::uint32_t>();
+    if ( !in.good() || nEntry > MAX_ENTRIES || nName > 2 * nEntry )
+        return nullptr;
+    Vector_1D values( 4 * nEntry * 4 );
+    in.get( values );
+    for ( UInt iEntry = 0; iEntry < nEntry; iEntry++ ) {
+        Entry entry;
+        for ( UInt iMode = 0; iMode < 4; iMode++ ) {
+            const double *mode = &values[( iEntry * 4 + iMode ) * 4];
+            entry[iMode] = Mode{ mode[0], mode[1], mode[2], mode[3] };
+        }
+        database->entries_.push_back( entry );
+    }
+    for ( UInt iName = 0; iName < nName; iName++ ) {
+        const std::string name = in.getString();
+        const std::uint32_t iEntry = in.get<std::uint32_t>();
+        if ( !in.good() || iEntry >= nEntry )
+            return nullptr;
+        database->index_.emplace( name, iEntry );
+    }
+    if ( !in.good() || !in.atEnd() )
+        return nullptr;
+    return database;
+
+} /* End of EngineDatabase::Load */
+
+bool EngineDatabase::Write( const std::string &binFileName, const InputFileStamp &stamp ) const
+{
+
+    return WriteAtomically( binFileName, [&] ( BinaryOut &out ) {
+        out.header( ENGINEDB_MAGIC, stamp );
+        out.put<std::uint32_t>( entries_.size() );
+        out.put<std::uint32_t>( index_.size() );
+        for ( const Entry &entry: entries_ ) {
+            for ( const Mode &mode: entry )
+                out.put( Vector_1D{ mode.CO, mode.HC, mode.NOx, mode.fuelflow } );
+        }
+        for ( const auto &name: index_ ) {
+            out.put( name.first );
+            out.put<std::uint32_t>( name.second );
+        }
+    } );
+
+} /* End of EngineDatabase::Write */
+
+std::shared_ptr<const BackgroundDatabase> BackgroundDatabase::Get( const std::string &fileName, \
+                                                                   const UInt nSpec, const UInt nAer )
+{
+
+    static std::mutex registryMutex;
+    static std::map<std::string, std::shared_ptr<const BackgroundDatabase>> registry;
+
+    std::lock_guard<std::mutex> lock( registryMutex );
+    auto it = registry.find( fileName );
+    if ( it != registry.end() && it->second->ambient_.size() == nSpec && it->second->aerosol_.size() == nAer )
+        return it->second;
+
+    InputFileStamp stamp;
+    const std::string binFileName = BinFileName( fileName, stamp );
+    std::shared_ptr<const BackgroundDatabase> database;
+    if ( !binFileName.empty() )
+        database = Load( binFileName, stamp, nSpec, nAer );
+    if ( database == nullptr ) {
+        database = Parse( fileName, nSpec, nAer );
+        if ( !binFileName.empty() && Unchanged( fileName, stamp ) )
+            database->Write( binFileName, stamp );
+    }
+
+    registry[fileName] = database;
+    return database;
+
+} /* End of BackgroundDatabase::Get */
+
+int BackgroundDatabase::indexOf( const std::string &speciesName ) const
+{
+
+    auto it = index_.find( speciesName );
+    return it == index_.end() ? -1 : (int) it->second;
+
+} /* End of BackgroundDatabase::indexOf */
+
+std::shared_ptr<const BackgroundDatabase> BackgroundDatabase::Parse( const std::string &fileName, \
+                                                                     const UInt nSpec, const UInt nAer )
+{
+
+    std::ifstream file( fileName );
+    if ( !file )
+        throw std::runtime_error("Cannot read background conditions " + fileName);
+
+    std::shared_ptr<BackgroundDatabase> database( new BackgroundDatabase() );
+    database->ambient_.assign( nSpec, 0.0 );
+    database->aerosol_.assign( nAer, Vector_1D( 2, 0.0 ) );
+
+    /* Values are read in order, skipping empty lines and comments. The
+     * comment just before a species' value holds its name. Each aerosol
+     * takes two consecutive lines. */
+    std::string line, name;
+    UInt i = 0;
+    while ( ( std::getline( file, line ) ) && ( i < nSpec + nAer ) ) {
+        if ( ( line.length() > 0 ) && ( line != "\r" ) && ( line != "\n" ) && ( line[0] != '#' ) ) {
+            std::istringstream iss(line);
+            if ( i < nSpec ) {
+                iss >> database->ambient_[i];
+                if ( !name.empty() )
+                    database->index_.emplace( name, i );
+            }
+            else {
+                iss >> database->aerosol_[i - nSpec][0];
+                std::getline( file, line );
+                std::istringstream issRadius(line);
+                issRadius >> database->aerosol_[i - nSpec][1];
+            }
+            name.clear();
+            i++;
+        }
+        else if ( ( line.length() > 0 ) && ( line[0] == '#' ) ) {
+            name = Trim( line.substr( 1 ) );
+        }
+    }
+    return database;
+
+} /* End of BackgroundDatabase::Parse */
+
+std::shared_ptr<const BackgroundDatabase> BackgroundDatabase::Load( const std::string &binFileName, \
+                                                                    const InputFileStamp &stamp, \
+                                                                    const UInt nSpec, const UInt nAer )
+{
+
+    BinaryIn in( binFileName );
+    if ( !in.header( BACKGDB_MAGIC, stamp ) )
+        return nullptr;
+
+    /* Files written for another mechanism are parsed again */
+    if ( in.get<std::uint32_t>() != nSpec || in.get<std::uint32_t>() != nAer )
+        return nullptr;
+    const std::uint32_t nName = in.get<std::uint32_t>();
+    if ( !in.good() || nName > nSpec )
+        return nullptr;
+
+    std::shared_ptr<BackgroundDatabase> database( new BackgroundDatabase() );
+    database->ambient_.assign( nSpec, 0.0 );
+    in.get( database->ambient_ );
+    database->aerosol_.assign( nAer, Vector_1D( 2, 0.0 ) );
+    for ( Vector_1D &aerosol: database->aerosol_ )
+        in.get( aerosol );
+    for ( UInt iName = 0; iName < nName; iName++ ) {
+        const std::string name = in.getString();
+        const std::uint32_t iSpec = in.get<std::uint32_t>();
+        if ( !in.good() || iSpec >= nSpec )
+            return nullptr;
+        database->index_.emplace( name, iSpec );
+    }
+    if ( !in.good() || !in.atEnd() )
+        return nullptr;
+    return database;
+
+} /* End of BackgroundDatabase::Load */
+
+bool BackgroundDatabase::Write( const std::string &binFileName, const InputFileStamp &stamp ) const
+{
+
+    return WriteAtomically( binFileName, [&] ( BinaryOut &out ) {
+        out.header( BACKGDB_MAGIC, stamp );
+        out.put<std::uint32_t>( ambient_.size() );
+        out.put<std::uint32_t>( aerosol_.size() );
+        out.put<std::uint32_t>( index_.size() );
+        out.put( ambient_ );
+        for ( const Vector_1D &aerosol: aerosol_ )
+            out.put( aerosol );
+        for ( const auto &name: index_ ) {
+            out.put( name.first );
+            out.put<std::uint32_t>( name.second );
+        }
+    } );
+
+} /* End of BackgroundDatabase::Write */
+
+/* End of InputDatabase.cpp */
@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Core/JRateCache.hpp"
+#include "KPP/KPP_Parameters.h"
+
+namespace {
+
+    const char JRATECACHE_MAGIC[8] = { 'A', 'P', 'C', 'J', 'R', 'A', 'T', 'E' };
+    const std::uint32_t JRATECACHE_VERSION = 2;
+
+    struct JRateCacheHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t nLon;
+        std::uint32_t nLat;
+        std::uint32_t nPres;
+        std::uint32_t nPhotol;
+        std::uint32_t pad;
+        std::uint64_t sourceSize;
+        std::int64_t sourceMtime;
+    };
+
+    std::size_t CacheSize( const JRateCacheHeader &header )
+    {
+        return sizeof( JRateCacheHeader ) + sizeof( double ) * \
+               ( header.nLon + header.nLat + header.nPres +    \
+                 (std::size_t) header.nLon * header.nLat * header.nPres * header.nPhotol );
+    }
+
+}
+
+JRateCache::Source JRateCache::Stamp( const std::string &sourceFile )
+{
+
+    Source source;
+    std::error_code ec;
+    const std::uintmax_t size = std::filesystem::file_size( sourceFile, ec );
+    if ( ec )
+        return source;
+    const auto mtime = std::filesystem::last_write_time( sourceFile, ec );
+    if ( ec )
+        return source;
+
+    source.size  = size;
+    source.mtime = std::chrono::duration_cast<std::chrono::nanoseconds>( mtime.time_since_epoch() ).count();
+    return source;
+
+} /* End of JRateCache::Stamp */
+
+JRateCache::JRateCache( const Vector_1D &lon, const Vector_1D &lat, \
+                        const Vector_1D &pmid, Vector_1D &&data ):
+    nLon_( lon.size() ),
+    nLat_( lat.size() ),
+    nPres_( pmid.size() )
+{
+
+    if ( data.size() != (std::size_t) nLon_ * nLat_ * nPres_ * NPHOTOL )
+        throw std::invalid_argument("Photolysis rate data does not match the size of its grid!");
+
+    storage_.reserve( nLon_ + nLat_ + nPres_ + data.size() );
+    storage_.insert( storage_.end(), lon.begin(), lon.end() );
+    storage_.insert( storage_.end(), lat.begin(), lat.end() );
+    storage_.insert( storage_.end(), pmid.begin(), pmid.end() );
+    storage_.insert( storage_.end(), data.begin(), data.end() );
+    data.clear();
+
+    lon_  = storage_.data();
+    lat_  = lon_ + nLon_;
+    pmid_ = lat_ + nLat_;
+    data_ = pmid_ + nPres_;
+
+} /* End of JRateCache::JRateCache */
+
+JRateCache::~JRateCache()
+{
+
+    if ( mapping_ != nullptr )
+        munmap( mapping_, mappingSize_ );
+
+} /* End of JRateCache::~JRateCache */
+
+std::shared_ptr<const JRateCache> JRateCache::Map( const std::string &cacheFile, \
+                                                   const Source &source )
+{
+
+    const int fd = open( cacheFile.c_str(), O_RDONLY );
+    if ( fd < 0 )
+        return nullptr;
+
+    struct stat st;
+    JRateCacheHeader header;
+    if ( ( fstat( fd, &st ) != 0 ) || ( (std::size_t) st.st_size < sizeof( header ) ) || \
+         ( pread( fd, &header, sizeof( header ), 0 ) != sizeof( header ) ) ) {
+        close( fd );
+        return nullptr;
+    }
+
+    /* Caches written for another mechanism, format or input are ignored and rebuilt */
+    if ( ( std::memcmp( header.magic, JRATECACHE_MAGIC, sizeof( JRATECACHE_MAGIC ) ) != 0 ) || \
+         ( header.version != JRATECACHE_VERSION ) || ( header.nPhotol != NPHOTOL ) ||          \
+         ( header.nLon < 1 ) || ( header.nLat < 1 ) || ( header.nPres < 2 ) ||                  \
+         ( (std::size_t) st.st_size != CacheSize( header ) ) ||                                 \
+         ( header.sourceSize != source.size ) || ( header.sourceMtime != source.mtime ) ) {
+        close( fd );
+        return nullptr;
+    }
+
+    void* mapping = mmap( nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( mapping == MAP_FAILED )
+        return nullptr;
+
+    std::shared_ptr<JRateCache> cache( new JRateCache() );
+    cache->mapping_     = mapping;
+    cache->mappingSize_ = st.st_size;
+    cache->nLon_  = header.nLon;
+    cache->nLat_  = header.nLat;
+    cache->nPres_ = header.nPres;
+    cache->lon_   = reinterpret_cast<const double*>( static_cast<const char*>( mapping ) + sizeof( header ) );
+    cache->lat_   = cache->lon_ + cache->nLon_;
+    cache->pmid_  = cache->lat_ + cache->nLat_;
+    cache->data_  = cache->pmid_ + cache->nPres_;
+    return cache;
+
+} /* End of JRateCache::Map */
+
+bool JRateCache::Write( const std::string &cacheFile, const Source &source, \
+                        const Vector_1D &lon, const Vector_1D &lat,        \
+                        const Vector_1D &pmid, const Vector_1D &data )
+{
+
+    JRateCacheHeader header;
+    std::memcpy( header.magic, JRATECACHE_MAGIC, sizeof( JRATECACHE_MAGIC ) );
+    header.version = JRATECACHE_VERSION;
+    header.nLon    = lon.size();
+    header.nLat    = lat.size();
+    header.nPres   = pmid.size();
+    header.nPhotol = NPHOTOL;
+    header.pad     = 0;
+    header.sourceSize  = source.size;
+    header.sourceMtime = source.mtime;
+
+    if ( data.size() != (std::size_t) header.nLon * header.nLat * header.nPres * NPHOTOL )
+        throw std::invalid_argument("Photolysis rate data does not match the size of its grid!");
+
+    const std::string tmpFile = cacheFile + ".tmp" + std::to_string( getpid() );
+    {
+        std::ofstream out( tmpFile, std::ios::binary | std::ios::trunc );
+        if ( !out )
+            return false;
+        out.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+        out.write( reinterpret_cast<const char*>( lon.data() ), sizeof( double ) * lon.size() );
+        out.write( reinterpret_cast<const char*>( lat.data() ), sizeof( double ) * lat.size() );
+        out.write( reinterpret_cast<const char*>( pmid.data() ), sizeof( double ) * pmid.size() );
+        out.write( reinterpret_cast<const char*>( data.data() ), sizeof( double ) * data.size() );
+        if ( !out ) {
+            out.close();
+            std::remove( tmpFile.c_str() );
+            return false;
+        }
+    }
+
+    if ( std::rename( tmpFile.c_str(), cacheFile.c_str() ) != 0 ) {
+        std::remove( tmpFile.c_str() );
+        return false;
+    }
+    return true;
+
+} /* End of JRateCache::Write */
+
+const double* JRateCache::column( const UInt iLat, const UInt iLon, const UInt iPres ) const
+{
+
+    return data_ + ( ( (std::size_t) iLat * nLon_ + iLon ) * nPres_ + iPres ) * NPHOTOL;
+
+} /* End of JRateCache::column */
+
+void JRateCache::Interpolate( const double LON, const double LAT, const double P_hPa, \
+                              double NOON_JRATES[] ) const
+{
+
+    /* Find values in table closest to local longitude, latitude and pressure.
+     * Points beyond the last grid row are treated as lying on it. */
+    const UInt LON_INDEX = std::min<UInt>( std::lower_bound( lon_, lon_ + nLon_, LON ) - lon_, nLon_ - 1 );
+    const bool LON_EDGE  = ( LON_INDEX == 0 ) || ( LON_INDEX + 1 == nLon_ );
+    const double LON_HIGH = lon_[LON_INDEX];
+    const double LON_LOW  = LON_EDGE ? LON_HIGH : lon_[LON_INDEX - 1];
+
+    const UInt LAT_INDEX = std::min<UInt>( std::lower_bound( lat_, lat_ + nLat_, LAT ) - lat_, nLat_ - 1 );
+    const bool LAT_EDGE  = ( LAT_INDEX == 0 ) || ( LAT_INDEX + 1 == nLat_ );
+    const double LAT_HIGH = lat_[LAT_INDEX];
+    const double LAT_LOW  = LAT_EDGE ? LAT_HIGH : lat_[LAT_INDEX - 1];
+
+    /* PMID is sorted in decreasing order, search it from the top */
+    const auto PRES_IT = std::lower_bound( std::make_reverse_iterator( pmid_ + nPres_ ), \
+                                           std::make_reverse_iterator( pmid_ ), P_hPa );
+    const UInt PRES_INDEX = std::clamp<UInt>( nPres_ - ( PRES_IT - std::make_reverse_iterator( pmid_ + nPres_ ) ), \
+                                              1, nPres_ - 1 );
+
+    const double PRES_HIGH = pmid_[PRES_INDEX - 1];
+    const double PRES_LOW  = pmid_[PRES_INDEX];
+
+    /* Each column holds the rates at PRES_INDEX-1 (L) followed by PRES_INDEX (H) */
+    const double* NE = column( LAT_INDEX, LON_INDEX, PRES_INDEX - 1 );
+    const double* NW = LON_EDGE ? NE : column( LAT_INDEX, LON_INDEX - 1, PRES_INDEX - 1 );
+    const double* SE = LAT_EDGE ? NE : column( LAT_INDEX - 1, LON_INDEX, PRES_INDEX - 1 );
+    const double* SW = ( LAT_EDGE || LON_EDGE ) ? NE : column( LAT_INDEX - 1, LON_INDEX - 1, PRES_INDEX - 1 );
+
+    for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ ) {
+        const double jRateNEL = NE[iPhotol], jRateNEH = NE[NPHOTOL + iPhotol];
+        const double jRateNWL = NW[iPhotol], jRateNWH = NW[NPHOTOL + iPhotol];
+        const double jRateSEL = SE[iPhotol], jRateSEH = SE[NPHOTOL + iPhotol];
+        const double jRateSWL = SW[iPhotol], jRateSWH = SW[NPHOTOL + iPhotol];
+
+        if ( LAT_EDGE && LON_EDGE ) {
+            NOON_JRATES[iPhotol] = ( ( P_hPa - PRES_LOW  ) * jRateNEL + \
+                                     ( PRES_HIGH - P_hPa ) * jRateNEH ) /\
+                                   ( PRES_HIGH - PRES_LOW );
+        } else if ( LAT_EDGE ) {
+            NOON_JRATES[iPhotol] = ( ( LON_HIGH - LON ) * ( ( P_hPa - PRES_LOW  ) * jRateNWL + \
+                                                            ( PRES_HIGH - P_hPa ) * jRateNWH ) + \
+                                     ( LON - LON_LOW  ) * ( ( P_hPa - PRES_LOW  ) * jRateNEL + \
+                                                            ( PRES_HIGH - P_hPa ) * jRateNEH ) ) /\
+                                   ( PRES_HIGH - PRES_LOW ) / ( LON_HIGH - LON_LOW );
+        } else if ( LON_EDGE ) {
+            NOON_JRATES[iPhotol] = ( ( LAT_HIGH - LAT ) * ( ( P_hPa - PRES_LOW  ) * jRateSEL + \
+                                                            ( PRES_HIGH - P_hPa ) * jRateSEH ) + \
+                                     ( LAT - LAT_LOW  ) * ( ( P_hPa - PRES_LOW  ) * jRateNEL + \
+                                                            ( PRES_HIGH - P_hPa ) * jRateNEH ) ) /\
+                                   ( PRES_HIGH - PRES_LOW ) / ( LAT_HIGH - LAT_LOW );
+        } else {
+            NOON_JRATES[iPhotol] = ( ( LAT_HIGH - LAT ) * ( ( LON_HIGH - LON ) * ( ( P_hPa - PRES_LOW  ) * jRateSWL + \
+                                                                                   ( PRES_HIGH - P_hPa ) * jRateSWH ) + \
+                                                            ( LON - LON_LOW  ) * ( ( P_hPa - PRES_LOW  ) * jRateSEL + \
+                                                                                   ( PRES_HIGH - P_hPa ) * jRateSEH ) ) + \
+                                     ( LAT - LAT_LOW  ) * ( ( LON_HIGH - LON ) * ( ( P_hPa - PRES_LOW  ) * jRateNWL + \
+                                                                                   ( PRES_HIGH - P_hPa ) * jRateNWH ) + \
+                                                            ( LON - LON_LOW  ) * ( ( P_hPa - PRES_LOW  ) * jRateNEL + \
+                                                                                   ( PRES_HIGH - P_hPa ) * jRateNEH ) ) ) /\
+                                   ( PRES_HIGH - PRES_LOW ) / ( LON_HIGH - LON_LOW ) / ( LAT_HIGH - LAT_LOW );
+        }
+    }
+
+} /* End of JRateCache::Interpolate */
+
+/* End of JRateCache.cpp */
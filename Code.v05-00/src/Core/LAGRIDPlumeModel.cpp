@@ -1,6 +1,12 @@
 #include "Core/LAGRIDPlumeModel.hpp"
 #include "Core/Status.hpp"
-LAGRIDPlumeModel::LAGRIDPlumeModel( const OptInput &optInput, const Input &input ):
+#include "Core/AmbientState.hpp"
+#include "Core/InputDatabase.hpp"
+#include "KPP/KPP_Parameters.h"
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+LAGRIDPlumeModel::LAGRIDPlumeModel( const OptInput &optInput, const Input &input, SweepSummary* summary ):
     optInput_(optInput),
     input_(input),
     numThreads_(optInput.SIMULATION_OMP_NUM_THREADS),
@@ -8,7 +14,8 @@ LAGRIDPlumeModel::LAGRIDPlumeModel( const OptInput &optInput, const Input &input
     sun_(SZA(input.latitude_deg(), input.emissionDOY())),
     timestepVars_(TimestepVarsWrapper(input, optInput)),
     aircraft_(Aircraft(input, optInput.SIMULATION_INPUT_ENG_EI)),
-    jetA_(Fuel("C12H24"))
+    jetA_(Fuel("C12H24")),
+    summary_(summary)
 
 {
     /* Multiply by 500 since it gets multiplied by 1/500 within the Emission object ... */ 
@@ -16,6 +23,16 @@ LAGRIDPlumeModel::LAGRIDPlumeModel( const OptInput &optInput, const Input &input
 
     EI_ = Emission( aircraft_.engine(), jetA_ );
 
+    tsAeroOptions_.vars = optInput.TS_AERO_VARS;
+    tsAeroOptions_.deflate = optInput.TS_AERO_DEFLATE;
+    tsAeroOptions_.sigDigits = optInput.TS_AERO_SIGDIGITS;
+    if ( optInput.TS_AERO_RESAMPLE ) {
+        const double dx = ( optInput.TS_AERO_GRID_XLIM_RIGHT + optInput.TS_AERO_GRID_XLIM_LEFT ) / optInput.TS_AERO_GRID_NX;
+        const double dy = ( optInput.TS_AERO_GRID_YLIM_UP + optInput.TS_AERO_GRID_YLIM_DOWN ) / optInput.TS_AERO_GRID_NY;
+        tsAeroOptions_.analysisGrid.emplace( -optInput.TS_AERO_GRID_XLIM_LEFT, -optInput.TS_AERO_GRID_YLIM_DOWN, dx, dy,
+                                             optInput.TS_AERO_GRID_NX, optInput.TS_AERO_GRID_NY );
+    }
+
     timestepVars_.setTimeArray(PlumeModelUtils::BuildTime ( timestepVars_.tInitial_s, timestepVars_.tFinal_s, 3600.0*sun_.sunRise, 3600.0*sun_.sunSet, timestepVars_.dt ));
 
     createOutputDirectories();
@@ -68,7 +85,7 @@ SimStatus LAGRIDPlumeModel::runFullModel() {
             tool used to tune the intensity of the simulated turbulence, but we can also just vary the amplitude.
         */
         if (simVars_.TEMP_PERTURB){
-            met_.updateTempPerturb();
+            met_.updateTempPerturb(input_.Case(), timestepVars_.nTime);
         }
 
         solarTime_h_ = ( timestepVars_.curr_Time_s + timestepVars_.TRANSPORT_DT / 2 ) / 3600.0;
@@ -87,6 +104,13 @@ SimStatus LAGRIDPlumeModel::runFullModel() {
             timestepVars_.lastTimeIceGrowth = timestepVars_.curr_Time_s + timestepVars_.dt;
             iceAerosol_.Grow( timestepVars_.ICE_GROWTH_DT, H2O_, met_.Temp(), met_.Press());
         }
+
+        // Run Ice Coagulation
+        if (simVars_.ICE_COAG && timestepVars_.checkTimeForIceCoag()) {
+            std::cout << "Running ice coagulation..." << std::endl;
+            timestepVars_.lastTimeIceCoag = timestepVars_.curr_Time_s + timestepVars_.dt;
+            iceAerosol_.Coagulate( timestepVars_.COAG_DT, met_.Temp(), met_.Press(), "ice", physConst::RHO_ICE );
+        }
         // Vector_2D areas = VectorUtils::cellAreas(xEdges_, yEdges_);
         // std::cout << "Num Particles: " << iceAerosol_.TotalNumber_sum(areas) << std::endl;
         // std::cout << "Ice Mass: " << iceAerosol_.TotalIceMass_sum(areas) << std::endl;
@@ -123,17 +147,14 @@ SimStatus LAGRIDPlumeModel::runFullModel() {
             break;
         }
     }
+    finishTSAerosol();
     auto stop = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop-start);
     std::cout << "APCEMM LAGRID Plume Model Run Finished! Run time: " << duration.count() << "ms" << std::endl;
     return status;
 }
 
-SimStatus LAGRIDPlumeModel::runEPM() {
-    double C[NSPEC];             /* Concentration of all species */
-    double * VAR = &C[0];        /* Concentration of variable species */
-    double * FIX = &C[NVAR];     /* Concentration of fixed species */
-
+void LAGRIDPlumeModel::initEPMMet() {
     //Need a met object to create a solution object, even in EPM...
     double dy = (optInput_.ADV_GRID_YLIM_UP + optInput_.ADV_GRID_YLIM_DOWN) / optInput_.ADV_GRID_NY;
     double y0 = -optInput_.ADV_GRID_YLIM_DOWN;
@@ -154,27 +175,80 @@ SimStatus LAGRIDPlumeModel::runEPM() {
     std::cout << "RHw              = " << met_.rhwRef() << " %" << std::endl;
     std::cout << "RHi              = " << met_.rhiRef() << " %" << std::endl;
     std::cout << "Saturation depth = " << met_.satdepthUser() << " m" << std::endl;
-    //Still need the solution data structure...
-    Solution epmSolution(optInput_);
+}
 
+std::pair<EPM::EPMOutput, SimStatus> LAGRIDPlumeModel::integrateEPM() {
     /* Compute airDens from pressure and temperature */
     double airDens = simVars_.pressure_Pa / ( physConst::kB   * met_.tempRef() ) * 1.00E-06;
     /*     [molec/cm3] = [Pa = J/m3] / ([J/K]            * [K]           ) * [m3/cm3] */
 
-    /* This sets the species array values in the Solution data structure to the ambient data file, 
-       EXCEPT FOR H2O which is user defined via met input or rhw input */
-    epmSolution.Initialize( simVars_.BACKG_FILENAME.c_str(), input_, airDens, met_, optInput_, VAR, FIX, false );
-
-    Vector_2D aerArray = epmSolution.getAerosol();
-
+    double dy = yEdges_[1] - yEdges_[0];
     int i_0 = std::floor( optInput_.ADV_GRID_XLIM_LEFT / optInput_.ADV_GRID_NX ); //index i where x = 0
     int j_0 = std::floor( -yEdges_[0] / dy ); //index j where y = 0
 
-    //This sets the values in VAR and FIX to the values in the solution data structure at indices i, j
-    epmSolution.getData(VAR, FIX, i_0, j_0);
+    /* Ambient data at indices i, j, EXCEPT FOR H2O which is user defined via met input or rhw input.
+       Only that cell is needed, not the full solution data structure */
+    const AmbientState ambient( simVars_.BACKG_FILENAME.c_str(), input_, airDens, met_, optInput_, i_0, j_0 );
 
     //RUN EPM
-    EPM_result_ = EPM::Integrate(met_.tempRef(), simVars_.pressure_Pa, met_.rhwRef(), input_.bypassArea(), input_.coreExitTemp(), VAR, aerArray, aircraft_, EI_, simVars_.CHEMISTRY, optInput_.ADV_AMBIENT_LAPSERATE, input_.fileName_micro() );
+    return EPM::Integrate(met_.tempRef(), simVars_.pressure_Pa, met_.rhwRef(), input_.bypassArea(), input_.coreExitTemp(), ambient, aircraft_, EI_, simVars_.CHEMISTRY, optInput_.ADV_AMBIENT_LAPSERATE, input_.fileName_micro(), EPM::microOutputSettings(optInput_), EPM::integratorType(optInput_) );
+}
+
+EPM::ResponseSurface::Point LAGRIDPlumeModel::epmTablePoint() const {
+    return { met_.tempRef(), simVars_.pressure_Pa, met_.rhwRef(), input_.EI_Soot(), input_.sootRad(), input_.bypassArea(), input_.coreExitTemp() };
+}
+
+std::string LAGRIDPlumeModel::epmTableContext() const {
+    /* The background file is identified by its content: 64-bit FNV-1a hash of the values read from it */
+    const auto background = BackgroundDatabase::Get( simVars_.BACKG_FILENAME, NSPEC, N_AER );
+    std::uint64_t backgHash = 0xCBF29CE484222325;
+    auto hashValue = [&backgHash]( double val ) {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>( &val );
+        for ( std::size_t k = 0; k < sizeof(double); k++ ) {
+            backgHash ^= bytes[k];
+            backgHash *= 0x100000001B3;
+        }
+    };
+    for ( double val: background->ambient() ) hashValue( val );
+    for ( const Vector_1D& aer: background->aerosol() ) for ( double val: aer ) hashValue( val );
+
+    std::ostringstream context;
+    context << std::setprecision(12);
+    context << "engine=" << aircraft_.engine().getName() << " engEI=" << optInput_.SIMULATION_INPUT_ENG_EI
+            << " nEngines=" << input_.numEngines() << " fuelFlow=" << input_.fuelFlow() << " vFlight=" << input_.flightSpeed()
+            << " fuel=" << jetA_.getChemFormula() << " FSC=" << jetA_.getFSC()
+            << " EI_NOx=" << input_.EI_NOx() << " EI_CO=" << input_.EI_CO() << " EI_HC=" << input_.EI_HC()
+            << " EI_SO2=" << input_.EI_SO2() << " EI_SO2TOSO4=" << input_.EI_SO2TOSO4()
+            << " backg=" << std::hex << backgHash << std::dec
+            << " backgNOx=" << input_.backgNOx() << " backgHNO3=" << input_.backgHNO3() << " backgO3=" << input_.backgO3()
+            << " backgCO=" << input_.backgCO() << " backgCH4=" << input_.backgCH4() << " backgSO2=" << input_.backgSO2()
+            << " lat=" << input_.latitude_deg() << " DOY=" << input_.emissionDOY() << " emissionTime=" << input_.emissionTime()
+            << " chemistry=" << simVars_.CHEMISTRY << " lapseRate=" << optInput_.ADV_AMBIENT_LAPSERATE
+            << " integrator=" << optInput_.ADV_EPM_INTEGRATOR;
+    return context.str();
+}
+
+std::pair<EPM::ResponseSurface::Point, EPM::ResponseSurface::NodeResult> LAGRIDPlumeModel::runEPMForTable() {
+    initEPMMet();
+    EPM::ResponseSurface::Point point = epmTablePoint();
+    return std::make_pair(point, integrateEPM());
+}
+
+SimStatus LAGRIDPlumeModel::runEPM() {
+    initEPMMet();
+
+    //Interpolate from the EPM table when possible, the solution data structure isn't needed then
+    std::optional<EPM::ResponseSurface::Result> tableResult;
+    if ( !optInput_.ADV_EPM_TABLE_FILE.empty() ) {
+        tableResult = EPM::ResponseSurface::load(optInput_.ADV_EPM_TABLE_FILE, epmTableContext())->interpolate(epmTablePoint(), optInput_.ADV_EPM_TABLE_MAXERR);
+    }
+    if ( tableResult ) {
+        std::cout << "EPM results interpolated from table, est. rel. error = " << tableResult->relError << std::endl;
+        EPM_result_ = std::make_pair(tableResult->output, tableResult->status);
+    }
+    else {
+        EPM_result_ = integrateEPM();
+    }
     EPM::EPMOutput& epmOutput = EPM_result_.first;
     SimStatus EPM_RC = EPM_result_.second;
 
@@ -331,7 +405,7 @@ void LAGRIDPlumeModel::runTransport(double timestep) {
     auto ZERO_BC = FVM_ANDS::bcFrom2DVector(iceAerosol_.getPDF()[0], true);
 
     //TODO: Implement height dependent shear. For now, just taking shear of y coordinate with highest xOD to avoid bugs.
-    auto xOD = iceAerosol_.xOD(Vector_1D(xCoords_.size(), xCoords_[1] - xCoords_[0]));
+    auto xOD = iceAerosol_.xOD(VectorUtils::cellWidths(xEdges_));
     double maxIdx = 0;
     for (int i = 0; i < xOD.size(); i++) {
         if(xOD[i] > xOD[maxIdx]) maxIdx = i;
@@ -341,6 +415,8 @@ void LAGRIDPlumeModel::runTransport(double timestep) {
     const FVM_ANDS::AdvDiffParams fvmSolverInitParams(0, 0, shear_rep_, input_.horizDiff(), input_.vertiDiff(), timestepVars_.TRANSPORT_DT);
     const FVM_ANDS::BoundaryConditions ZERO_BC_INIT = FVM_ANDS::bcFrom2DVector(iceAerosol_.getPDF()[0], true);
     updateDiffVecs();
+    //Buffers can be coarser than the contrail core (ADV_GRID_COARSEN_LEVELS > 0)
+    const Vector_1D dxCells = VectorUtils::cellWidths(xEdges_);
     //Transport the Ice Aerosol PDF
     #pragma omp parallel for default(shared)
     for ( int n = 0; n < iceAerosol_.getNBin(); n++ ) {
@@ -349,6 +425,7 @@ void LAGRIDPlumeModel::runTransport(double timestep) {
             * accordingly */
         FVM_ANDS::FVM_Solver solver(fvmSolverInitParams, xCoords_, yCoords_, ZERO_BC_INIT, FVM_ANDS::std2dVec_to_eigenVec(H2O_));
         //Update solver params
+        solver.updateCellWidthsX(dxCells);
         solver.updateTimestep(timestep);
         solver.updateDiffusion(diffCoeffX_, diffCoeffY_);
         solver.updateAdvection(0, -vFall_[n], shear_rep_);
@@ -360,6 +437,7 @@ void LAGRIDPlumeModel::runTransport(double timestep) {
     {   
         //Dont use enhanced diffusion on the H2O, and turn off advection
         FVM_ANDS::FVM_Solver solver(fvmSolverInitParams, xCoords_, yCoords_, ZERO_BC_INIT, FVM_ANDS::std2dVec_to_eigenVec(H2O_));
+        solver.updateCellWidthsX(dxCells);
         solver.updateTimestep(timestep);
         solver.updateDiffusion(input_.horizDiff(), input_.vertiDiff());
         solver.updateAdvection(0, 0, 0);
@@ -370,29 +448,31 @@ void LAGRIDPlumeModel::runTransport(double timestep) {
     }
 }
 
-LAGRID::twoDGridVariable LAGRIDPlumeModel::remapVariable(const VectorUtils::MaskInfo& maskInfo, const BufferInfo& buffers, const Vector_2D& phi, const std::vector<std::vector<int>>& mask) {
+LAGRID::RemapOperator LAGRIDPlumeModel::buildRemapOperator(const VectorUtils::MaskInfo& maskInfo, const BufferInfo& buffers, const std::vector<std::vector<int>>& mask) {
     double dy_grid_old = yCoords_[1] - yCoords_[0];
-    double dx_grid_old = xCoords_[1] - xCoords_[0];
-
-    // TODO: Add adaptive mesh size. This current implementation causes memory corruptions.
-    // We need an extra grid cell on each side to avoid dealing with nasty indexing edge cases
-    // if the boxes' and remapping's minX, maxX, minY, maxY are the same.
-    auto boxGrid = LAGRID::rectToBoxGrid(dy_grid_old, met_.dy_vec(), dx_grid_old, xEdges_[0], yEdges_[0], phi, mask);
 
+    //The contrail is remapped onto a uniform fine block. With ADV_GRID_COARSEN_LEVELS > 0, the left/right buffers
+    //(ambient air only) are made of coarser blocks, which the box grid below handles like any other cells
+    //once the contrail spreads into them.
     //Enforce at least x many points in the contrail while limiting minimum/maximum dx and dy
     double dx_grid_new =  std::max(20.0, std::min((maskInfo.maxX - maskInfo.minX) / 50.0, 50.0));
     double dy_grid_new = std::max(5.0, std::min((maskInfo.maxY - maskInfo.minY) / 50.0, 7.0));
-    //Need 2 extra points account for the buffer
+    // We need an extra grid cell on each side to avoid dealing with nasty indexing edge cases
+    // if the boxes' and remapping's minX, maxX, minY, maxY are the same.
     int nx_new = floor((maskInfo.maxX - maskInfo.minX) / dx_grid_new) + 2;
     int ny_new = floor((maskInfo.maxY - maskInfo.minY) / dy_grid_new) + 2;
     LAGRID::Remapping remapping(maskInfo.minX - dx_grid_new, maskInfo.minY - dy_grid_new, dx_grid_new, dy_grid_new, nx_new, ny_new);
 
-    auto remappedGrid = LAGRID::mapToStructuredGrid(boxGrid, remapping);
-
-    remappedGrid.addBuffer(buffers.leftBuffer, buffers.rightBuffer, buffers.topBuffer, buffers.botBuffer);
-    // std::cout << "remap successful" << std::endl;
-    return remappedGrid;
-
+    //The box grid and overlaps only depend on the geometry and the mask, so they are shared by all remapped variables.
+    auto remapOp = LAGRID::buildRemapOperator(dy_grid_old, met_.dy_vec(), xEdges_, yEdges_[0], mask, remapping);
+    if(optInput_.ADV_GRID_COARSEN_LEVELS > 0) {
+        remapOp.addBuffer(buffers.leftBuffer, buffers.rightBuffer, buffers.topBuffer, buffers.botBuffer,
+                          optInput_.ADV_GRID_COARSEN_BLOCKSIZE, optInput_.ADV_GRID_COARSEN_LEVELS);
+    }
+    else {
+        remapOp.addBuffer(buffers.leftBuffer, buffers.rightBuffer, buffers.topBuffer, buffers.botBuffer);
+    }
+    return remapOp;
 }
 
 void LAGRIDPlumeModel::remapAllVars(double remapTimestep) {
@@ -434,59 +514,38 @@ void LAGRIDPlumeModel::remapAllVars(double remapTimestep) {
     buffers.topBuffer = std::max(vertDiffLengthScale * TOP_BUFFER_SCALING, 100.0);
     buffers.botBuffer = (vertDiffLengthScale + settlingLengthScale) * BOT_BUFFER_SCALING;
 
-    /* TODO: Benchmark various ways of parallelizing this section, mainly the volume calculation that requires a reduction */
-    #pragma omp parallel for default(shared)
+    //Remap pdf and volume of every bin and H2O (Set the zeroes to met later) with the same operator
+    auto remapOp = buildRemapOperator(maskInfo, buffers, mask);
+    std::vector<Vector_2D*> fields;
+    fields.reserve(2 * iceAerosol_.getNBin() + 1);
     for(int n = 0; n < iceAerosol_.getNBin(); n++) {
-        //Update pdf and volume
-        pdfRef[n] = remapVariable(maskInfo, buffers, pdfRef[n], mask).phi;
-        volume[n] = remapVariable(maskInfo, buffers, volume[n], mask).phi;
+        fields.push_back(&pdfRef[n]);
+        fields.push_back(&volume[n]);
     }
+    fields.push_back(&H2O_);
+    remapOp.applyInPlace(fields);
 
-    //Only update nx and ny of iceAerosol after the loop, otherwise functions will get messed up if we later add other calls in the loop above
+    //Only update nx and ny of iceAerosol after remapping, otherwise functions will get messed up if we later add other calls in between
     iceAerosol_.updateNx(pdfRef[0][0].size());
     iceAerosol_.updateNy(pdfRef[0].size());
 
     //Recalculate VCenters
     iceAerosol_.UpdateCenters(volume, pdfRef);
 
-    //Remap H2O (Set the zeroes to met later)
-    auto H2ORemap = remapVariable(maskInfo, buffers, H2O_, mask);
-    H2O_ = std::move(H2ORemap.phi);
-    
     //Need to update bottom-of-domain altitude before updating coordinates
-    double dy = H2ORemap.dy;
-    double dx = H2ORemap.dx;
-    std::cout << "dx: " << dx << ", dy: " << dy << std::endl;
+    double dy = remapOp.dy();
+    double dx = remapOp.dx();
+    std::cout << "dx: " << dx << ", dy: " << dy << ", nx: " << remapOp.nx() << std::endl;
 
     //Update Coordinates
-    yCoords_ = std::move(H2ORemap.yCoords);
-    xCoords_ = std::move(H2ORemap.xCoords);
+    yCoords_ = remapOp.yCoords();
+    xCoords_ = remapOp.xCoords();
+    xEdges_ = remapOp.xEdges();
     yEdges_.resize(yCoords_.size() + 1);
-    xEdges_.resize(xCoords_.size() + 1);
     std::generate(yEdges_.begin(), yEdges_.end(), [dy, this, j = 0.0]() mutable { return yCoords_[0] + dy*(j++ - 0.5); });
-    std::generate(xEdges_.begin(), xEdges_.end(), [dx, this, i = 0.0]() mutable { return xCoords_[0] + dx*(i++ - 0.5); });
-
-    //Regenerate Met based on new grid 
-    if(!optInput_.MET_LOADMET) {
-        //This way of regenning met is extremely stupid
-        OptInput temp_opt = optInput_;
-        temp_opt.ADV_GRID_NX = xCoords_.size();
-        temp_opt.ADV_GRID_NY = yCoords_.size();
-        temp_opt.ADV_GRID_XLIM_LEFT = -xEdges_[0];
-        temp_opt.ADV_GRID_XLIM_RIGHT = xEdges_[xEdges_.size() - 1];
-        temp_opt.ADV_GRID_YLIM_DOWN = -yEdges_[0];
-        temp_opt.ADV_GRID_YLIM_UP = -yEdges_[yEdges_.size() - 1];
-        AmbientMetParams ambParamsTemp;
-        ambParamsTemp.press_Pa = met_.referencePress();
-        ambParamsTemp.solarTime_h = solarTime_h_;
-        ambParamsTemp.temp_K = met_.tempRef();
-        ambParamsTemp.rhi = met_.rhiRef();
-        ambParamsTemp.shear = met_.shearRef();
-        met_ = Meteorology(temp_opt, ambParamsTemp, yCoords_, yEdges_);
-    }
-    else {
-        met_.regenerate(yCoords_, yEdges_, xCoords_.size());
-    }
+
+    //Regenerate Met based on new grid. Only resamples the column profiles, with or without met input.
+    met_.regenerate(yCoords_, yEdges_, xCoords_.size());
 
     //With new met, set boundary conditions of H2O to ambient.
     //FIXME: Fix this issue with boundary nodes on the H2O
@@ -518,34 +577,44 @@ double LAGRIDPlumeModel::totalAirMass() {
     auto numberMask = iceNumberMask();
     auto& mask = numberMask.first;
     double totalAirMass = 0;
-    double cellArea = (xEdges_[1] - xEdges_[0]) * (yEdges_[1] - yEdges_[0]);
+    Vector_2D cellAreas = VectorUtils::cellAreas(xEdges_, yEdges_);
     double conversion_factor = 1.0e6 * MW_Air / physConst::Na; // molec/cm3 * cm3/m3 * kg/mol * mol/molec = kg/m3
     for(int j = 0; j < yCoords_.size(); j++) {
         for(int i = 0; i < xCoords_.size(); i++) {
-            totalAirMass += mask[j][i] * met_.airMolecDens(j, i) * cellArea * conversion_factor;
+            totalAirMass += mask[j][i] * met_.airMolecDens(j, i) * cellAreas[j][i] * conversion_factor;
         }
     }
     return totalAirMass; // kg/m 
 }
 
 void LAGRIDPlumeModel::runCocipH2OMixing(const Vector_2D& h2o_old, const Vector_2D& h2o_amb_new, MaskType& mask_old, MaskType& mask_new) {
+    //Cells can differ in size when the buffers are coarsened, so the average is area-weighted
+    Vector_2D areas = VectorUtils::cellAreas(xEdges_, yEdges_);
+
     //h2o_old is the actual H2O field of the "before" timestep
     double molec_h2o_old = 0;
     for (int j = 0; j < h2o_old.size(); j++) {
         for (int i = 0; i < h2o_old[0].size(); i++) {
-            molec_h2o_old += mask_old.first[j][i] * h2o_old[j][i];
+            molec_h2o_old += mask_old.first[j][i] * h2o_old[j][i] * areas[j][i];
         }
     }
     //h2o_amb_new is the *ambient met* H2O field of the next timestep
     double molec_h2o_amb_added = 0;
     for (int j = 0; j < h2o_amb_new.size(); j++) {
         for (int i = 0; i < h2o_amb_new[0].size(); i++) {
-            molec_h2o_amb_added += (mask_new.first[j][i] == 1 && mask_old.first[j][i] == 0) * h2o_amb_new[j][i];
+            molec_h2o_amb_added += (mask_new.first[j][i] == 1 && mask_old.first[j][i] == 0) * h2o_amb_new[j][i] * areas[j][i];
+        }
+    }
+
+    double maskArea_new = 0;
+    for (int j = 0; j < areas.size(); j++) {
+        for (int i = 0; i < areas[0].size(); i++) {
+            maskArea_new += mask_new.first[j][i] * areas[j][i];
         }
     }
 
-    double molec_h2o_final = molec_h2o_old + molec_h2o_amb_added; // molec/cm3
-    double average_amb_humidity_final = molec_h2o_final / mask_new.second.count;
+    double molec_h2o_final = molec_h2o_old + molec_h2o_amb_added; // molec/cm3 * m2
+    double average_amb_humidity_final = molec_h2o_final / maskArea_new;
 
     for (int j = 0; j < H2O_.size(); j++)  {
         for (int i = 0; i < H2O_[0].size(); i++) {
@@ -571,7 +640,8 @@ void LAGRIDPlumeModel::createOutputDirectories() {
 }
 
 void LAGRIDPlumeModel::saveTSAerosol() {
-    if ( simVars_.TS_AERO && \
+    //The sweep summary is recorded on the same schedule as the aerosol timeseries files
+    if ( ( simVars_.TS_AERO || summary_ ) && \
         (( simVars_.TS_AERO_FREQ == 0 ) || \
         ( std::fmod((timestepVars_.curr_Time_s - timestepVars_.timeArray[0])/60.0, simVars_.TS_AERO_FREQ) == 0.0E+00 )) ) 
     {
@@ -579,9 +649,52 @@ void LAGRIDPlumeModel::saveTSAerosol() {
         int mm = (int) (timestepVars_.curr_Time_s - timestepVars_.timeArray[0])/60   - 60 * hh;
         int ss = (int) (timestepVars_.curr_Time_s - timestepVars_.timeArray[0])      - 60 * ( mm + 60 * hh );
 
-        Diag::Diag_TS_Phys( simVars_.TS_AERO_FILEPATH.c_str(), hh, mm, ss, \
-                        iceAerosol_, H2O_, xCoords_, yCoords_, xEdges_, yEdges_, met_);
-        std::cout << "Save Complete" << std::endl;    
+        //Double buffering: the previous save is written while this step ran, wait for it before handing over the next one.
+        if ( pendingTSAero_.valid() ) {
+            pendingTSAero_.get();
+        }
+
+        //The I/O thread works on a copy of the saved fields, computing the diagnostics and writing while the time loop carries on.
+        pendingTSAero_ = OutputWriter::Get().Submit(
+            [hh, mm, ss, iceAer = iceAerosol_, H2O = H2O_, xCoords = xCoords_, yCoords = yCoords_,
+             xEdges = xEdges_, yEdges = yEdges_, met = Diag::TSMetFields( met_ ), filePath = simVars_.TS_AERO_FILEPATH,
+             tsAero = simVars_.TS_AERO, append = simVars_.TS_AERO_APPEND, options = tsAeroOptions_,
+             file = &tsAeroFile_, summary = summary_, iCase = input_.Case()] () {
+                if ( tsAero && append ) {
+                    if ( !*file ) {
+                        *file = std::make_unique<Diag::TSPhysFile>( Diag::TSSeriesFileName(filePath), iceAer, options );
+                    }
+                    (*file)->Append( hh, mm, ss, iceAer, H2O, xCoords, yCoords, xEdges, yEdges, met );
+                }
+                else if ( tsAero ) {
+                    Diag::Diag_TS_Phys( filePath.c_str(), hh, mm, ss, \
+                                    iceAer, H2O, xCoords, yCoords, xEdges, yEdges, met, options );
+                }
+                if ( summary ) {
+                    summary->Record( iCase, hh + mm/60.0 + ss/3600.0, iceAer, xCoords, yCoords, xEdges, yEdges );
+                }
+            });
+        std::cout << "Save Queued" << std::endl;    
+    }
+
+}
+
+void LAGRIDPlumeModel::finishTSAerosol() {
+    if ( pendingTSAero_.valid() ) {
+        pendingTSAero_.get();
+    }
+    //Closing the file is a netCDF call too
+    if ( tsAeroFile_ ) {
+        OutputWriter::Get().Run( [this] () { tsAeroFile_.reset(); } );
     }
+}
 
+LAGRIDPlumeModel::~LAGRIDPlumeModel() {
+    //Only does anything if the run was interrupted by an exception
+    try {
+        finishTSAerosol();
+    }
+    catch (const std::exception& e) {
+        std::cout << "Failed to complete aerosol timeseries output: " << e.what() << std::endl;
+    }
 }
\ No newline at end of file
@@ -32,6 +32,7 @@ MPMSimVarsWrapper::MPMSimVarsWrapper(const Input& input, const OptInput& Input_O
 	TS_AERO_FILEPATH(TS_FOLDER + "/" + Input_Opt.TS_AERO_FILENAME),
     TS_AERO_LIST(Input_Opt.TS_AEROSOL),
 	TS_AERO_FREQ(Input_Opt.TS_AERO_FREQ),
+	TS_AERO_APPEND(Input_Opt.TS_AERO_APPEND),
 	SAVE_PL(Input_Opt.PL_PL),
 	SAVE_O3PL(Input_Opt.PL_O3),
 	temperature_K(input.temperature_K()),
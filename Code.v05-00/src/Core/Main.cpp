@@ -17,25 +17,32 @@
 #include <string>
 #include <vector>
 #include <fstream>
+#include <memory>
 #include <cstdio>
 #include <ctime>
 #include <filesystem>
 #include <unistd.h>
 #include <limits.h>
 #include <sys/stat.h>
+#include <stdexcept>
 #include <YamlInputReader/YamlInputReader.hpp>
 #include "Core/Interface.hpp"
 #include "Core/Parameters.hpp"
 #include "Core/Input.hpp"
+#include "Core/InputDatabase.hpp"
 #include "Core/LAGRIDPlumeModel.hpp"
 #include "Core/Status.hpp"
+#include "Core/SweepSummary.hpp"
+#include "KPP/KPP.hpp"
 
 static int DIR_FAIL = -9;
 
 void CreateREADME( const std::string folder, const std::string fileName, \
                    const std::string purpose );
 void CreateStatusOutput(const std::string folder, const int caseNumber, const SimStatus status);
-int PlumeModel( OptInput &Input_Opt, const Input &inputCase );
+int BuildEPMTable( const OptInput &Input_Opt, const std::vector<std::unordered_map<std::string, double> > &parameters );
+SimStatus PlumeModel( OptInput &Input_Opt, const Input &inputCase );
+SimStatus BoxModel( OptInput &Input_Opt, const Input &inputCase );
 
 inline bool exist( const std::string &name )
 {
@@ -52,7 +59,7 @@ int main( int argc, char* argv[])
     unsigned int iCase, nCases;
     const unsigned int iOFFSET = 0;
     
-    const unsigned int model = 1;
+    unsigned int model = 1;
 
     /* Declaring the Input Option object for use in APCEMM */
     OptInput Input_Opt; // Input Option object
@@ -90,6 +97,18 @@ int main( int argc, char* argv[])
 
         YamlInputReader::readYamlInputFile( Input_Opt, INPUT_FILE_PATH.generic_string() );
 
+        /* Thermal rate constant cache, shared by all cases */
+        Set_RCONST_Cache( Input_Opt.CHEMISTRY_RCONST_DT, KPP_RCONST_DLOGM );
+
+        /* Binary copies of the background and engine input files */
+        SetPrecompiledInputs( Input_Opt.SIMULATION_PRECOMPILE_INPUTS );
+
+        /* The adjoint optimization runs on top of the chemistry plume model */
+        if ( Input_Opt.SIMULATION_ADJOINT )
+            model = 2;
+        else if ( Input_Opt.SIMULATION_BOXMODEL )
+            model = 0;
+
         /* Collect parameters and create cases */
         parameters = YamlInputReader::generateCases( Input_Opt );
 
@@ -145,11 +164,21 @@ int main( int argc, char* argv[])
 
     //PARALLEL_CASES = Input_Opt.SIMULATION_PARAMETER_SWEEP;
 
+    /* Only tabulate EPM over the cases, no plume model run */
+    if ( Input_Opt.ADV_EPM_TABLE_BUILD ) {
+        return BuildEPMTable( Input_Opt, parameters );
+    }
+
+    /* Scalar diagnostics of all cases, filled in as the cases run */
+    std::unique_ptr<SweepSummary> summary;
+    if ( !Input_Opt.SIMULATION_SUMMARY_FILENAME.empty() )
+        summary = std::make_unique<SweepSummary>( Input_Opt.SIMULATION_OUTPUT_FOLDER + "/" + Input_Opt.SIMULATION_SUMMARY_FILENAME, parameters );
+
     /* ====================================================================== */
     /* ---- CASE LOOP STARTS HERE ------------------------------------------- */
     /* ====================================================================== */
 
-    #pragma omp parallel for schedule(dynamic, 1) shared(Input_Opt, parameters, nCases) if( PARALLEL_CASES )
+    #pragma omp parallel for schedule(dynamic, 1) shared(Input_Opt, parameters, nCases, summary) if( PARALLEL_CASES )
     for ( iCase = 0; iCase < nCases; iCase++ ) {
 
         unsigned int jCase = iOFFSET + iCase;
@@ -179,13 +208,16 @@ int main( int argc, char* argv[])
         fullPath = fullPath + ".nc";
         fullPath_ADJ = fullPath_ADJ + ".nc";
         fullPath_BOX = fullPath_BOX + ".nc";
-        fullPath_micro = fullPath_micro + ".out";
+        fullPath_micro = fullPath_micro + ( Input_Opt.SIMULATION_MICRO_FORMAT == "binary" ? ".bin" : ".out" );
 
         bool fileExist = 0;
 
         if ( Input_Opt.SIMULATION_ADJOINT ) {
             #pragma omp critical
             { fileExist = exist( fullPath_ADJ ); }
+        } else if ( Input_Opt.SIMULATION_BOXMODEL ) {
+            #pragma omp critical
+            { fileExist = exist( fullPath_BOX ); }
         } else {
             #pragma omp critical
             { fileExist = exist( fullPath ); }
@@ -219,23 +251,23 @@ int main( int argc, char* argv[])
                 /* Box Model */
                 case 0:
 
-                    std::cout << "Not implemented yet" << std::endl;
+                    case_status = BoxModel( Input_Opt, inputCase );
                     break;
 
                 /* Plume Model (APCEMM) */
                 case 1: {
                     std::cout << "running epm... " << std::endl;
-                    LAGRIDPlumeModel LAGRID_Model(Input_Opt, inputCase);
+                    LAGRIDPlumeModel LAGRID_Model(Input_Opt, inputCase, summary.get());
                     case_status = LAGRID_Model.runFullModel();
                     // iERR = PlumeModel( Input_Opt, inputCase );
                     break;
                     
                 }
 
-                /* Adjoint Model */
+                /* Plume Model + Adjoint Model */
                 case 2:
 
-                    std::cout << "Not implemented yet" << std::endl;
+                    case_status = PlumeModel( Input_Opt, inputCase );
                     break;
 
                 case 3:
@@ -281,6 +313,9 @@ int main( int argc, char* argv[])
                 CreateStatusOutput(Input_Opt.SIMULATION_OUTPUT_FOLDER, iCase, case_status);
             }
 
+            if ( summary )
+                summary->SetStatus( iCase, case_status );
+
         }
 
     }
@@ -289,6 +324,9 @@ int main( int argc, char* argv[])
     /* ---- CASE LOOP ENDS HERE --------------------------------------------- */
     /* ====================================================================== */
    
+    /* Close the summary file */
+    summary.reset();
+
     std::cout << "\n All cases have been completed!" << std::endl;
 
     /* ====================================================================== */
@@ -417,4 +455,46 @@ void CreateStatusOutput(const std::string folder, const int caseNumber, const Si
 
 } /* End of CreateStatusOutput */
 
+int BuildEPMTable( const OptInput &Input_Opt, const std::vector<std::unordered_map<std::string, double> > &parameters )
+{
+
+    /* The parameter sweep defines the table grid: EPM is run once per case,
+     * cases only differing in parameters EPM doesn't depend on are tabulated once. */
+    const unsigned int nCases = parameters.size();
+    std::vector<EPM::ResponseSurface::Point> points( nCases );
+    std::vector<EPM::ResponseSurface::NodeResult> results( nCases );
+    std::vector<std::string> contexts( nCases );
+
+    #pragma omp parallel for schedule(dynamic, 1) if( PARALLEL_CASES )
+    for ( unsigned int iCase = 0; iCase < nCases; iCase++ ) {
+
+        std::stringstream ss_micro;
+        ss_micro << std::setw(6) << std::setfill('0') << iCase;
+        const std::string fullPath_micro = Input_Opt.SIMULATION_OUTPUT_FOLDER + "/Micro" + ss_micro.str() \
+                                         + ( Input_Opt.SIMULATION_MICRO_FORMAT == "binary" ? ".bin" : ".out" );
+        const Input inputCase( iCase, parameters, "", "", "", fullPath_micro, "" );
+
+        LAGRIDPlumeModel LAGRID_Model( Input_Opt, inputCase );
+        std::tie( points[iCase], results[iCase] ) = LAGRID_Model.runEPMForTable();
+        contexts[iCase] = LAGRID_Model.epmTableContext();
+
+        #pragma omp critical
+        { std::cout << " EPM table case " << iCase << " done." << std::endl; }
+    }
+
+    /* Inputs that aren't table axes can't vary across the sweep */
+    for ( unsigned int iCase = 1; iCase < nCases; iCase++ ) {
+        if ( contexts[iCase] != contexts[0] ) {
+            throw std::invalid_argument( "BuildEPMTable: case " + std::to_string(iCase) + " differs from case 0 in EPM inputs that aren't tabulated:\n  " \
+                                         + contexts[iCase] + "\n  " + contexts[0] );
+        }
+    }
+
+    const EPM::ResponseSurface table( points, results, contexts[0] );
+    table.write( Input_Opt.ADV_EPM_TABLE_FILE );
+    std::cout << " EPM table with " << table.size() << " nodes written to " << Input_Opt.ADV_EPM_TABLE_FILE << std::endl;
+    return 0;
+
+} /* End of BuildEPMTable */
+
 /* End of Main.cpp */
@@ -0,0 +1,107 @@
+#include <mutex>
+#include <stdexcept>
+#include <netcdf>
+#include "Core/MetDataset.hpp"
+#include "Core/OutputWriter.hpp"
+
+using namespace netCDF;
+using namespace netCDF::exceptions;
+
+namespace {
+    /* Variables read from the met input file besides altitude and pressure */
+    const char* const METVARS[] = { "temperature", "relative_humidity_ice", "shear", "w" };
+}
+
+std::shared_ptr<const MetDataset> MetDataset::Get( const std::string &fileName )
+{
+
+    /* The lock is held while the file is read on the I/O thread, so each
+     * file is only read once. Later cases only pay for the lookup. */
+    static std::mutex registryMutex;
+    static std::map<std::string, std::shared_ptr<const MetDataset>> registry;
+
+    std::lock_guard<std::mutex> lock( registryMutex );
+    auto it = registry.find( fileName );
+    if ( it != registry.end() )
+        return it->second;
+
+    std::shared_ptr<const MetDataset> dataset;
+    OutputWriter::Get().Run( [&] () { dataset.reset( new MetDataset( fileName ) ); } );
+    registry.emplace( fileName, dataset );
+    return dataset;
+
+} /* End of MetDataset::Get */
+
+MetDataset::MetDataset( const std::string &fileName ):
+    fileName_( fileName ),
+    timeDim_( 0 )
+{
+
+    NcFile dataFile;
+    try {
+        dataFile.open( fileName.c_str(), NcFile::read );
+    }
+    catch ( NcException &e ) {
+        throw std::runtime_error("Could not open met input file " + fileName);
+    }
+
+    /*
+        Met data format:
+        2 dimensions: altitude and time
+        RHw, Temp, Shear given as time series.
+    */
+    try {
+        const int altitudeDim = dataFile.getDim("altitude").getSize();
+        timeDim_ = dataFile.getDim("time").getSize();
+
+        altitude_.resize( altitudeDim );
+        pressure_.resize( altitudeDim );
+        dataFile.getVar("altitude").getVar( altitude_.data() );
+        dataFile.getVar("pressure").getVar( pressure_.data() );
+
+        for ( int i = 0; i < altitudeDim; i++ ) {
+            pressure_[i] *= 100.0; //convert from hPa to Pa
+            altitude_[i] *= 1000.0; //convert from km to m
+        }
+    }
+    catch ( NcException &e ) {
+        throw std::runtime_error("Could not parse altitude and pressure data from specified met input file");
+    }
+
+    for ( const char* varName: METVARS ) {
+        NcVar ncvar = dataFile.getVar( varName );
+        if ( ncvar.isNull() )
+            continue;
+
+        try {
+            Profile profile;
+            profile.timeseries = ( ncvar.getDimCount() == 2 );
+            const int nTime = profile.timeseries ? timeDim_ : 1;
+            Vector_1D flat( altitude_.size() * nTime );
+            ncvar.getVar( flat.data() );
+
+            profile.data.assign( altitude_.size(), Vector_1D( nTime ) );
+            for ( UInt i = 0; i < altitude_.size(); i++ ) {
+                for ( int itime = 0; itime < nTime; itime++ )
+                    profile.data[i][itime] = flat[i*nTime + itime];
+            }
+            profiles_.emplace( varName, std::move( profile ) );
+        }
+        catch ( NcException &e ) {
+            throw std::runtime_error("Could not parse variable \"" + std::string( varName ) + "\" from specified met input file");
+        }
+    }
+
+} /* End of MetDataset::MetDataset */
+
+const MetDataset::Profile& MetDataset::profile( const std::string &varName ) const
+{
+
+    auto it = profiles_.find( varName );
+    if ( it == profiles_.end() )
+        throw std::runtime_error("Variable \"" + varName + "\" not found in met input file " + fileName_);
+    return it->second;
+
+} /* End of MetDataset::profile */
+
+/* End of MetDataset.cpp */
@@ -12,7 +12,6 @@
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "Core/Meteorology.hpp"
-#include "Util/MC_Rand.hpp"
 
 Meteorology::Meteorology( const OptInput &optInput,
                           const AmbientMetParams& ambParams,
@@ -31,6 +30,7 @@ Meteorology::Meteorology( const OptInput &optInput,
     interpShear_(optInput.MET_INTERPSHEARDATA),
     interpVertVeloc_(optInput.MET_INTERPVERTVELOC),
     turbTempPertAmplitude_(optInput.MET_TEMP_PERTURB_AMPLITUDE),
+    turbTempPertKey_(randKey(optInput.SIMULATION_RANDOM_SEED)),
     rhi_far_(optInput.MET_SUBSAT_RHI)
 {
 
@@ -71,59 +71,22 @@ Meteorology::Meteorology( const OptInput &optInput,
 
     diurnalPert_ = diurnalAmplitude_ * cos( 2.0E+00 * physConst::PI * ( ambParams_.solarTime_h - diurnalPhase_ ) / 24.0E+00 );
 
-    //Declare met input file here, keeps ownership of file to constructor only.
-    //Dont want to deal with using a ptr and worry about what functions deference it.
-    NcFile dataFile;
+    //The file is only read by the first case to ask for it, later cases share the decoded profiles.
     if( optInput.MET_LOADMET ) {
-        dataFile.open( optInput.MET_FILENAME.c_str(), NcFile::read );
+        metData_ = MetDataset::Get( optInput.MET_FILENAME );
     }
 
-    try {
-        initAltitudeAndPress( dataFile );
-    }
-    catch (NcException& e) {
-        throw std::runtime_error("Could not parse altitude and pressure data from specified met input file");
-    }
-
-    try {
-        initTemperature( dataFile );
-    }
-    catch (NcException& e) {
-        throw std::runtime_error("Could not parse temperature data from specified met input file");
-    }
-
-    try {
-        initH2O( dataFile, optInput );
-    }
-    catch (NcException& e) {
-        throw std::runtime_error("Could not parse relative humidity data from specified met input file");
-    }
-
-    try {
-        initShear( dataFile );
-    }
-    catch (NcException& e) {
-        throw std::runtime_error("Could not parse shear data from specified met input file");
-    }
-
-    try {
-        initVertVeloc( dataFile );
-    }
-    catch (NcException& e) {
-        throw std::runtime_error("Could not parse vertical velocity data from specified met input file");
-    }
-
-
-    double invkB = 1.00E-06 / physConst::kB;
-
-    #pragma omp parallel for if ( !PARALLEL_CASES ) 
-    for (int jNy = 0; jNy < ny_; jNy++ ) {
-        airMolecDens_[jNy].assign(nx_, pressure_[jNy] / tempBase_[jNy] * invkB);
-    }
+    initAltitudeAndPress();
+    initTemperature();
+    initH2O( optInput );
+    initShear();
+    initVertVeloc();
 
 } /* End of Meteorology::Meteorology */
 
 void Meteorology::regenerate( const Vector_1D& yCoord_new, const Vector_1D& yEdges_new, int nx_new ) {
+    //Only the column profiles are resampled, the 2D fields are rebuilt on demand.
+    //The perturbation field doesn't map onto the new grid and is dropped until the next updateTempPerturb.
     double dy_new = yEdges_new[1] - yEdges_new[0];
     int ny_new = yCoord_new.size();
     double alt_y0 = altitudeEdges_[0] + (yEdges_new[0] - yEdges_[0]);
@@ -139,10 +102,9 @@ void Meteorology::regenerate( const Vector_1D& yCoord_new, const Vector_1D& yEdg
     met::ISA(altEdges_new, pressEdges_new);
 
     tempBase_.resize(ny_new);
-    tempTotal_ = Vector_2D(ny_new, Vector_1D(nx_new));
-    tempPerturbation_ = Vector_2D(ny_new, Vector_1D(nx_new));
-    H2O_ = Vector_2D(ny_new, Vector_1D(nx_new));
-    airMolecDens_ = Vector_2D(ny_new, Vector_1D(nx_new));
+    H2OColumn_.resize(ny_new);
+    tempPerturbation_.clear();
+    invalidateFields();
     shear_.resize(ny_new);
     yCoords_ = yCoord_new;
     yEdges_ = yEdges_new;
@@ -162,10 +124,9 @@ void Meteorology::regenerate( const Vector_1D& yCoord_new, const Vector_1D& yEdg
     }
     else {
         for(int j = 0; j < ny_new; j++) {
-            int i_Z = met::nearestNeighbor( altitudeInit_, alt_new[j]);
-            double tempInterp = met::linInterpMetData(altitudeInit_, tempInit_, alt_new[j]);
+            int i_Z = met::nearestNeighbor( metData_->altitude(), alt_new[j]);
+            double tempInterp = met::linInterpMetData(metData_->altitude(), tempInit_, alt_new[j]);
             tempBase_[j] = interpTemp_ ? tempInterp : tempInit_[i_Z];
-            tempTotal_[j].assign(nx_new, tempBase_[j]);
         }
     }
     
@@ -175,21 +136,21 @@ void Meteorology::regenerate( const Vector_1D& yCoord_new, const Vector_1D& yEdg
     }
     else {
         for(int j = 0; j < ny_new; j++) {
-            int i_Z = met::nearestNeighbor( altitudeInit_, alt_new[j]);
-            double rhiInterp = met::linInterpMetData(altitudeInit_, rhiInit_, alt_new[j]);
+            int i_Z = met::nearestNeighbor( metData_->altitude(), alt_new[j]);
+            double rhiInterp = met::linInterpMetData(metData_->altitude(), rhiInit_, alt_new[j]);
             double rhiToUse = interpRH_ ? rhiInterp : rhiInit_[i_Z];
-            H2O_[j].assign(nx_new, physFunc::RHiToH2O(rhiToUse, tempBase_[j]));
+            H2OColumn_[j] = physFunc::RHiToH2O(rhiToUse, tempBase_[j]);
         }
     }
 
     // Regenerate shear
     for ( int j = 0;  j < ny_new; j++ ) {
-        int i_Z = met::nearestNeighbor( altitudeInit_, alt_new[j]);
         if(shearLoadType_ == MetVarLoadType::NoMetInput) {
             shear_[j] = ambParams_.shear;
         }
         else {
-            double shear_local = met::linInterpMetData(altitudeInit_, shearInit_, alt_new[j]);
+            int i_Z = met::nearestNeighbor( metData_->altitude(), alt_new[j]);
+            double shear_local = met::linInterpMetData(metData_->altitude(), shearInit_, alt_new[j]);
             shear_[j] = interpShear_ ? shear_local : shearInit_[i_Z];
         }
     }
@@ -197,12 +158,36 @@ void Meteorology::regenerate( const Vector_1D& yCoord_new, const Vector_1D& yEdg
     // Regenerate vert veloc
     if(vertVelocLoadType_ != MetVarLoadType::NoMetInput) {
         for ( int j = 0;  j < ny_new; j++ ) {
-            int i_Z = met::nearestNeighbor( altitudeInit_, alt_new[j]);
-            double w_local = met::linInterpMetData(altitudeInit_, vertVelocInit_, alt_new[j]);
+            int i_Z = met::nearestNeighbor( metData_->altitude(), alt_new[j]);
+            double w_local = met::linInterpMetData(metData_->altitude(), vertVelocInit_, alt_new[j]);
             vertVeloc_[j] = interpVertVeloc_ ? w_local : vertVelocInit_[i_Z];
         }
     }
-    updateAirMolecDens();
+}
+
+const Vector_2D& Meteorology::Temp() const {
+    if( !tempFieldValid_ ) {
+        tempTotal_.resize(ny_);
+        for ( int j = 0; j < ny_; j++ ) {
+            tempTotal_[j].resize(nx_);
+            for ( int i = 0; i < nx_; i++ ) {
+                tempTotal_[j][i] = temp(j, i);
+            }
+        }
+        tempFieldValid_ = true;
+    }
+    return tempTotal_;
+}
+
+const Vector_2D& Meteorology::H2O_field() const {
+    if( !H2OFieldValid_ ) {
+        H2O_.resize(ny_);
+        for ( int j = 0; j < ny_; j++ ) {
+            H2O_[j].assign(nx_, H2OColumn_[j]);
+        }
+        H2OFieldValid_ = true;
+    }
+    return H2O_;
 }
 
 void Meteorology::Update( const double dt, const double solarTime_h, \
@@ -227,10 +212,10 @@ void Meteorology::Update( const double dt, const double solarTime_h, \
     updateTemperature(solarTime_h, simTime_h);
     updateShear(simTime_h);
     updateH2O(simTime_h);
-    updateAirMolecDens();
+    invalidateFields();
 } /* End of Meteorology::UpdateMet */
 
-void Meteorology::initAltitudeAndPress( const NcFile& dataFile ) {
+void Meteorology::initAltitudeAndPress() {
     //Must call this before the other initialize functions!
     if( !useMetFileInput_ ) {
             
@@ -247,32 +232,6 @@ void Meteorology::initAltitudeAndPress( const NcFile& dataFile ) {
         return;
     }
 
-    /*
-        Met data format:
-        2 dimensions: altitude and time
-        RHw, Temp, Shear given as time series.
-    */
-
-    /* Identify the length of variables in input file */
-    altitudeDim_ = dataFile.getDim("altitude").getSize();
-    timeDim_ = dataFile.getDim("time").getSize();
-
-    /* Extract pressure and altitude from input file. */
-    altitudeInit_.resize(altitudeDim_);
-    pressureInit_.resize(altitudeDim_);
-
-    //The netcdf API is garbage and makes you pass in a C style array despite being branded as a "C++" library
-    NcVar altitude_ncVar = dataFile.getVar("altitude");
-    NcVar pressure_ncVar = dataFile.getVar("pressure");
-    altitude_ncVar.getVar(altitudeInit_.data());
-    pressure_ncVar.getVar(pressureInit_.data());
-
-    //Cache initial pressure and altitude values for generating later met vars.
-    for (int i = 0; i < altitudeDim_; i++ ) {
-        pressureInit_[i] *= 100.0; //convert from hPa to Pa
-        altitudeInit_[i] *= 1000.0; //convert from km to m
-    }
-
     for ( int j = 0; j < ny_; j++ ) {
         altitude_[j] = altitudeRef_ + yCoords_[j];
     }
@@ -285,29 +244,12 @@ void Meteorology::initAltitudeAndPress( const NcFile& dataFile ) {
     i_Zp_ = met::nearestNeighbor( pressure_, pressureRef_); 
 }
 
-void Meteorology::readMetVar( const NcFile& dataFile, std::string varName, Vector_2D& vec_ts, bool timeseries) {
-    NcVar ncvar = dataFile.getVar(varName.c_str());
-    bool supportsTimeseries = ncvar.getDimCount() == 2;
-    if( !supportsTimeseries && timeseries ) {
+const Vector_2D& Meteorology::metProfile( const std::string& varName, bool timeseries ) const {
+    const MetDataset::Profile& profile = metData_->profile(varName);
+    if( !profile.timeseries && timeseries ) {
         throw std::runtime_error("Variable\"" + varName + "\" in met input file does not support time series input! Please set the corresponding time series input option to false.");
     }
-    int dataLength = supportsTimeseries ? altitudeDim_ * timeDim_ : altitudeDim_;
-    double data[dataLength]; //flattened array to hold values for all altitude and time
-    ncvar.getVar(data);
-
-    vec_ts = Vector_2D(altitudeDim_, Vector_1D(timeDim_, 0));
-    
-
-    for ( int i = 0; i < altitudeDim_; i++ ) {
-        for ( int itime = 0; itime < timeDim_; itime++ ) {
-            int data_idx;
-
-            if(!supportsTimeseries) data_idx = i;
-            else data_idx = timeseries ? i*timeDim_ + itime : i*timeDim_; 
-
-            vec_ts[i][itime] = data[data_idx];
-        }
-    }
+    return profile.data;
 }
 
 void Meteorology::initTempNoMet (const Vector_1D& yCoords) {
@@ -316,22 +258,16 @@ void Meteorology::initTempNoMet (const Vector_1D& yCoords) {
         //Convention: lower altitude than reference= negative y, higher = positive y
         double temp_local = ambParams_.temp_K + yCoords[j] * lapseRate_ + diurnalPert_;
         tempBase_[j] = temp_local;
-        tempTotal_[j].assign(nx_, tempBase_[j]);
     }
 }
-void Meteorology::initTemperature( const NcFile& dataFile ) {
+void Meteorology::initTemperature() {
 
     if ( tempLoadType_ == MetVarLoadType::NoMetInput ) {
         initTempNoMet(yCoords_);
         return;
     }
 
-    readMetVar(dataFile, "temperature", tempTimeseriesData_, tempLoadType_ == MetVarLoadType::TimeSeries); 
-    
-    tempInit_.resize(altitudeDim_);
-    for (int i = 0; i < altitudeDim_; i++) {
-        tempInit_[i] = tempTimeseriesData_[i][0];
-    }
+    tempInit_ = interpMetTimeseriesData(0.0, metProfile("temperature", tempLoadType_ == MetVarLoadType::TimeSeries), false);
 
     /* Identify closest temperature to given pressure */
     /* Loop round each vertical layer to estimate temperature */
@@ -340,10 +276,9 @@ void Meteorology::initTemperature( const NcFile& dataFile ) {
     for ( int j = 0; j < ny_; j++ ) {
 
         /* Find the closest values above and below the central pressure */
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[j]);
-        double tempInterp = met::linInterpMetData(altitudeInit_, tempInit_, altitude_[j]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[j]);
+        double tempInterp = met::linInterpMetData(metData_->altitude(), tempInit_, altitude_[j]);
         tempBase_[j] = interpTemp_ ? tempInterp : tempInit_[i_Z];
-        tempTotal_[j].assign(nx_, tempBase_[j]);
     }
 }
 
@@ -364,11 +299,11 @@ void Meteorology::initH2ONoMet (const Vector_1D& yCoords) {
         double H2O_local = yCoords[j] > moist_layer_bot_y && yCoords[j] < moist_layer_top_y
                             ? physFunc::RHiToH2O(RH_star, tempBase_[j])
                             : physFunc::RHiToH2O(RH_far, tempBase_[j]);
-        H2O_[j].assign(nx_, H2O_local);
+        H2OColumn_[j] = H2O_local;
     }
 }
 
-void Meteorology::initH2O( const NcFile& dataFile, const OptInput& optInput ) { 
+void Meteorology::initH2O( const OptInput& optInput ) { 
     //Cannot call this before initTemperature!
 
     if( rhLoadType_ == MetVarLoadType::NoMetInput ) {
@@ -376,20 +311,20 @@ void Meteorology::initH2O( const NcFile& dataFile, const OptInput& optInput ) {
         return;
     }
 
-    readMetVar(dataFile, "relative_humidity_ice", rhiTimeseriesData_, rhLoadType_ == MetVarLoadType::TimeSeries); 
+    const Vector_2D& rhiTimeseriesData = metProfile("relative_humidity_ice", rhLoadType_ == MetVarLoadType::TimeSeries);
+    const int altitudeDim = metData_->altitudeDim();
+    rhiInit_.resize(altitudeDim);
     
-    rhiInit_.resize(altitudeDim_);
-    
-    for (int i = 0; i < altitudeDim_; i++) {
+    for (int i = 0; i < altitudeDim; i++) {
         //Scale RHi if specified
         if (optInput.MET_HUMIDSCAL_MODIFICATION_SCHEME == "scaling") {
-            rhiInit_[i] = met::rhiCorrection(rhiTimeseriesData_[i][0], optInput.MET_HUMIDSCAL_SCALING_A, optInput.MET_HUMIDSCAL_SCALING_B);
+            rhiInit_[i] = met::rhiCorrection(rhiTimeseriesData[i][0], optInput.MET_HUMIDSCAL_SCALING_A, optInput.MET_HUMIDSCAL_SCALING_B);
         }
         else if (optInput.MET_HUMIDSCAL_MODIFICATION_SCHEME == "constant") {
             rhiInit_[i] = optInput.MET_HUMIDSCAL_CONST_RHI;
         }
         else {
-            rhiInit_[i] = rhiTimeseriesData_[i][0];
+            rhiInit_[i] = rhiTimeseriesData[i][0];
         }
     }
     Vector_1D localRHi(ny_);
@@ -401,12 +336,12 @@ void Meteorology::initH2O( const NcFile& dataFile, const OptInput& optInput ) {
     for ( int jNy = 0; jNy < ny_; jNy++ ) {
 
         /* Find the closest values above and below the central pressure */
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[jNy]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[jNy]);
 
-        double rhiInterp = met::linInterpMetData(altitudeInit_, rhiInit_, altitude_[jNy]);
+        double rhiInterp = met::linInterpMetData(metData_->altitude(), rhiInit_, altitude_[jNy]);
         double rhiToUse = interpRH_ ? rhiInterp : rhiInit_[i_Z];
         localRHi[jNy] = rhiToUse;
-        H2O_[jNy].assign(nx_, physFunc::RHiToH2O(rhiToUse, tempBase_[jNy]));
+        H2OColumn_[jNy] = physFunc::RHiToH2O(rhiToUse, tempBase_[jNy]);
 
     }
 
@@ -430,64 +365,64 @@ void Meteorology::initH2O( const NcFile& dataFile, const OptInput& optInput ) {
     }
 }
 
-void Meteorology::initShear ( const NcFile& dataFile ) {
+void Meteorology::initShear () {
 
     if ( shearLoadType_ == MetVarLoadType::NoMetInput ) {
         shear_.assign(ny_, ambParams_.shear);
         return;
     }
 
-    readMetVar(dataFile, "shear", shearTimeseriesData_, shearLoadType_ == MetVarLoadType::TimeSeries); 
-    shearInit_.resize(altitudeDim_);
-    for (int i = 0; i < altitudeDim_; i++) {
-        shearInit_[i] = shearTimeseriesData_[i][0];
-    }
+    shearInit_ = interpMetTimeseriesData(0.0, metProfile("shear", shearLoadType_ == MetVarLoadType::TimeSeries), false);
 
     for ( int jNy = 0;  jNy < ny_; jNy++ ) {
 
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[jNy]);
-        double shear_local = met::linInterpMetData(altitudeInit_, shearInit_, altitude_[jNy]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[jNy]);
+        double shear_local = met::linInterpMetData(metData_->altitude(), shearInit_, altitude_[jNy]);
         shear_[jNy] = interpShear_ ? shear_local : shearInit_[i_Z];
 
     }
 }
 
-void Meteorology::initVertVeloc ( const NcFile& dataFile ) {
+void Meteorology::initVertVeloc () {
     if ( vertVelocLoadType_ == MetVarLoadType::NoMetInput ) {
         vertVeloc_.assign(ny_, 0);
         return;
     }
 
     //Vert veloc is assumed default as timeseries input.
-    readMetVar(dataFile, "w", vertVelocTimeseriesData_, vertVelocLoadType_ == MetVarLoadType::TimeSeries);
-    
-    vertVelocInit_.resize(altitudeDim_);
-    for (int i = 0; i < altitudeDim_; i++) {
-        vertVelocInit_[i] = vertVelocTimeseriesData_[i][0];
-    }
+    vertVelocInit_ = interpMetTimeseriesData(0.0, metProfile("w", vertVelocLoadType_ == MetVarLoadType::TimeSeries), false);
 
     for ( int jNy = 0;  jNy < ny_; jNy++ ) {
 
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[jNy]);
-        double w_local = met::linInterpMetData(altitudeInit_, vertVelocInit_, altitude_[jNy]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[jNy]);
+        double w_local = met::linInterpMetData(metData_->altitude(), vertVelocInit_, altitude_[jNy]);
         vertVeloc_[jNy] = interpVertVeloc_ ? w_local : vertVelocInit_[i_Z];
     }
 }
 
 Vector_1D Meteorology::interpMetTimeseriesData(double simTime_h, const Vector_2D& ts_data, bool timeseries) const {
 
-    int itime = timeseries 
-              ? std::min(static_cast<int>(simTime_h / met_dt_h_), timeDim_ - 1)
-              : 0;
+    const int altitudeDim = ts_data.size();
+    Vector_1D interp(altitudeDim);
+
+    //Profiles without time series input are held at their first entry.
+    if ( !timeseries ) {
+        for ( int i = 0; i < altitudeDim; i++ ) {
+            interp[i] = ts_data[i][0];
+        }
+        return interp;
+    }
+
+    const int timeDim = metData_->timeDim();
+    int itime = std::min(static_cast<int>(simTime_h / met_dt_h_), timeDim - 1);
 
     double before;
     double after;
-    Vector_1D interp(altitudeDim_);
 
     /* Extract temperature data before and after current time, and interpolate */
-    for ( int i = 0; i < altitudeDim_; i++ ) {
+    for ( int i = 0; i < altitudeDim; i++ ) {
         before = ts_data[i][itime];
-        if ( itime >= timeDim_ - 1 ) {
+        if ( itime >= timeDim - 1 ) {
             std::cout <<  "WARNING: Simulation time exceeded extent of timeseries data. Using last entry provided in timeseries data." << std::endl;
             after = ts_data[i][itime];
         }
@@ -509,25 +444,17 @@ void Meteorology::updateTemperature(double solarTime_h, double simTime_h) {
         #pragma omp parallel for if(!PARALLEL_CASES)
         for (int j = 0; j < ny_; j++ ) {
             tempBase_[j] += deltaDiurnalPert;
-            /* Unit check: Y [m] * LapseRate [K/m] */
-            for (int i = 0; i < nx_; i++ ) {
-                tempTotal_[j][i] = tempBase_[j] + tempPerturbation_[j][i];
-            }
         }
         return;
     }
     bool timeseries = (tempLoadType_ == MetVarLoadType::TimeSeries);
-    tempInit_ = interpMetTimeseriesData(simTime_h, tempTimeseriesData_, timeseries);
+    tempInit_ = interpMetTimeseriesData(simTime_h, metProfile("temperature", timeseries), timeseries);
 
     #pragma omp parallel for if (!PARALLEL_CASES)
     for ( int j = 0; j < ny_; j++ ) {
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[j] );
-        double temp_local = met::linInterpMetData(altitudeInit_, tempInit_, altitude_[j]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[j] );
+        double temp_local = met::linInterpMetData(metData_->altitude(), tempInit_, altitude_[j]);
         tempBase_[j] = interpTemp_ ? temp_local : tempInit_[i_Z];
-        for ( int i = 0; i < nx_; i++ ) {
-            tempTotal_[j][i] =  tempBase_[j] + tempPerturbation_[j][i];
-        }
-
     }
 
 }
@@ -539,14 +466,15 @@ void Meteorology::updateH2O(double simTime_h) {
         if RH timeseries is not specified, the RH field will not be changed by the update function.
      */
     if (rhLoadType_ == MetVarLoadType::NoMetInput) return;
-    rhiInit_ = interpMetTimeseriesData(simTime_h, rhiTimeseriesData_, true);
+    bool timeseries = (rhLoadType_ == MetVarLoadType::TimeSeries);
+    rhiInit_ = interpMetTimeseriesData(simTime_h, metProfile("relative_humidity_ice", timeseries), timeseries);
 
     #pragma omp parallel for if (!PARALLEL_CASES)
     for ( int j = 0; j < ny_; j++ ) {
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[j] );
-        double rh_local = met::linInterpMetData(altitudeInit_, rhiInit_, altitude_[j]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[j] );
+        double rh_local = met::linInterpMetData(metData_->altitude(), rhiInit_, altitude_[j]);
         double h2o_local = physFunc::RHiToH2O(rh_local, tempBase_[j]);
-        H2O_[j].assign(nx_, h2o_local);
+        H2OColumn_[j] = h2o_local;
     }
 }
 
@@ -555,11 +483,11 @@ void Meteorology::updateShear(double simTime_h) {
     if( shearLoadType_ == MetVarLoadType::NoMetInput )  return;
 
     bool timeseries = (shearLoadType_ == MetVarLoadType::TimeSeries);
-    shearInit_ = interpMetTimeseriesData(simTime_h, shearTimeseriesData_, timeseries);
+    shearInit_ = interpMetTimeseriesData(simTime_h, metProfile("shear", timeseries), timeseries);
 
     for ( int jNy = 0; jNy < ny_; jNy++ ) {
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[jNy] );
-        double shear_local = met::linInterpMetData(altitudeInit_, shearInit_, altitude_[jNy]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[jNy] );
+        double shear_local = met::linInterpMetData(metData_->altitude(), shearInit_, altitude_[jNy]);
         shear_[jNy] = interpShear_ ? shear_local : shearInit_[i_Z];
 
     }
@@ -569,38 +497,36 @@ void Meteorology::updateVertVeloc(double simTime_h) {
     if( vertVelocLoadType_ == MetVarLoadType::NoMetInput )  return;
 
     bool timeseries = (vertVelocLoadType_ == MetVarLoadType::TimeSeries);
-    vertVelocInit_ = interpMetTimeseriesData(simTime_h, vertVelocTimeseriesData_, timeseries);
+    vertVelocInit_ = interpMetTimeseriesData(simTime_h, metProfile("w", timeseries), timeseries);
 
     for ( int jNy = 0; jNy < ny_; jNy++ ) {
-        int i_Z = met::nearestNeighbor( altitudeInit_, altitude_[jNy] );
-        double w_local = met::linInterpMetData(altitudeInit_, vertVelocInit_, altitude_[jNy]);
+        int i_Z = met::nearestNeighbor( metData_->altitude(), altitude_[jNy] );
+        double w_local = met::linInterpMetData(metData_->altitude(), vertVelocInit_, altitude_[jNy]);
         vertVeloc_[jNy] = interpVertVeloc_ ? w_local : vertVelocInit_[i_Z];
 
     }
 }
 
-void Meteorology::updateTempPerturb() {
+void Meteorology::updateTempPerturb( const UInt iCase, const UInt iStep ) {
+    if( tempPerturbation_.empty() ) {
+        tempPerturbation_.assign(ny_, Vector_1D(nx_, 0));
+    }
+    const RandKey key = turbTempPertKey_;
     #pragma omp parallel for\
     if(!PARALLEL_CASES) \
     default(shared)
     for (int j = 0; j < ny_; j++){
+        double* row = tempPerturbation_[j].data();
+        //Both numbers of a cell come from one draw keyed by (cell, step, case): no shared generator state
+        #pragma omp simd
         for(int i = 0; i < nx_; i++){
-            double epsilon1 = fRand(-1.0, 1.0);
-            double epsilon2 = fRand(-1.0, 1.0);
-            tempPerturbation_[j][i] = epsilon1 * epsilon2 * turbTempPertAmplitude_;
+            const RandCounter words = philox4x32({ (std::uint32_t) i, (std::uint32_t) j, iStep, iCase }, key);
+            double epsilon1 = -1.0 + 2.0 * uniform01(words[0], words[1]);
+            double epsilon2 = -1.0 + 2.0 * uniform01(words[2], words[3]);
+            row[i] = epsilon1 * epsilon2 * turbTempPertAmplitude_;
         }
     }
-}
-
-void Meteorology::updateAirMolecDens() {
-    double invkB = 1.00E-06 / physConst::kB;
-    #pragma omp parallel for        \
-    if      ( !PARALLEL_CASES ) \
-    default ( shared          )
-    for ( int jNy = 0; jNy < ny_; jNy++ ) {
-        for ( int iNx = 0; iNx < nx_; iNx++ )
-            airMolecDens_[jNy][iNx] = pressure_[jNy] / tempTotal_[jNy][iNx] * invkB;
-    }
+    tempFieldValid_ = false;
 }
 
 void Meteorology::vertAdvectAltPress(double dt) {
@@ -626,7 +552,7 @@ void Meteorology::vertAdvectAltPress(double dt) {
     met::ISA(altitudeRef_ + dp, p_jp1);
     double dp_dz = (p_jm2 - 8*p_jm1 + 8*p_jp1 - p_jp2) / (12 * dp);
 
-    double w_local = met::linInterpMetData(altitudeInit_, vertVelocInit_, altitudeRef_);    //dp/dt = dp/dz * dz/dt [Pa/s]
+    double w_local = met::linInterpMetData(metData_->altitude(), vertVelocInit_, altitudeRef_);    //dp/dt = dp/dz * dz/dt [Pa/s]
 
     double omega = dp_dz * w_local;
 
@@ -0,0 +1,84 @@
+#include "Core/OutputWriter.hpp"
+
+OutputWriter& OutputWriter::Get()
+{
+
+    static OutputWriter writer;
+    return writer;
+
+} /* End of OutputWriter::Get */
+
+OutputWriter::OutputWriter():
+    queue_( std::make_shared<Queue>() )
+{
+
+    thread_ = std::thread( &OutputWriter::Loop, queue_ );
+
+} /* End of OutputWriter::OutputWriter */
+
+OutputWriter::~OutputWriter()
+{
+
+    /* Jobs still queued are run before the thread exits */
+    {
+        std::lock_guard<std::mutex> lock( queue_->mutex );
+        queue_->stop = true;
+    }
+    queue_->cv.notify_one();
+
+    /* A job destroying the writer (e.g. calling exit) cannot wait for its
+     * own thread: the thread finishes the queue once the job returns */
+    if ( std::this_thread::get_id() == thread_.get_id() )
+        thread_.detach();
+    else
+        thread_.join();
+
+} /* End of OutputWriter::~OutputWriter */
+
+std::future<void> OutputWriter::Submit( std::function<void()> job )
+{
+
+    std::packaged_task<void()> task( std::move( job ) );
+    std::future<void> done = task.get_future();
+
+    /* A job that submits more work runs it in place, it would otherwise wait on itself */
+    if ( std::this_thread::get_id() == thread_.get_id() ) {
+        task();
+        return done;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( queue_->mutex );
+        queue_->jobs.push_back( std::move( task ) );
+    }
+    queue_->cv.notify_one();
+    return done;
+
+} /* End of OutputWriter::Submit */
+
+void OutputWriter::Run( std::function<void()> job )
+{
+
+    Submit( std::move( job ) ).get();
+
+} /* End of OutputWriter::Run */
+
+void OutputWriter::Loop( std::shared_ptr<Queue> queue )
+{
+
+    while ( true ) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock( queue->mutex );
+            queue->cv.wait( lock, [&queue] { return queue->stop || !queue->jobs.empty(); } );
+            if ( queue->jobs.empty() )
+                return;
+            task = std::move( queue->jobs.front() );
+            queue->jobs.pop_front();
+        }
+        task();
+    }
+
+} /* End of OutputWriter::Loop */
+
+/* End of OutputWriter.cpp */
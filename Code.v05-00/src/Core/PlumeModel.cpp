@@ -60,10 +60,12 @@ static int SUCCESS     =  1;
 
 /* For RINGS */
 #include "Core/Cluster.hpp"
+#include "Core/ChemCluster.hpp"
 #include "Core/Species.hpp"
 
 /* For DIAGNOSTIC */
 #include "Core/Diag_Mod.hpp"
+#include "Core/OutputWriter.hpp"
 
 #include "Core/Status.hpp"
 
@@ -72,15 +74,7 @@ static int SUCCESS     =  1;
 int isSaved = 1;
 static int SAVE_FAIL   = -2;
 
-double RCONST[NREACT];       /* Rate constants (global) */
 double NOON_JRATES[NPHOTOL]; /* Noon-time photolysis rates (global) */
-double PHOTOL[NPHOTOL];      /* Photolysis rates (global) */
-double HET[NSPEC][3];        /* Heterogeneous chemistry rates (global) */
-
-double TIME;                 /* Current integration time (global) */
-
-/* Require this for adjoint integration */
-double SZA_CST[3];
 
 double totalH2OMass(const Solution& Data, const Vector_2D& cellAreas){
 
@@ -106,9 +100,9 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
 {
     auto start = std::chrono::high_resolution_clock::now();
 
-    double C[NSPEC];             /* Concentration of all species */
-    double * VAR = &C[0];        /* Concentration of variable species */
-    double * FIX = &C[NVAR];     /* Concentration of fixed species */
+    KppContext ambientKPP;                  /* Chemical state of the ambient box */
+    double * VAR = ambientKPP.VAR();        /* Concentration of variable species */
+    double * FIX = ambientKPP.FIX();        /* Concentration of fixed species */
 
     omp_set_num_threads(Input_Opt.SIMULATION_OMP_NUM_THREADS);
     bool printDEBUG = false;
@@ -220,16 +214,13 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
     /* Allocating noon-time photolysis rates. */
 
     if ( simVars.CHEMISTRY ) {
-        #pragma omp critical
-        {
-            ReadJRates( simVars.JRATE_FOLDER.c_str(),  \
-                input.emissionMonth(), \
-                input.emissionDay(),   \
-                input.longitude_deg(), \
-                input.latitude_deg(),  \
-                simVars.pressure_Pa/100.0,     \
-                NOON_JRATES );
-        }
+        ReadJRates( simVars.JRATE_FOLDER.c_str(),  \
+            input.emissionMonth(), \
+            input.emissionDay(),   \
+            input.longitude_deg(), \
+            input.latitude_deg(),  \
+            simVars.pressure_Pa/100.0,     \
+            NOON_JRATES );
 
     }
 
@@ -395,6 +386,9 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
     UInt j_0 = std::floor( yE[0]/(yE[0]-yE[1]) ); //index j where y = 0
     Data.getData( VAR, FIX, i_0, j_0, simVars.CHEMISTRY );
 
+    /* Ambient initial conditions, starting point of the adjoint box model */
+    const Vector_1D adjInitBackg( VAR, VAR + NVAR );
+
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
     /* -------------------------- EARLY MICROPHYSICS ------------------------- */
@@ -412,7 +406,8 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
     SimStatus EPM_RC = EPM::Integrate( simVars.temperature_K, simVars.pressure_Pa, simVars.relHumidity_w, VAR, \
                                  aerArray, aircraft, EI, Ice_rad, Ice_den, Soot_den,  \
                                  H2O_mol, SO4g_mol, SO4l_mol, liquidAer, iceAer, areaPlume, \
-        		             Ab0, Tc0, simVars.CHEMISTRY, Input_Opt.ADV_AMBIENT_LAPSERATE, input.fileName_micro() );
+        		             Ab0, Tc0, simVars.CHEMISTRY, Input_Opt.ADV_AMBIENT_LAPSERATE, input.fileName_micro(), \
+                                 EPM::microOutputSettings( Input_Opt ), EPM::integratorType( Input_Opt ) );
 
     if((!simVars.CHEMISTRY) && (EPM_RC != SimStatus::EPMSuccess)) {
         return EPM_RC;
@@ -575,8 +570,10 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
         int hh = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])/3600;
         int mm = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])/60   - 60 * hh;
         int ss = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])      - 60 * ( mm + 60 * hh );
-        Diag::Diag_TS_Chem( simVars.TS_SPEC_FILEPATH.c_str(), simVars.TS_SPEC_LIST, hh, mm, ss, \
-                      Data, m );
+        OutputWriter::Get().Run( [&] () {
+            Diag::Diag_TS_Chem( simVars.TS_SPEC_FILEPATH.c_str(), simVars.TS_SPEC_LIST, hh, mm, ss, \
+                          Data, m );
+        } );
     }
 
     if ( simVars.TS_AERO ) {
@@ -584,9 +581,11 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
         int hh = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])/3600;
         int mm = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])/60   - 60 * hh;
         int ss = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])      - 60 * ( mm + 60 * hh );
-        Diag::Diag_TS_Phys( simVars.TS_AERO_FILEPATH.c_str(), hh, mm, ss, \
-                      Data.solidAerosol, Data.Species[ind_H2O], 
-                      m.x(), m.y(), m.xE(), m.yE(), Met);
+        OutputWriter::Get().Run( [&] () {
+            Diag::Diag_TS_Phys( simVars.TS_AERO_FILEPATH.c_str(), hh, mm, ss, \
+                          Data.solidAerosol, Data.Species[ind_H2O], 
+                          m.x(), m.y(), m.xE(), m.yE(), Met);
+        } );
 
         float totalIceParticles = Data.solidAerosol.TotalNumber_sum( cellAreas );
         float totalIceMass = Data.solidAerosol.TotalIceMass_sum( cellAreas );
@@ -797,7 +796,7 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
 
         if (simVars.TEMP_PERTURB && (timestepVars.nTime == 0 || timestepVars.checkTimeForTempPerturb())){
             std::cout << "Running temp. perturb..." << std::endl;
-            Met.updateTempPerturb();
+            Met.updateTempPerturb(input.Case(), timestepVars.nTime);
             timestepVars.lastTimeTempPerturb = timestepVars.curr_Time_s + timestepVars.dt;
         }
 
@@ -831,113 +830,159 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
             timestepVars.lastTimeChem = timestepVars.curr_Time_s + timestepVars.dt;
             Vector_2D iceVolume_ = Data.solidAerosol.TotalVolume();
 
-            #pragma omp parallel for             \
-            if      ( !PARALLEL_CASES         ) \
-            default ( shared                   ) \
-            private ( iNx, jNy                 ) \
-            private ( relHumidity, IWC         ) \
-            schedule( dynamic, 1               )
-            for ( jNy = 0; jNy < Input_Opt.ADV_GRID_NY; jNy++ ) {
-                for ( iNx = 0; iNx < Input_Opt.ADV_GRID_NX; iNx++ ) {
+            /* Sets up the chemical state and rates of grid cell (iNx, jNy) */
+            auto setupCell = [&]( KppContext &cellKPP, const UInt iNx, const UInt jNy ) {
 
-                    double AerosolArea[NAERO];
-                    double AerosolRadi[NAERO];
+                double AerosolArea[NAERO];
+                double AerosolRadi[NAERO];
+                double relHumidity, IWC;
 
-                    /* Convert data structure to KPP inputs (VAR and FIX) */
-                    Data.getData( VAR, FIX, iNx, jNy, simVars.CHEMISTRY );
+                double * cellVAR = cellKPP.VAR();
 
-                    /* ================================================= */
-                    /* =============== Chemical rates ================== */
-                    /* ================================================= */
+                /* Convert data structure to KPP inputs (VAR and FIX) */
+                Data.getData( cellVAR, cellKPP.FIX(), iNx, jNy, simVars.CHEMISTRY );
+
+                /* ================================================= */
+                /* =============== Chemical rates ================== */
+                /* ================================================= */
+
+                /* Update heterogeneous chemistry reaction rates */
+                if ( simVars.HETCHEM ) {
+
+                    relHumidity = cellVAR[ind_H2O] * \
+                                    physConst::kB * Met.temp(jNy,iNx) * 1.00E+06 / \
+                                    physFunc::pSat_H2Ol( Met.temp(jNy,iNx) );
 
-                    /* Update heterogeneous chemistry reaction rates */
-                    if ( simVars.HETCHEM ) {
+                    /* Ice/NAT */
+                    AerosolArea[0] = Data.solidAerosol.Moment( 2, jNy, iNx );
+                    AerosolRadi[0] = std::max( std::min( Data.solidAerosol.Radius( jNy, iNx ), 1.00E-04 ), 1.00E-10 );
 
-                        for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
-                            HET[iSpec][0] = 0.0E+00;
-                            HET[iSpec][1] = 0.0E+00;
-                            HET[iSpec][2] = 0.0E+00;
-                        }
+                    /* Stratospheric liquid aerosols */
+                    AerosolArea[1] = Data.liquidAerosol.Moment( 2, jNy, iNx );
+                    AerosolRadi[1] = std::max( std::min( Data.liquidAerosol.Radius( jNy, iNx ), 1.00E-06 ), 1.00E-10 );
 
-                        relHumidity = VAR[ind_H2O] * \
-                                        physConst::kB * Met.temp(jNy,iNx) * 1.00E+06 / \
-                                        physFunc::pSat_H2Ol( Met.temp(jNy,iNx) );
+                    /* Tropospheric aerosols.
+                        * Zero it out */
+                    AerosolArea[2] = 0.0E+00;
+                    AerosolRadi[2] = 1.0E-07;
 
-                        /* Ice/NAT */
-                        AerosolArea[0] = Data.solidAerosol.Moment( 2, jNy, iNx );
-                        AerosolRadi[0] = std::max( std::min( Data.solidAerosol.Radius( jNy, iNx ), 1.00E-04 ), 1.00E-10 );
+                    /* Black carbon */
+                    AerosolArea[3] = Data.sootArea[jNy][iNx];
+                    AerosolRadi[3] = std::max( std::min( Data.sootRadi[jNy][iNx], 1.00E-08 ), 1.00E-10 );
 
-                        /* Stratospheric liquid aerosols */
-                        AerosolArea[1] = Data.liquidAerosol.Moment( 2, jNy, iNx );
-                        AerosolRadi[1] = std::max( std::min( Data.liquidAerosol.Radius( jNy, iNx ), 1.00E-06 ), 1.00E-10 );
+                    IWC            = Data.solidAerosol.Moment( 3, jNy, iNx ) \
+                                    * physConst::RHO_ICE; /* [kg/cm^3] */
 
-                        /* Tropospheric aerosols.
-                            * Zero it out */
-                        AerosolArea[2] = 0.0E+00;
-                        AerosolRadi[2] = 1.0E-07;
+                    GC_SETHET( cellKPP, Met.temp(jNy,iNx), Met.press(jNy), \
+                                Met.airMolecDens(jNy,iNx), relHumidity, \
+                                Data.STATE_PSC, cellVAR, AerosolArea,  \
+                                AerosolRadi, IWC, &(Data.KHETI_SLA[0]), Input_Opt.ADV_TROPOPAUSE_PRESSURE);
+                }
+
+                /* Update photolysis rates */
+                for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
+                    cellKPP.PHOTOL[iPhotol] = jRate[iPhotol];
+
+                /* Update reaction rates */
+                Update_RCONST( cellKPP, Met.temp(jNy,iNx), Met.press(jNy), \
+                                Met.airMolecDens(jNy,iNx), cellVAR[ind_H2O] );
+            };
 
-                        /* Black carbon */
-                        AerosolArea[3] = Data.sootArea[jNy][iNx];
-                        AerosolRadi[3] = std::max( std::min( Data.sootRadi[jNy][iNx], 1.00E-08 ), 1.00E-10 );
+            /* Reports a failed integration of grid cell (iNx, jNy) */
+            auto reportFailure = [&]( const KppContext &cellKPP, const UInt iNx, const UInt jNy ) {
 
-                        IWC            = Data.solidAerosol.Moment( 3, jNy, iNx ) \
-                                        * physConst::RHO_ICE; /* [kg/cm^3] */
+                std::cout << "Integration failed";
+                #ifdef OMP
+                    std::cout << " on " << omp_get_thread_num();
+                #endif /* OMP */
+                std::cout << " for grid cell = (" << jNy << ", " << iNx << ") at time t = " << timestepVars.curr_Time_s/3600.0 << " ( nTime = " << timestepVars.nTime << " )\n";
 
-                        GC_SETHET( Met.temp(jNy,iNx), Met.press(jNy), \
-                                    Met.airMolecDens(jNy,iNx), relHumidity, \
-                                    Data.STATE_PSC, VAR, AerosolArea,  \
-                                    AerosolRadi, IWC, &(Data.KHETI_SLA[0]), Input_Opt.ADV_TROPOPAUSE_PRESSURE);
+                if ( printDEBUG ) {
+                    std::cout << " ~~~ Printing reaction rates:\n";
+                    for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
+                        std::cout << "Reaction " << iReact << ": " << cellKPP.RCONST[iReact] << " [molec/cm^3/s]\n";
+                    }
+                    std::cout << " ~~~ Printing concentrations:\n";
+                    for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
+                        std::cout << "Species " << iSpec << ": " << cellKPP.C[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                     }
+                }
 
-                    /* Zero-out reaction rate */
-                    for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-                        RCONST[iReact] = 0.0E+00;
+//                /* Tweak would be to define a bool "stop", initialize to False and then set it as True if IERR < 0 */
+//                { /* Clear dynamically allocated variable(s) */
+//                    if ( sun != NULL ) sun->~SZA();
+//                    return KPP_FAIL;
+//                }
+            };
+
+            if ( Input_Opt.CHEMISTRY_CLUSTER_RTOL > 0.0E+00 ) {
+
+                /* Cells whose concentrations and reaction rates (hence
+                 * temperature, pressure, photolysis and aerosols) agree to
+                 * within the tolerance are integrated once, through the first
+                 * cell of their cluster. The other cells get its increments,
+                 * unless that integration failed */
+                const UInt nCell = Input_Opt.ADV_GRID_NX * Input_Opt.ADV_GRID_NY;
+                const ChemCluster chemCluster = IntegrateClustered( nCell, Input_Opt.CHEMISTRY_CLUSTER_RTOL, CHEM_CLUSTER_ATOL, \
+                    [&]( KppContext &cellKPP, const UInt iCell ) {
+                        setupCell( cellKPP, iCell % Input_Opt.ADV_GRID_NX, iCell / Input_Opt.ADV_GRID_NX );
+                    },
+                    [&]( const UInt iCell, const double cellVAR[] ) {
+                        Data.applyData( cellVAR, iCell % Input_Opt.ADV_GRID_NX, iCell / Input_Opt.ADV_GRID_NX );
+                    },
+                    [&]( const KppContext &cellKPP, const UInt iCell ) {
+                        reportFailure( cellKPP, iCell % Input_Opt.ADV_GRID_NX, iCell / Input_Opt.ADV_GRID_NX );
+                    },
+                    timestepVars.curr_Time_s, timestepVars.curr_Time_s + timestepVars.dt, \
+                    ATOL, RTOL, STEPMIN );
+
+                std::cout << "Integrated " << nCell << " grid cells as " << chemCluster.getnCluster() << " clusters";
+                std::cout << " (max. rel. spread within a cluster: " << chemCluster.getMaxSpread() << ")" << std::endl;
+
+            } else {
+
+                #pragma omp parallel for             \
+                if      ( !PARALLEL_CASES         ) \
+                default ( shared                   ) \
+                private ( iNx, jNy                 ) \
+                schedule( dynamic, 1               )
+                for ( jNy = 0; jNy < Input_Opt.ADV_GRID_NY; jNy++ ) {
 
-                    /* Update photolysis rates */
-                    for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                        PHOTOL[iPhotol] = jRate[iPhotol];
+                    /* Each cell gets its own chemical state, with all rates zeroed.
+                     * If requested, cells of a row are integrated together,
+                     * KPP_BATCH at a time */
+                    std::vector<KppContext> rowKPP( Input_Opt.ADV_GRID_NX );
+                    std::vector<KppContext*> rowPtr( Input_Opt.ADV_GRID_NX );
+                    std::vector<int> rowIERR( Input_Opt.ADV_GRID_NX );
 
-                    /* Update reaction rates */
-                    Update_RCONST( Met.temp(jNy,iNx), Met.press(jNy), \
-                                    Met.airMolecDens(jNy,iNx), VAR[ind_H2O] );
+                    for ( iNx = 0; iNx < Input_Opt.ADV_GRID_NX; iNx++ ) {
+                        setupCell( rowKPP[iNx], iNx, jNy );
+                        rowPtr[iNx] = &rowKPP[iNx];
+                    }
 
                     /* ================================================= */
                     /* ============= Chemical integration ============== */
                     /* ================================================= */
 
-                    IERR = INTEGRATE( VAR, FIX, timestepVars.curr_Time_s, timestepVars.curr_Time_s + timestepVars.dt, \
-                                        ATOL, RTOL, STEPMIN );
-
-                    if ( IERR < 0 ) {
-                        /* Integration failed */
-
-                        std::cout << "Integration failed";
-                        #ifdef OMP
-                            std::cout << " on " << omp_get_thread_num();
-                        #endif /* OMP */
-                        std::cout << " for grid cell = (" << jNy << ", " << iNx << ") at time t = " << timestepVars.curr_Time_s/3600.0 << " ( nTime = " << timestepVars.nTime << " )\n";
-
-                        if ( printDEBUG ) {
-                            std::cout << " ~~~ Printing reaction rates:\n";
-                            for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                                std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
-                            }
-                            std::cout << " ~~~ Printing concentrations:\n";
-                            for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                                std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
-                            }
-                        }
-
-//                                /* Tweak would be to define a bool "stop", initialize to False and then set it as True if IERR < 0 */
-//                                { /* Clear dynamically allocated variable(s) */
-//                                    if ( sun != NULL ) sun->~SZA();
-//                                    return KPP_FAIL;
-//                                }
+                    if ( Input_Opt.CHEMISTRY_BATCH ) {
+                        INTEGRATE_BATCH( rowPtr.data(), rowIERR.data(), Input_Opt.ADV_GRID_NX, \
+                                         timestepVars.curr_Time_s, timestepVars.curr_Time_s + timestepVars.dt, \
+                                         ATOL, RTOL, STEPMIN );
+                    } else {
+                        for ( iNx = 0; iNx < Input_Opt.ADV_GRID_NX; iNx++ )
+                            rowIERR[iNx] = INTEGRATE( rowKPP[iNx], timestepVars.curr_Time_s, timestepVars.curr_Time_s + timestepVars.dt, \
+                                                      ATOL, RTOL, STEPMIN );
                     }
 
-                    /* Convert KPP output back to data structure */
-                    Data.applyData(VAR, iNx, jNy );
+                    for ( iNx = 0; iNx < Input_Opt.ADV_GRID_NX; iNx++ ) {
+
+                        if ( rowIERR[iNx] < 0 )
+                            reportFailure( rowKPP[iNx], iNx, jNy );
+
+                        /* Convert KPP output back to data structure */
+                        Data.applyData( rowKPP[iNx].VAR(), iNx, jNy );
 
+                    }
                 }
             }
 
@@ -955,34 +1000,34 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
             if ( simVars.HETCHEM ) {
 
                 for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
-                    HET[iSpec][0] = 0.0E+00;
-                    HET[iSpec][1] = 0.0E+00;
-                    HET[iSpec][2] = 0.0E+00;
+                    ambientKPP.HET[iSpec][0] = 0.0E+00;
+                    ambientKPP.HET[iSpec][1] = 0.0E+00;
+                    ambientKPP.HET[iSpec][2] = 0.0E+00;
                 }
 
                 relHumidity = VAR[ind_H2O] * \
                                 physConst::kB * simVars.temperature_K * 1.00E+06 / \
                                 physFunc::pSat_H2Ol( simVars.temperature_K );
-                GC_SETHET( simVars.temperature_K, simVars.pressure_Pa, airDens, relHumidity, \
+                GC_SETHET( ambientKPP, simVars.temperature_K, simVars.pressure_Pa, airDens, relHumidity, \
                             Data.STATE_PSC, VAR, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]), Input_Opt.ADV_TROPOPAUSE_PRESSURE );
             }
 
             /* Zero-out reaction rate */
             for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-                RCONST[iReact] = 0.0E+00;
+                ambientKPP.RCONST[iReact] = 0.0E+00;
 
             /* Update photolysis rates */
             for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                PHOTOL[iPhotol] = jRate[iPhotol];
+                ambientKPP.PHOTOL[iPhotol] = jRate[iPhotol];
 
             /* Update reaction rates */
-            Update_RCONST( simVars.temperature_K, simVars.pressure_Pa, airDens, VAR[ind_H2O] );
+            Update_RCONST( ambientKPP, simVars.temperature_K, simVars.pressure_Pa, airDens, VAR[ind_H2O] );
 
             /* ========================================================= */
             /* ================= Chemical integration ================== */
             /* ========================================================= */
 
-            IERR = INTEGRATE( VAR, FIX, timestepVars.curr_Time_s, timestepVars.curr_Time_s + timestepVars.dt, \
+            IERR = INTEGRATE( ambientKPP, timestepVars.curr_Time_s, timestepVars.curr_Time_s + timestepVars.dt, \
                                 ATOL, RTOL, STEPMIN );
 
             if ( IERR < 0 ) {
@@ -1063,8 +1108,10 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
            int hh = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])/3600;
            int mm = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])/60   - 60 * hh;
            int ss = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])      - 60 * ( mm + 60 * hh );
-           Diag::Diag_TS_Chem( simVars.TS_SPEC_FILEPATH.c_str(), simVars.TS_SPEC_LIST, hh, mm, ss, \
-                         Data, m );
+           OutputWriter::Get().Run( [&] () {
+               Diag::Diag_TS_Chem( simVars.TS_SPEC_FILEPATH.c_str(), simVars.TS_SPEC_LIST, hh, mm, ss, \
+                             Data, m );
+           } );
         }
 
         if ( simVars.TS_AERO && \
@@ -1075,9 +1122,11 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
             int ss = (int) (timestepVars.curr_Time_s - timestepVars.timeArray[0])      - 60 * ( mm + 60 * hh );
 	        std::cout << "part lost=" << timestepVars.totPart_lost << ", ice lost=" << timestepVars.totIce_lost << std::endl;
 
-            Diag::Diag_TS_Phys( simVars.TS_AERO_FILEPATH.c_str(), hh, mm, ss, 
-                          Data.solidAerosol, Data.Species[ind_H2O], 
-                          m.x(), m.y(), m.xE(), m.yE(), Met );    
+            OutputWriter::Get().Run( [&] () {
+                Diag::Diag_TS_Phys( simVars.TS_AERO_FILEPATH.c_str(), hh, mm, ss, 
+                              Data.solidAerosol, Data.Species[ind_H2O], 
+                              m.x(), m.y(), m.xE(), m.yE(), Met );    
+            } );
             float totalIceParticles = Data.solidAerosol.TotalNumber_sum( cellAreas );
             float totalIceMass = Data.solidAerosol.TotalIceMass_sum( cellAreas );
 	        std::cout << "# particles: " << totalIceParticles << ", ice mass: " << totalIceMass << std::endl;
@@ -1104,6 +1153,63 @@ SimStatus PlumeModel( OptInput &Input_Opt, const Input &input )
     /* ------------------------ TIME LOOP ENDS HERE ------------------------ */
     /* ===================================================================== */
 
+    /* ===================================================================== */
+    /* --------------------- PLUME-TO-BOX ADJOINT -------------------------- */
+    /* ===================================================================== */
+
+    if ( simVars.ADJOINT && !simVars.CHEMISTRY ) {
+        std::cout << " Adjoint optimization requires chemistry, skipping..." << std::endl;
+    } else if ( simVars.ADJOINT ) {
+
+        /* Box model target: area-weighted plume concentrations over the domain */
+        double totArea = 0.0E+00;
+        for ( UInt jNy = 0; jNy < cellAreas.size(); jNy++ ) {
+            for ( UInt iNx = 0; iNx < cellAreas[jNy].size(); iNx++ )
+                totArea += cellAreas[jNy][iNx];
+        }
+        Vector_1D adjFinalPlume( NVAR, 0.0E+00 );
+        for ( UInt N = 0; N < NVAR; N++ ) {
+            for ( UInt jNy = 0; jNy < cellAreas.size(); jNy++ ) {
+                for ( UInt iNx = 0; iNx < cellAreas[jNy].size(); iNx++ )
+                    adjFinalPlume[N] += Data.Species[N][jNy][iNx] * cellAreas[jNy][iNx];
+            }
+            adjFinalPlume[N] /= totArea;
+        }
+
+        /* Checkpoints for the forward trajectory that fit in the memory
+         * budget. 0 stores every step */
+        int nCheck = 0;
+        if ( Input_Opt.SIMULATION_ADJOINT_CHECKPOINT_MB > 0.0E+00 ) {
+            nCheck = std::max( 1, (int) std::min( 1.0E+09, \
+                        Input_Opt.SIMULATION_ADJOINT_CHECKPOINT_MB * 1024.0 * 1024.0 / ( NVAR * sizeof(double) ) ) );
+        }
+
+        const double adjTime[2] = { timestepVars.timeArray[0], timestepVars.curr_Time_s };
+        Vector_1D adjInitBox( NVAR, 0.0E+00 );
+        double adjMetric = 0.0E+00;
+
+        std::cout << "\n Running plume-to-box adjoint";
+        if ( nCheck > 0 )
+            std::cout << " with " << nCheck << " checkpoints";
+        std::cout << "..." << std::endl;
+
+        IERR = KPP_Main_ADJ( ambientKPP, adjFinalPlume.data(), adjInitBackg.data(), \
+                             simVars.temperature_K, simVars.pressure_Pa, airDens, \
+                             adjTime, 2, KPP_RTOLS, KPP_ATOLS, nCheck, \
+                             adjInitBox.data(), &adjMetric, printDEBUG );
+
+        if ( IERR < 0 ) {
+            std::cout << " Adjoint optimization failed ( IERR = " << IERR << " )" << std::endl;
+            return SimStatus::Failed;
+        }
+
+        OutputWriter::Get().Run( [&] () {
+            Diag::Diag_Adjoint( input.fileName_ADJ2char(), adjFinalPlume, adjInitBackg, \
+                                adjInitBox, adjMetric, adjTime[0], adjTime[1] );
+        } );
+
+    }
+
     auto stop = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop-start);
     std::cout << "APCEMM LAGRID Plume Model Run Finished! Run time: " << duration.count() << "ms" << std::endl;
@@ -11,7 +11,10 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+
 #include "Core/Structure.hpp"
+#include "Core/InputDatabase.hpp"
 
 Solution::Solution(const OptInput& optInput) : \
         liquidAerosol( ), 
@@ -242,34 +245,23 @@ void Solution::Initialize( char const *fileName,      \
 } /* End of Solution::Initialize */
 
 void Solution::readInputBackgroundConditions(const Input& input, Vector_1D& amb_Value, Vector_2D& aer_Value, const char* fileName){
-    std::ifstream file;
-    file.open( fileName );
-    if ( file.is_open() ) {
-        std::string line;
-        UInt i = 0;
-
-        while ( ( std::getline( file, line ) ) && ( i < nVariables + nAer ) ) {
-            if ( ( line.length() > 0 ) && ( line != "\r" ) && ( line != "\n" ) && ( line[0] != '#' ) ) {
-                std::istringstream iss(line);
-                if ( i < nVariables ) {
-                    iss >> amb_Value[i];
-                }
-                else if ( ( i >= nVariables ) && ( i < nVariables + nAer ) ) {
-                    iss >> aer_Value[i - nVariables][0];
-                    std::getline( file, line );
-                    std::istringstream iss(line);
-                    iss >> aer_Value[i - nVariables][1];
-                }
-                i++;
-            }
-        }
-        file.close();
+    /* The file is parsed once and shared by all cases */
+    std::shared_ptr<const BackgroundDatabase> database;
+    try {
+        database = BackgroundDatabase::Get( fileName, NSPEC, N_AER );
     }
-    else {
+    catch ( const std::runtime_error &e ) {
         std::string const currFunc("Structure::Initialize");
         std::cout << "ERROR: In " << currFunc << ": Can't read (" << fileName << ")" << std::endl;
         exit(-1);
     }
+
+    for ( UInt i = 0; i < NSPEC; i++ )
+        amb_Value[i] = database->ambient()[i];
+    for ( UInt iAer = 0; iAer < N_AER; iAer++ ) {
+        aer_Value[iAer][0] = database->aerosol()[iAer][0];
+        aer_Value[iAer][1] = database->aerosol()[iAer][1];
+    }
 }
 
 void Solution::setAmbientConcentrations(const Input& input, Vector_1D& amb_Value){
@@ -883,12 +875,15 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
     }
 
 
+    /* Chemical state of the box. No heterogeneous chemistry during spin-up */
+    KppContext kpp;
+
     /* Initialize arrays */
     for ( UInt iVar = 0; iVar < NVAR; iVar++ )
-        varSpeciesArray[iVar] = amb_Value[iVar] * airDens;
+        kpp.VAR()[iVar] = amb_Value[iVar] * airDens;
 
     for ( UInt iFix = 0; iFix < NFIX; iFix++ )
-        fixSpeciesArray[iFix] = amb_Value[NVAR+iFix] * airDens;
+        kpp.FIX()[iFix] = amb_Value[NVAR+iFix] * airDens;
 
     /* Define sun parameters */
     /* FIXME: We don't need this on the heap. It's a goddamn local variable. */
@@ -903,28 +898,28 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
         sun.Update( curr_Time_s + DT_CHEM/2 );
 
         for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-            PHOTOL[iPhotol] = 0.0E+00;
+            kpp.PHOTOL[iPhotol] = 0.0E+00;
 
         if ( sun.CSZA > 0.0E+00 )
-            Update_JRates( PHOTOL, sun.CSZA );
+            Update_JRates( kpp.PHOTOL, sun.CSZA );
 
         if ( DBG ) {
             std::cout << "\n DEBUG : (In SpinUp)\n";
             for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                std::cout << "         PHOTOL[" << iPhotol << "] = " << PHOTOL[iPhotol] << "\n";
+                std::cout << "         PHOTOL[" << iPhotol << "] = " << kpp.PHOTOL[iPhotol] << "\n";
         }
 
         /* Update reaction rates */
         for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-            RCONST[iReact] = 0.0E+00;
+            kpp.RCONST[iReact] = 0.0E+00;
 
-        Update_RCONST( input.temperature_K(), input.pressure_Pa(), airDens, varSpeciesArray[ind_H2O] );
+        Update_RCONST( kpp, input.temperature_K(), input.pressure_Pa(), airDens, kpp.VAR()[ind_H2O] );
 
         /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
         /* ~~~~~ Integration ~~~~~~ */
         /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-        IERR = INTEGRATE( varSpeciesArray, fixSpeciesArray, curr_Time_s, curr_Time_s + DT_CHEM, \
+        IERR = INTEGRATE( kpp, curr_Time_s, curr_Time_s + DT_CHEM, \
                           ATOL, RTOL, STEPMIN );
 
         if ( IERR < 0 ) {
@@ -939,11 +934,11 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
             if ( DBG ) {
                 std::cout << " ~~~ Printing reaction rates:\n";
                 for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                    std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                    std::cout << "Reaction " << iReact << ": " << kpp.RCONST[iReact] << " [molec/cm^3/s]\n";
                 }
                 std::cout << " ~~~ Printing concentrations:\n";
                 for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                    std::cout << "Species " << iSpec << ": " << varSpeciesArray[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                    std::cout << "Species " << iSpec << ": " << kpp.VAR()[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                 }
             }
 
@@ -955,7 +950,10 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
     }
 
     for ( UInt iVar = 0; iVar < NVAR; iVar++ )
-        amb_Value[iVar] = varSpeciesArray[iVar] / airDens;
+        amb_Value[iVar] = kpp.VAR()[iVar] / airDens;
+
+    std::copy( kpp.VAR(), kpp.VAR() + NVAR, varSpeciesArray );
+    std::copy( kpp.FIX(), kpp.FIX() + NFIX, fixSpeciesArray );
 
     return IERR;
 
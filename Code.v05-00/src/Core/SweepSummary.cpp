@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <limits>
+#include <stdexcept>
+#include <netcdf>
+#include "AIM/Aerosol.hpp"
+#include "Core/OutputWriter.hpp"
+#include "Core/SweepSummary.hpp"
+#include "Util/VectorUtils.hpp"
+
+using namespace netCDF;
+
+namespace {
+
+    /* Scalar diagnostics, same names and units as in the aerosol time series */
+    struct ScalarVar {
+        const char* name;
+        const char* desc;
+        const char* units;
+        double SweepSummary::Scalars::*member;
+    };
+
+    const ScalarVar SCALAR_VARS[] = {
+        { "Ice Mass", "Total Mass of Ice Crystals of Cross Section", "kg / m", &SweepSummary::Scalars::iceMass },
+        { "Number Ice Particles", "Total Number of Ice Particles of Cross Section", "# / m", &SweepSummary::Scalars::iceParticles },
+        { "width", "Contrail Extinction-Defined Width", "m", &SweepSummary::Scalars::width },
+        { "depth", "Contrail Extinction-Defined Depth", "m", &SweepSummary::Scalars::depth },
+        { "intOD", "Integrated Vertical Optical Depth", "m", &SweepSummary::Scalars::intOD },
+    };
+
+    /* Status of a case that has not finished (or was skipped) */
+    const int STATUS_NONE = -1;
+
+    /* Records of one case are contiguous on disk */
+    const size_t TIME_CHUNK = 256;
+
+}
+
+SweepSummary::SweepSummary( const std::string &fileName,
+                            const std::vector<std::unordered_map<std::string, double>> &parameters ):
+    nRecord_( parameters.size(), 0 )
+{
+
+    if ( parameters.empty() )
+        throw std::invalid_argument("Sweep summary requires at least one case!");
+
+    OutputWriter::Get().Run( [&] () {
+        file_ = std::make_unique<NcFile>( fileName, NcFile::replace );
+
+        time_t rawtime;
+        char buffer[80];
+        time( &rawtime );
+        strftime(buffer, sizeof(buffer),"%d-%m-%Y %H:%M:%S", localtime(&rawtime));
+        file_->putAtt( "FileName", fileName );
+        file_->putAtt( "Generation Date", buffer );
+        file_->putAtt( "Format", "NetCDF-4" );
+
+        const NcDim caseDim = file_->addDim( "case", parameters.size() );
+        const NcDim tDim    = file_->addDim( "t" );
+        const std::vector<NcDim> dims = { caseDim, tDim };
+        const std::vector<size_t> chunks = { 1, TIME_CHUNK };
+        const float fillValue = std::numeric_limits<float>::quiet_NaN();
+
+        NcVar tVar = file_->addVar( "t", ncFloat, dims );
+        tVar.setChunking( NcVar::nc_CHUNKED, chunks );
+        tVar.setFill( true, fillValue );
+        tVar.putAtt("units", "hours since simulation start");
+        tVar.putAtt("long_name", "time");
+
+        for ( const ScalarVar& scalar: SCALAR_VARS ) {
+            NcVar var = file_->addVar( scalar.name, ncFloat, dims );
+            var.setChunking( NcVar::nc_CHUNKED, chunks );
+            var.setFill( true, fillValue );
+            var.putAtt("units", scalar.units );
+            var.putAtt("long_name", scalar.desc );
+        }
+
+        NcVar nVar = file_->addVar( "nt", ncInt, caseDim );
+        nVar.putAtt("long_name", "Number of time records of the case");
+        nVar.setFill( true, 0 );
+
+        /* Same codes as SimStatus */
+        const std::vector<int> flagValues = { STATUS_NONE,
+                                              (int) SimStatus::Complete,
+                                              (int) SimStatus::Incomplete,
+                                              (int) SimStatus::NoWaterSaturation,
+                                              (int) SimStatus::NoPersistence,
+                                              (int) SimStatus::NoSurvivalVortex,
+                                              (int) SimStatus::Failed };
+        NcVar statusVar = file_->addVar( "status", ncInt, caseDim );
+        statusVar.setFill( true, STATUS_NONE );
+        statusVar.putAtt("long_name", "Final status of the case");
+        statusVar.putAtt("flag_values", ncInt, flagValues.size(), flagValues.data() );
+        statusVar.putAtt("flag_meanings", "NotRun Complete Incomplete NoWaterSaturation NoPersistence NoSurvivalVortex Failed");
+
+        /* Case parameters, in a fixed order */
+        std::vector<std::string> names;
+        for ( const auto& param: parameters[0] )
+            names.push_back( param.first );
+        std::sort( names.begin(), names.end() );
+        for ( const std::string& name: names ) {
+            std::vector<double> values( parameters.size() );
+            for ( UInt iCase = 0; iCase < parameters.size(); iCase++ )
+                values[iCase] = parameters[iCase].at( name );
+            NcVar var = file_->addVar( name, ncDouble, caseDim );
+            var.putAtt("long_name", "Case parameter " + name );
+            var.putVar( values.data() );
+        }
+
+        file_->sync();
+    } );
+
+} /* End of SweepSummary::SweepSummary */
+
+SweepSummary::~SweepSummary()
+{
+
+    /* Closing the file is a netCDF call too */
+    OutputWriter::Get().Run( [this] () { file_.reset(); } );
+
+} /* End of SweepSummary::~SweepSummary */
+
+void SweepSummary::Record( const UInt iCase, const double time_h, const Scalars &values )
+{
+
+    OutputWriter::Get().Run( [&] () {
+        const size_t iT = nRecord_.at( iCase );
+        const std::vector<size_t> start = { (size_t) iCase, iT };
+        const std::vector<size_t> count = { 1, 1 };
+
+        const float time_f = time_h;
+        file_->getVar( "t" ).putVar( start, count, &time_f );
+        for ( const ScalarVar& scalar: SCALAR_VARS ) {
+            const float value = values.*scalar.member;
+            file_->getVar( scalar.name ).putVar( start, count, &value );
+        }
+
+        nRecord_[iCase] = iT + 1;
+        const int nt = nRecord_[iCase];
+        file_->getVar( "nt" ).putVar( { (size_t) iCase }, nt );
+    } );
+
+} /* End of SweepSummary::Record */
+
+void SweepSummary::Record( const UInt iCase, const double time_h, const AIM::Grid_Aerosol &iceAer,
+                           const Vector_1D &xCoord, const Vector_1D &yCoord,
+                           const Vector_1D &xEdges, const Vector_1D &yEdges )
+{
+
+    /* Same definitions as in Diag_TS_Phys */
+    const Vector_2D areas = VectorUtils::cellAreas( xEdges, yEdges );
+    const Vector_1D dx_vec = VectorUtils::cellWidths( xEdges );
+    const Vector_1D dy_vec( yCoord.size(), yCoord[1] - yCoord[0] );
+
+    Scalars values;
+    values.iceMass      = iceAer.TotalIceMass_sum( areas );
+    values.iceParticles = iceAer.TotalNumber_sum( areas );
+    values.width        = iceAer.extinctionWidth( xCoord );
+    values.depth        = iceAer.extinctionDepth( yCoord );
+    values.intOD        = iceAer.intYOD( dx_vec, dy_vec );
+    Record( iCase, time_h, values );
+
+} /* End of SweepSummary::Record */
+
+void SweepSummary::SetStatus( const UInt iCase, const SimStatus status )
+{
+
+    OutputWriter::Get().Run( [&] () {
+        const int code = (int) status;
+        file_->getVar( "status" ).putVar( { (size_t) iCase }, code );
+        /* A case is done: make its records visible to readers */
+        file_->sync();
+    } );
+
+} /* End of SweepSummary::SetStatus */
+
+/* End of SweepSummary.cpp */
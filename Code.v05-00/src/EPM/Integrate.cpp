@@ -17,11 +17,37 @@
 
 namespace EPM
 {
+    MicroOutputSettings microOutputSettings( const OptInput &Input_Opt )
+    {
+
+        MicroOutputSettings settings;
+        if ( Input_Opt.SIMULATION_MICRO_FORMAT == "none" )
+            settings.format = MicroOutputFormat::None;
+        else if ( Input_Opt.SIMULATION_MICRO_FORMAT == "binary" )
+            settings.format = MicroOutputFormat::Binary;
+        else
+            settings.format = MicroOutputFormat::Text;
+        settings.writeEvery = Input_Opt.SIMULATION_MICRO_WRITE_EVERY;
+        settings.relChange = Input_Opt.SIMULATION_MICRO_REL_CHANGE;
+        return settings;
+
+    } /* End of microOutputSettings */
+
+    EPMIntegrator integratorType( const OptInput &Input_Opt )
+    {
+
+        if ( Input_Opt.ADV_EPM_INTEGRATOR == "rosenbrock4" )
+            return EPMIntegrator::Rosenbrock4;
+        return EPMIntegrator::RKF78;
+
+    } /* End of integratorType */
+
     SimStatus Integrate( double &temperature_K, double pressure_Pa, double relHumidity_w, double varArray[], \
                    const Vector_2D& aerArray, const Aircraft &AC, const Emission &EI, \
                    double &Ice_rad, double &Ice_den, double &Soot_den, double &H2O_mol, \
                    double &SO4g_mol, double &SO4l_mol, AIM::Aerosol &SO4Aer, AIM::Aerosol &IceAer, \
-                   double &Area, double &Ab0, double &Tc0, const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out )
+                   double &Area, double &Ab0, double &Tc0, const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, const MicroOutputSettings &microSettings, \
+                   EPMIntegrator integrator, UInt *nSteps )
     {
 
         /* Get mean vortex displacement in [m] */
@@ -38,7 +64,8 @@ namespace EPM
          * The minus sign is because delta_z is the distance pointing down */
 
         SimStatus EPM_RC = RunMicrophysics( temperature_K, pressure_Pa, relHumidity_w, varArray, aerArray, AC, EI, delta_T_ad, delta_T, \
-                                      Ice_rad, Ice_den, Soot_den, H2O_mol, SO4g_mol, SO4l_mol, SO4Aer, IceAer, Area, Ab0, Tc0, CHEMISTRY, ambientLapseRate, micro_data_out );
+                                      Ice_rad, Ice_den, Soot_den, H2O_mol, SO4g_mol, SO4l_mol, SO4Aer, IceAer, Area, Ab0, Tc0, CHEMISTRY, ambientLapseRate, micro_data_out, microSettings, \
+                                      integrator, nSteps );
 
         return EPM_RC;
 
@@ -46,7 +73,8 @@ namespace EPM
 
     /* TODO: Make the original integrate function work with the new EPMOutput struct directly, and then delete this function.*/
     std::pair<EPMOutput, SimStatus> Integrate(double tempInit_K, double pressure_Pa, double rhw, double bypassArea, double coreExitTemp, double varArray[], 
-                            const Vector_2D& aerArray, const Aircraft& AC,const Emission& EI, bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out) 
+                            const Vector_2D& aerArray, const Aircraft& AC,const Emission& EI, bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, const MicroOutputSettings &microSettings, \
+                            EPMIntegrator integrator )
     {
         EPMOutput out;
         out.finalTemp = tempInit_K;
@@ -54,17 +82,31 @@ namespace EPM
         out.coreExitTemp = coreExitTemp;
         SimStatus returnCode = Integrate(out.finalTemp, pressure_Pa, rhw, varArray, aerArray, AC, EI, out.iceRadius,
                                     out.iceDensity, out.sootDensity, out.H2O_mol, out.SO4g_mol, out.SO4l_mol,
-                                    out.SO4Aer, out.IceAer, out.area, out.bypassArea, out.coreExitTemp, CHEMISTRY, ambientLapseRate, micro_data_out);
+                                    out.SO4Aer, out.IceAer, out.area, out.bypassArea, out.coreExitTemp, CHEMISTRY, ambientLapseRate, micro_data_out, microSettings,
+                                    integrator, &out.solverSteps );
         return std::make_pair(out, returnCode);
     }
 
+    std::pair<EPMOutput, SimStatus> Integrate(double tempInit_K, double pressure_Pa, double rhw, double bypassArea, double coreExitTemp, const AmbientState &ambient,
+                            const Aircraft& AC,const Emission& EI, bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, const MicroOutputSettings &microSettings, \
+                            EPMIntegrator integrator )
+    {
+        double C[NSPEC];             /* Concentration of all species */
+        double * VAR = &C[0];        /* Concentration of variable species */
+        double * FIX = &C[NVAR];     /* Concentration of fixed species */
+        ambient.getData( VAR, FIX );
+
+        return Integrate(tempInit_K, pressure_Pa, rhw, bypassArea, coreExitTemp, VAR, ambient.aerosol(), AC, EI, CHEMISTRY, ambientLapseRate, micro_data_out, microSettings, integrator);
+    }
+
     /* FIXME: See above comment on integrate() */
     SimStatus RunMicrophysics( double &temperature_K, double pressure_Pa, double relHumidity_w, double varArray[], \
                         const Vector_2D& aerArray, const Aircraft &AC, const Emission &EI, \
                          double delta_T_ad, double delta_T, double &Ice_rad, double &Ice_den, \
                          double &Soot_den, double &H2O_mol, double &SO4g_mol, double &SO4l_mol, \
                          AIM::Aerosol &SO4Aer, AIM::Aerosol &IceAer, double &Area, double &Ab0, double &Tc0, 
-                         const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out )
+                         const bool CHEMISTRY, double ambientLapseRate, std::string micro_data_out, const MicroOutputSettings &microSettings, \
+                         EPMIntegrator integrator, UInt *nSteps )
     {
     
         double relHumidity_i_Amb, relHumidity_i_postVortex, relHumidity_i_Final;
@@ -486,10 +528,16 @@ namespace EPM
         x[11] = 0.0;
         x[12] = 0.0; 
 
-        Vector_2D obs_Var;
-        Vector_1D obs_Time;
+        EPM::streamingObserver observer( EPM_ind, micro_data_out, microSettings );
 
-        EPM::streamingObserver observer( obs_Var, obs_Time, EPM_ind, micro_data_out, 2 );
+        /* The nucleation, dilution and 3-min diagnostics below use the state
+         * at the start of each stage (xStage), and water saturation is
+         * checked on those states only. This is what the original observer
+         * gave: odeint copied it, so it only ever stored the first state of
+         * each integrate call. The observer output doesn't change the
+         * physics. */
+        Vector_1D xStage = x;
+        bool waterSat = false;
 
         /* Creating ode's right hand side */
         gas_aerosol_rhs rhs( temperature_K, pressure_Pa, delta_T, H2O_amb, SO4_amb, SO4l_amb, SO4g_amb, HNO3_amb, Soot_amb, EI.getSootRad(), KernelSO4Soot);
@@ -531,22 +579,29 @@ namespace EPM
                 SO4l_b = 0.0;
             }
             else {
-                dilFactor_b = observer.m_states[observer.m_states.size()-1][EPM_ind_Trac];
-                SO4l_b = observer.m_states[observer.m_states.size()-1][EPM_ind_SO4l];
-                T_b = observer.m_states[observer.m_states.size()-1][EPM_ind_T];
-                P_b = observer.m_states[observer.m_states.size()-1][EPM_ind_P];
+                dilFactor_b = xStage[EPM_ind_Trac];
+                SO4l_b = xStage[EPM_ind_SO4l];
+                T_b = xStage[EPM_ind_T];
+                P_b = xStage[EPM_ind_P];
             }
 
+            xStage = x;
+            if ( !waterSat && xStage[EPM_ind_H2O] * xStage[EPM_ind_P] / physFunc::pSat_H2Ol( xStage[EPM_ind_T] ) >= 1.0 )
+                waterSat = true;
+
             /* Diffusion + Water uptake */
-            if ( adaptiveStep == 1 ) {
-                totSteps += boost::numeric::odeint::integrate_adaptive( boost::numeric::odeint::make_controlled< error_stepper_type >( EPM_ATOLS, EPM_RTOLS ), rhs, x, timeArray[iTime], timeArray[iTime+1], currTimeStep/100.0, observer );
+            if ( integrator == EPMIntegrator::Rosenbrock4 ) {
+                totSteps += integrateStiff( rhs, x, timeArray[iTime], timeArray[iTime+1], currTimeStep/100.0, std::ref( observer ) );
+            }
+            else if ( adaptiveStep == 1 ) {
+                totSteps += boost::numeric::odeint::integrate_adaptive( boost::numeric::odeint::make_controlled< error_stepper_type >( EPM_ATOLS, EPM_RTOLS ), rhs, x, timeArray[iTime], timeArray[iTime+1], currTimeStep/100.0, std::ref( observer ) );
             }
             else {
-                totSteps += boost::numeric::odeint::integrate( rhs, x, timeArray[iTime], timeArray[iTime+1], currTimeStep/100.0, observer );
+                totSteps += boost::numeric::odeint::integrate( rhs, x, timeArray[iTime], timeArray[iTime+1], currTimeStep/100.0, std::ref( observer ) );
             }
             
-            dilFactor = observer.m_states[observer.m_states.size()-1][EPM_ind_Trac] / dilFactor_b;
-            SO4l = observer.m_states[observer.m_states.size()-1][EPM_ind_SO4l] ;
+            dilFactor = xStage[EPM_ind_Trac] / dilFactor_b;
+            SO4l = xStage[EPM_ind_SO4l] ;
 
             n_air = physConst::Na * x[EPM_ind_P]/(physConst::R * x[EPM_ind_T] * 1.0e6);
             n_air_prev = physConst::Na *  P_b/(physConst::R * T_b * 1.0e6);
@@ -554,11 +609,11 @@ namespace EPM
             nPDF_new = ( SO4l*n_air - SO4l_b*n_air_prev);
 
             if ( nPDF_new >= 1.0E-20 ) {
-                x_star   = AIM::x_star( observer.m_states[observer.m_states.size()-1][EPM_ind_T], observer.m_states[observer.m_states.size()-1][EPM_ind_H2O] * n_air, std::max(x[EPM_ind_SO4g] * n_air, 0.0) );
-                nTot     = AIM::nTot( observer.m_states[observer.m_states.size()-1][EPM_ind_T], x_star, observer.m_states[observer.m_states.size()-1][EPM_ind_H2O] * n_air, std::max(x[EPM_ind_SO4g]*n_air, 0.0) );
+                x_star   = AIM::x_star( xStage[EPM_ind_T], xStage[EPM_ind_H2O] * n_air, std::max(x[EPM_ind_SO4g] * n_air, 0.0) );
+                nTot     = AIM::nTot( xStage[EPM_ind_T], x_star, xStage[EPM_ind_H2O] * n_air, std::max(x[EPM_ind_SO4g]*n_air, 0.0) );
                 nTot     = ( nTot <= 1.0E-20 ) ? 1.0E-20 : nTot;
                 radSO4   = AIM::radCluster( x_star, nTot );
-//                rho_Sulf = AIM::rho( x_star, observer.m_states[observer.m_states.size()-1][EPM_ind_T]);
+//                rho_Sulf = AIM::rho( x_star, xStage[EPM_ind_T]);
 
                 if ( radSO4 >= 1.0E-10 ) {
                     AIM::Aerosol nPDF_SO4_new( SO4_rJ, SO4_rE, nPDF_new, radSO4, sSO4, "lognormal" );
@@ -577,13 +632,13 @@ namespace EPM
 
             /* Aerosol PDF @ 3mins */
             if ( iTime == iTime_3mins ) {
-                PartRad_3mins  = observer.m_states[observer.m_states.size()-1][EPM_ind_ParR];
-                PartDens_3mins = observer.m_states[observer.m_states.size()-1][EPM_ind_Part] * n_air;
-                H2OMol_3mins   = observer.m_states[observer.m_states.size()-1][EPM_ind_H2O]; //* observer.m_states[observer.m_states.size()-1][EPM_ind_P] / ( physConst::kB * observer.m_states[observer.m_states.size()-1][EPM_ind_T] ) * 1.0E-06;
-                Tracer_3mins   = observer.m_states[observer.m_states.size()-1][EPM_ind_Trac];
+                PartRad_3mins  = xStage[EPM_ind_ParR];
+                PartDens_3mins = xStage[EPM_ind_Part] * n_air;
+                H2OMol_3mins   = xStage[EPM_ind_H2O]; //* xStage[EPM_ind_P] / ( physConst::kB * xStage[EPM_ind_T] ) * 1.0E-06;
+                Tracer_3mins   = xStage[EPM_ind_Trac];
 //                SO4pdf_3mins   = nPDF_SO4;
-                SO4l_3mins     = observer.m_states[observer.m_states.size()-1][EPM_ind_SO4l]; // * observer.m_states[observer.m_states.size()-1][EPM_ind_P] / ( physConst::kB * observer.m_states[observer.m_states.size()-1][EPM_ind_T] * 1.0E+06 ) ;
-                SO4g_3mins     = observer.m_states[observer.m_states.size()-1][EPM_ind_SO4g]; // * observer.m_states[observer.m_states.size()-1][EPM_ind_P] / ( physConst::kB * observer.m_states[observer.m_states.size()-1][EPM_ind_T] * 1.0E+06 ) ;
+                SO4l_3mins     = xStage[EPM_ind_SO4l]; // * xStage[EPM_ind_P] / ( physConst::kB * xStage[EPM_ind_T] * 1.0E+06 ) ;
+                SO4g_3mins     = xStage[EPM_ind_SO4g]; // * xStage[EPM_ind_P] / ( physConst::kB * xStage[EPM_ind_T] * 1.0E+06 ) ;
 //                pSO4pdf_3mins  = new AIM::Aerosol( nPDF_SO4 );
                 pSO4pdf_3mins.updatePdf( nPDF_SO4.getPDF() );
         
@@ -591,13 +646,13 @@ namespace EPM
 
         }
        
-#pragma omp critical
-        {
-            observer.print2File();
-        }
+        observer.close();
+        if ( nSteps != nullptr )
+            *nSteps = totSteps;
+
         /* Output variables */
         /* Check if contrail is water supersaturated at some point during formation */
-        if ( !CHEMISTRY && !observer.checkwatersat() ) {
+        if ( !CHEMISTRY && !waterSat ) {
             std::cout << "EndSim: Never reaches water saturation... ending simulation" << std::endl;
             //exit(0);
             return SimStatus::NoWaterSaturation;
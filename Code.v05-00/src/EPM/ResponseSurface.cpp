@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include "Core/Parameters.hpp"
+#include "EPM/ResponseSurface.hpp"
+
+namespace EPM
+{
+    namespace {
+        //Interpolated scalar outputs
+        constexpr double EPMOutput::* SCALAR_FIELDS[] = {
+            &EPMOutput::finalTemp, &EPMOutput::iceRadius, &EPMOutput::iceDensity, &EPMOutput::sootDensity,
+            &EPMOutput::H2O_mol, &EPMOutput::SO4g_mol, &EPMOutput::SO4l_mol, &EPMOutput::area,
+            &EPMOutput::bypassArea, &EPMOutput::coreExitTemp
+        };
+        //Outputs the error estimate is based on
+        constexpr double EPMOutput::* ERROR_FIELDS[] = {
+            &EPMOutput::finalTemp, &EPMOutput::iceRadius, &EPMOutput::iceDensity, &EPMOutput::H2O_mol, &EPMOutput::area
+        };
+        constexpr char MAGIC[8] = {'E', 'P', 'M', 'T', 'A', 'B', 'L', 'E'};
+        constexpr std::uint32_t VERSION = 2;
+
+        //Queries and nodes computed from the same inputs can differ by round-off (e.g. RHw recomputed from RHi)
+        inline bool sameValue(double a, double b) {
+            return std::abs(a - b) <= 1.0E-09 * std::max(std::abs(a), std::abs(b));
+        }
+
+        template<typename T> void writePod(std::ofstream& file, const T& val) {
+            file.write(reinterpret_cast<const char*>(&val), sizeof(T));
+        }
+        template<typename T> T readPod(std::ifstream& file) {
+            T val;
+            file.read(reinterpret_cast<char*>(&val), sizeof(T));
+            return val;
+        }
+        void writeVector(std::ofstream& file, const Vector_1D& vec) {
+            writePod(file, static_cast<std::uint32_t>(vec.size()));
+            file.write(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(double));
+        }
+        Vector_1D readVector(std::ifstream& file) {
+            Vector_1D vec(readPod<std::uint32_t>(file));
+            file.read(reinterpret_cast<char*>(vec.data()), vec.size() * sizeof(double));
+            return vec;
+        }
+        void writeString(std::ofstream& file, const std::string& str) {
+            writePod(file, static_cast<std::uint32_t>(str.size()));
+            file.write(str.data(), str.size());
+        }
+        std::string readString(std::ifstream& file) {
+            std::string str(readPod<std::uint32_t>(file), '\0');
+            file.read(str.data(), str.size());
+            return str;
+        }
+        void writeAerosol(std::ofstream& file, const AIM::Aerosol& aer) {
+            writeVector(file, aer.getBinCenters());
+            if (aer.getBinCenters().empty()) return;
+            writeVector(file, aer.getBinEdges());
+            writeVector(file, aer.getPDF());
+        }
+        AIM::Aerosol readAerosol(std::ifstream& file) {
+            Vector_1D centers = readVector(file);
+            if (centers.empty()) return AIM::Aerosol();
+            Vector_1D edges = readVector(file);
+            Vector_1D pdf = readVector(file);
+            AIM::Aerosol aer(centers, edges, 0.0, centers[0], 1.5, "lognormal");
+            aer.updatePdf(pdf);
+            return aer;
+        }
+    }
+
+    ResponseSurface::ResponseSurface(const std::vector<Point>& points, const std::vector<NodeResult>& results, const std::string& context):
+        context_(context)
+    {
+        if (points.size() != results.size() || points.empty()) {
+            throw std::invalid_argument("ResponseSurface: need one EPM result per point");
+        }
+        for (UInt d = 0; d < NDIM; d++) {
+            Vector_1D values(points.size());
+            std::transform(points.begin(), points.end(), values.begin(), [d](const Point& p) { return p[d]; });
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end(), sameValue), values.end());
+            axes_[d] = std::move(values);
+        }
+        setStrides();
+
+        nodes_.resize(strides_[0] * axes_[0].size());
+        std::vector<bool> filled(nodes_.size(), false);
+        for (std::size_t n = 0; n < points.size(); n++) {
+            std::array<std::size_t, NDIM> idx;
+            for (UInt d = 0; d < NDIM; d++) {
+                const Vector_1D& a = axes_[d];
+                auto it = std::lower_bound(a.begin(), a.end(), points[n][d]);
+                if (it == a.end() || (it != a.begin() && !sameValue(*it, points[n][d]))) it--;
+                idx[d] = it - a.begin();
+            }
+            const std::size_t flat = flatIndex(idx);
+            if (filled[flat]) continue;
+            nodes_[flat] = results[n];
+            filled[flat] = true;
+        }
+        const std::size_t nMissing = std::count(filled.begin(), filled.end(), false);
+        if (nMissing > 0) {
+            throw std::invalid_argument("ResponseSurface: points don't cover a full grid, " + std::to_string(nMissing)
+                                        + " of " + std::to_string(nodes_.size()) + " nodes are missing");
+        }
+    }
+
+    ResponseSurface ResponseSurface::build(const std::array<Vector_1D, NDIM>& axes, const std::function<NodeResult(const Point&)>& model,
+                                           const std::string& context) {
+        std::size_t nNodes = 1;
+        for (const Vector_1D& a: axes) {
+            if (a.empty() || !std::is_sorted(a.begin(), a.end()) || std::adjacent_find(a.begin(), a.end()) != a.end()) {
+                throw std::invalid_argument("ResponseSurface::build: axes must be non-empty and strictly increasing");
+            }
+            nNodes *= a.size();
+        }
+
+        std::vector<Point> points(nNodes);
+        for (std::size_t n = 0; n < nNodes; n++) {
+            std::size_t rem = n;
+            for (int d = NDIM - 1; d >= 0; d--) {
+                points[n][d] = axes[d][rem % axes[d].size()];
+                rem /= axes[d].size();
+            }
+        }
+
+        std::vector<NodeResult> results(nNodes);
+        #pragma omp parallel for schedule(dynamic, 1) if(!PARALLEL_CASES)
+        for (std::size_t n = 0; n < nNodes; n++) {
+            results[n] = model(points[n]);
+        }
+        return ResponseSurface(points, results, context);
+    }
+
+    void ResponseSurface::setStrides() {
+        strides_[NDIM - 1] = 1;
+        for (int d = NDIM - 2; d >= 0; d--) {
+            strides_[d] = strides_[d + 1] * axes_[d + 1].size();
+        }
+    }
+
+    std::size_t ResponseSurface::flatIndex(const std::array<std::size_t, NDIM>& idx) const {
+        std::size_t flat = 0;
+        for (UInt d = 0; d < NDIM; d++) flat += idx[d] * strides_[d];
+        return flat;
+    }
+
+    std::optional<ResponseSurface::Result> ResponseSurface::interpolate(const Point& query, double maxRelError) const {
+        if (nodes_.empty()) return std::nullopt;
+
+        //Locate the cell
+        std::array<std::size_t, NDIM> lo;
+        std::array<double, NDIM> w;
+        std::vector<UInt> active;
+        for (UInt d = 0; d < NDIM; d++) {
+            const Vector_1D& a = axes_[d];
+            double q = query[d];
+            if (sameValue(q, a.front())) q = a.front();
+            if (sameValue(q, a.back())) q = a.back();
+            if (q < a.front() || q > a.back()) return std::nullopt;
+            if (a.size() == 1) {
+                lo[d] = 0;
+                w[d] = 0.0;
+                continue;
+            }
+            lo[d] = std::min<std::size_t>(std::upper_bound(a.begin(), a.end(), q) - a.begin() - 1, a.size() - 2);
+            w[d] = (q - a[lo[d]]) / (a[lo[d] + 1] - a[lo[d]]);
+            if (w[d] > 0.0) active.push_back(d);
+        }
+
+        //Corners of the cell with a nonzero weight
+        std::vector<std::size_t> corners;
+        Vector_1D weights;
+        for (std::size_t c = 0; c < (std::size_t(1) << active.size()); c++) {
+            std::array<std::size_t, NDIM> idx = lo;
+            double weight = 1.0;
+            for (std::size_t k = 0; k < active.size(); k++) {
+                const UInt d = active[k];
+                if (c & (std::size_t(1) << k)) {
+                    idx[d]++;
+                    weight *= w[d];
+                } else {
+                    weight *= 1.0 - w[d];
+                }
+            }
+            if (weight == 0.0) continue;
+            corners.push_back(flatIndex(idx));
+            weights.push_back(weight);
+        }
+
+        const SimStatus status = nodes_[corners[0]].second;
+        for (std::size_t c: corners) {
+            if (nodes_[c].second != status) return std::nullopt;
+        }
+        const std::size_t nearest = corners[std::max_element(weights.begin(), weights.end()) - weights.begin()];
+        if (status != SimStatus::EPMSuccess) {
+            return Result{ nodes_[nearest].first, status, 0.0 };
+        }
+
+        Result result{ nodes_[nearest].first, status, 0.0 };
+        EPMOutput& out = result.output;
+        out.solverSteps = 0;
+        for (auto field: SCALAR_FIELDS) out.*field = 0.0;
+        Vector_1D SO4pdf(out.SO4Aer.getPDF().size(), 0.0);
+        Vector_1D icePdf(out.IceAer.getPDF().size(), 0.0);
+        for (std::size_t k = 0; k < corners.size(); k++) {
+            const EPMOutput& node = nodes_[corners[k]].first;
+            for (auto field: SCALAR_FIELDS) out.*field += weights[k] * node.*field;
+            for (std::size_t b = 0; b < SO4pdf.size(); b++) SO4pdf[b] += weights[k] * node.SO4Aer.getPDF()[b];
+            for (std::size_t b = 0; b < icePdf.size(); b++) icePdf[b] += weights[k] * node.IceAer.getPDF()[b];
+        }
+        out.SO4Aer.updatePdf(SO4pdf);
+        out.IceAer.updatePdf(icePdf);
+
+        //Leading error term of linear interpolation along each axis: (q - a_i)(a_i+1 - q)/2 * |f''|,
+        //with f'' from the second divided difference around the node closest to the query.
+        Vector_1D absError(std::size(ERROR_FIELDS), 0.0);
+        for (UInt d: active) {
+            const Vector_1D& a = axes_[d];
+            if (a.size() < 3) continue;
+            std::array<std::size_t, NDIM> idx;
+            for (UInt e = 0; e < NDIM; e++) idx[e] = lo[e] + (w[e] > 0.5 ? 1 : 0);
+            const std::size_t c = std::clamp<std::size_t>(idx[d], 1, a.size() - 2);
+            const NodeResult* stencil[3];
+            for (int s = 0; s < 3; s++) {
+                idx[d] = c - 1 + s;
+                stencil[s] = &nodes_[flatIndex(idx)];
+                //The stencil reaches into another regime: the curvature is meaningless there
+                if (stencil[s]->second != SimStatus::EPMSuccess) return std::nullopt;
+            }
+            const double q = a[lo[d]] + w[d] * (a[lo[d] + 1] - a[lo[d]]);
+            const double spread = 0.5 * (q - a[lo[d]]) * (a[lo[d] + 1] - q);
+            for (std::size_t f = 0; f < std::size(ERROR_FIELDS); f++) {
+                const auto field = ERROR_FIELDS[f];
+                const double slope0 = (stencil[1]->first.*field - stencil[0]->first.*field) / (a[c] - a[c - 1]);
+                const double slope1 = (stencil[2]->first.*field - stencil[1]->first.*field) / (a[c + 1] - a[c]);
+                const double curvature = 2.0 * (slope1 - slope0) / (a[c + 1] - a[c - 1]);
+                absError[f] += spread * std::abs(curvature);
+            }
+        }
+        for (std::size_t f = 0; f < std::size(ERROR_FIELDS); f++) {
+            if (absError[f] == 0.0) continue;
+            result.relError = std::max(result.relError, absError[f] / std::max(std::abs(out.*ERROR_FIELDS[f]), 1.0E-300));
+        }
+        if (result.relError > maxRelError) return std::nullopt;
+        return result;
+    }
+
+    void ResponseSurface::write(const std::string& fileName) const {
+        std::ofstream file(fileName, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("ResponseSurface: could not open " + fileName + " for writing");
+        }
+        file.write(MAGIC, sizeof(MAGIC));
+        writePod(file, VERSION);
+        writePod(file, static_cast<std::uint32_t>(NDIM));
+        writeString(file, context_);
+        for (const Vector_1D& a: axes_) writeVector(file, a);
+        for (const NodeResult& node: nodes_) {
+            writePod(file, static_cast<std::int32_t>(node.second));
+            for (auto field: SCALAR_FIELDS) writePod(file, node.first.*field);
+            writeAerosol(file, node.first.SO4Aer);
+            writeAerosol(file, node.first.IceAer);
+        }
+    }
+
+    ResponseSurface ResponseSurface::read(const std::string& fileName) {
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("ResponseSurface: could not open " + fileName);
+        }
+        char magic[sizeof(MAGIC)];
+        file.read(magic, sizeof(MAGIC));
+        const std::uint32_t version = readPod<std::uint32_t>(file);
+        const std::uint32_t nDim = readPod<std::uint32_t>(file);
+        if (!file || !std::equal(magic, magic + sizeof(MAGIC), MAGIC) || version != VERSION || nDim != NDIM) {
+            throw std::runtime_error("ResponseSurface: " + fileName + " is not an EPM table");
+        }
+
+        ResponseSurface table;
+        table.context_ = readString(file);
+        for (Vector_1D& a: table.axes_) a = readVector(file);
+        table.setStrides();
+        table.nodes_.resize(table.strides_[0] * table.axes_[0].size());
+        for (NodeResult& node: table.nodes_) {
+            node.second = static_cast<SimStatus>(readPod<std::int32_t>(file));
+            for (auto field: SCALAR_FIELDS) node.first.*field = readPod<double>(file);
+            node.first.SO4Aer = readAerosol(file);
+            node.first.IceAer = readAerosol(file);
+        }
+        if (!file) {
+            throw std::runtime_error("ResponseSurface: " + fileName + " is truncated");
+        }
+        return table;
+    }
+
+    std::shared_ptr<const ResponseSurface> ResponseSurface::load(const std::string& fileName, const std::string& context) {
+        static std::mutex mutex;
+        static std::map<std::string, std::shared_ptr<const ResponseSurface>> tables;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = tables.find(fileName);
+        if (it == tables.end()) {
+            it = tables.emplace(fileName, std::make_shared<const ResponseSurface>(read(fileName))).first;
+        }
+        if (it->second->context() != context) {
+            throw std::runtime_error("ResponseSurface: " + fileName + " was built for\n  " + it->second->context()
+                                     + "\nbut this case has\n  " + context);
+        }
+        return it->second;
+    }
+
+}
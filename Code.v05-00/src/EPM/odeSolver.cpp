@@ -11,6 +11,9 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
 #include "EPM/odeSolver.hpp"
 
 namespace EPM
@@ -78,17 +81,17 @@ namespace EPM
 
     } /* End of odeSolver::updateStep */
 
-    template<class System> UInt odeSolver<System>::integrate( double start_time, double end_time, double dt, streamingObserver observer )
+    template<class System> UInt odeSolver<System>::integrate( double start_time, double end_time, double dt, streamingObserver &observer )
     {
 
         unsigned int nStep;
 
         if ( end_time > start_time ) {
             if ( adaptive ) {
-                nStep = boost::numeric::odeint::integrate_adaptive( boost::numeric::odeint::make_controlled< error_stepper_type >( EPM_ATOLS, EPM_RTOLS ), system, vars, start_time, end_time, dt, observer );
+                nStep = boost::numeric::odeint::integrate_adaptive( boost::numeric::odeint::make_controlled< error_stepper_type >( EPM_ATOLS, EPM_RTOLS ), system, vars, start_time, end_time, dt, std::ref( observer ) );
                 //boost::find_if( boost::numeric::odeint::make_adaptive_range( boost::numeric::odeint::make_controlled< error_stepper_type>( EPM_ATOLS, EPM_RTOLS ), system, vars, start_time, end_time, dt, observer), done );
             } else {
-                nStep = boost::numeric::odeint::integrate( system, vars, start_time, end_time, dt, observer );
+                nStep = boost::numeric::odeint::integrate( system, vars, start_time, end_time, dt, std::ref( observer ) );
             }
         } else {
             std::cout << "\nIn odeSolver::integrate: end_time is smaller than start_time!";
@@ -152,229 +155,227 @@ namespace EPM
 
     } /* End of odeSolver::getState */
 
-    streamingObserver::streamingObserver( Vector_2D &states, Vector_1D &times, std::vector<UInt> indices, std::string filename, UInt write_every ):
-        m_write_every( write_every ),
+    streamingObserver::streamingObserver( std::vector<UInt> indices, std::string filename, \
+                                          const MicroOutputSettings &settings, UInt historySize ):
         fileName( filename ),
-        m_states( states ),
-        m_times( times ),
-        m_indices( indices )
-
+        m_indices( indices ),
+        m_settings( settings ),
+        m_states( std::max( historySize, UInt(1) ) ),
+        m_times( std::max( historySize, UInt(1) ), 0.0 )
     {
 
         /* Constructor */
 
-    } /* End of streamingObserver::streamingObserver */
+        if ( m_settings.writeEvery < 1 )
+            m_settings.writeEvery = 1;
 
-    streamingObserver::~streamingObserver( )
-    {
+        if ( m_settings.format == MicroOutputFormat::None )
+            return;
 
-        /* Destructor */
+        if ( m_settings.format == MicroOutputFormat::Binary )
+            m_file.open( fileName, std::ios::out | std::ios::binary );
+        else
+            m_file.open( fileName );
 
-    } /* End of streamingObserver::~streamingObserver */
+        if ( m_file.is_open() == 0 ) {
+            std::cout << "\nIn streamingObserver::streamingObserver: Couldn't open " << fileName << "!\n";
+        }
+        else {
+            writeHeader();
+        }
 
-    streamingObserver& streamingObserver::operator=( const streamingObserver &obs )
+    } /* End of streamingObserver::streamingObserver */
+
+    streamingObserver::~streamingObserver( )
     {
 
-        if ( &obs == this )
-            return *this;
+        /* Destructor */
 
-        m_write_every = obs.m_write_every;
-        m_count = obs.m_count;
-        m_states = obs.m_states;
-        m_times = obs.m_times;
-        fileName = obs.fileName;
-        return *this;
+        close();
 
-    } /* End of streamingObserver::operator= */
+    } /* End of streamingObserver::~streamingObserver */
 
     void streamingObserver::operator()( const Vector_1D &x, double t )
     {
 
-        if ( ( m_count % m_write_every ) == 0 ) {
-        
-            m_states.push_back( x );
-            m_times.push_back( t );
+        /* Overwrite the oldest slot. Same size, so no reallocation after the first lap */
+        m_head = ( m_count == 0 ) ? 0 : ( m_head + 1 ) % m_states.size();
+        m_states[m_head] = x;
+        m_times[m_head] = t;
 
-            m_count++;
+        /* Check for water saturation on the fly so that the history isn't needed */
+        if ( !m_waterSat && x[m_indices[3]] * x[m_indices[2]] / physFunc::pSat_H2Ol( x[m_indices[1]] ) >= 1.0 )
+            m_waterSat = true;
 
+        if ( m_file.is_open() && ( ( m_count % m_settings.writeEvery ) == 0 || changedSinceRecord( x ) ) ) {
+            record( x, t );
+            m_lastRecordedCount = m_count;
         }
 
+        m_count++;
+
     } /* End of streamingObserver::operator() */
 
-    double streamingObserver::getLastElement( ) const
+    const Vector_1D& streamingObserver::lastState( UInt age ) const
     {
 
-        return m_states[m_count][0];
+        if ( age >= m_count || age >= m_states.size() )
+            throw std::out_of_range( "streamingObserver::lastState: state is not in the history" );
 
-    } /* End of streamingObserver::getLastElement */
+        return m_states[( m_head + m_states.size() - age ) % m_states.size()];
 
-    void streamingObserver::print2File( ) const
+    } /* End of streamingObserver::lastState */
+
+    double streamingObserver::lastTime( UInt age ) const
     {
 
-        std::ofstream file (fileName);
+        if ( age >= m_count || age >= m_times.size() )
+            throw std::out_of_range( "streamingObserver::lastTime: state is not in the history" );
 
-        if ( file.is_open() == 0 ) {
+        return m_times[( m_head + m_times.size() - age ) % m_times.size()];
 
-            std::cout << "\nIn streamingObserver::streamingObserver: Couldn't open " << fileName << "!\n";
+    } /* End of streamingObserver::lastTime */
+
+    bool streamingObserver::changedSinceRecord( const Vector_1D &x ) const
+    {
+
+        if ( m_settings.relChange <= 0.0 || m_nRecorded == 0 )
+            return false;
 
+        for ( UInt ind: m_indices ) {
+            if ( std::abs( x[ind] - m_lastRecorded[ind] ) > m_settings.relChange * std::abs( m_lastRecorded[ind] ) )
+                return true;
         }
-        else {
+        return false;
 
-            unsigned int counter;
-            const char* sep = ", ";
-            const unsigned int prec = 6;
-
-            double n_air; 
-
-            /* Variable list: 
-             * - Temperature [K]
-             * - Water molecular concentration [molecules/cm^3] 
-             * - Saturation with respect to ice [-]
-             * - Saturation with respect to liquid water [-]
-             * - TBC ...
-             * - */
-
-            file << std::setw(prec+8) << "Time [s], ";
-            file << std::setw(prec+8) << "Tracer [-], ";
-            file << std::setw(prec+8) << "Temp. [K], ";
-            file << std::setw(prec+8) << "Pres. [Pa], ";
-            file << std::setw(prec+8) << "H2O [/cm3], ";
-            file << std::setw(prec+8) << "RH_i [-], ";
-            file << std::setw(prec+8) << "RH_w [-], ";
-            file << std::setw(prec+8) << "SO4 [/cm3], ";
-            file << std::setw(prec+8) << "SO4g [/cm3], ";
-            file << std::setw(prec+8) << "SO4l [/cm3], ";
-            file << std::setw(prec+8) << "SO4s [/cm3], ";
-            file << std::setw(prec+8) << "SO4Sat [-], ";
-            file << std::setw(prec+8) << "HNO3 [/cm3], ";
-            file << std::setw(prec+8) << "HNO3Sat[-], ";
-            file << std::setw(prec+8) << "Part[/cm3], ";
-            file << std::setw(prec+8) << "Rad[mum], ";
-            file << std::setw(prec+8) << "Theta1[-], ";
-            file << std::setw(prec+8) << "Theta2[-], ";
-
-            /* New line */
-            file << "\n";
-            file << std::setfill('-') << std::setw(18*(prec+8)) << "-";
-
-            file << std::setfill(' ');
-
-            for ( counter = 0; counter < m_states.size(); counter++ ) {
-                /* New line */
-                file << "\n";
-
-                file << std::scientific << std::setprecision(prec) << std::setfill(' ');
-
-                /* Output data */
-
-                /* Print time [s] */
-                file << m_times[counter];
-                file << sep;
-
-                /* Print tracer dilution ratio [-] */
-                file << m_states[counter][m_indices[0]];
-                file << sep;
-
-                /* Print temperature [K] */
-                file << m_states[counter][m_indices[1]];
-                file << sep;
-                
-                /* Print pressure [Pa] */
-                file << m_states[counter][m_indices[2]];
-                file << sep;
-                
-                /* Compute number concentration of air for conversions sake */
-                n_air = m_states[counter][m_indices[2]] / (physConst::kB * m_states[counter][m_indices[1]] * 1.0e6) ; 
-
-                /* Print gaseous water molecular concentration [molec/cm^3] */
-                file << m_states[counter][m_indices[3]] * n_air ;
-                file << sep;
-
-                /* Print rel. humidities [-] */
-                file << m_states[counter][m_indices[3]] * m_states[counter][m_indices[2]] / physFunc::pSat_H2Os( m_states[counter][m_indices[1]] );
-                file << sep;
-                file << m_states[counter][m_indices[3]] * m_states[counter][m_indices[2]] / physFunc::pSat_H2Ol( m_states[counter][m_indices[1]] );
-                file << sep;
-                
-                /* Print gaseous SO4 molecular concentration [molec/cm^3] */
-                file << m_states[counter][m_indices[4]] * n_air ;
-                file << sep;
-                
-                /* Print gaseous SO4 gaseous molecular concentration [molec/cm^3] */
-                file << m_states[counter][m_indices[6]] * n_air;
-                file << sep;
-
-                /* Print gaseous SO4 liquid molecular concentration [molec/cm^3] */
-                file << m_states[counter][m_indices[5]] * n_air;
-                file << sep;
-                
-                /* Print gaseous SO4 on part [molec/cm^3] */
-                file << m_states[counter][m_indices[7]] * m_states[counter][m_indices[2]] / ( physConst::kB * m_states[counter][m_indices[1]] * 1.0E+06 ) ;
-                file << sep;
-
-                /* Print SO4 saturation [-] */
-                file << ( m_states[counter][m_indices[5]] + m_states[counter][m_indices[6]] ) * m_states[counter][m_indices[2]] / physFunc::pSat_H2SO4( m_states[counter][m_indices[1]] );
-                file << sep;
-                
-                /* Print gaseous HNO3 molecular concentration [molec/cm^3] */
-                file << m_states[counter][m_indices[8]] * m_states[counter][m_indices[2]] / ( physConst::kB * m_states[counter][m_indices[1]] * 1.0E+06 ) ;
-                file << sep;
-                
-                /* Print HNO3 saturation [-] */
-                file << m_states[counter][m_indices[8]] * physConst::kB * m_states[counter][m_indices[1]] * 1.0E+06 / physFunc::pSat_HNO3( m_states[counter][m_indices[1]], \
-                        m_states[counter][m_indices[2]] * physConst::kB * m_states[counter][m_indices[1]] * 1.0E+06 );
-                file << sep;
-                
-                /* Print particle concentration [#/cm^3] */
-                file << m_states[counter][m_indices[9]] * n_air;
-                file << sep;
-                
-                /* Print particle radius [mum] */
-                file << m_states[counter][m_indices[10]] * 1.0E+06;
-                file << sep;
-                
-                /* Print soot coverage [-] */
-                file << m_states[counter][m_indices[11]];
-                file << sep;
-                
-                /* Print soot coverage [-] */
-                file << m_states[counter][m_indices[12]];
-                file << sep;
+    } /* End of streamingObserver::changedSinceRecord */
 
-            }
+    void streamingObserver::close( )
+    {
 
-            file << "\n";
-            file.close();
+        if ( !m_file.is_open() )
+            return;
 
+        /* Always finish with the last state */
+        if ( m_count > 0 && m_lastRecordedCount != m_count - 1 ) {
+            m_lastRecordedCount = m_count - 1;
+            record( lastState(), lastTime() );
         }
 
-    } /* End of streamingObserver::print2File */
-
-    bool streamingObserver::checkwatersat( ) const
+        if ( m_settings.format == MicroOutputFormat::Text )
+            m_file << "\n";
+        m_file.close();
+
+    } /* End of streamingObserver::close */
+
+    /* Variable list: 
+     * - Temperature [K]
+     * - Water molecular concentration [molecules/cm^3] 
+     * - Saturation with respect to ice [-]
+     * - Saturation with respect to liquid water [-]
+     * - TBC ...
+     * - */
+    static const std::vector<std::string> microOutputColumns = {
+        "Time [s]", "Tracer [-]", "Temp. [K]", "Pres. [Pa]", "H2O [/cm3]", "RH_i [-]", "RH_w [-]",
+        "SO4 [/cm3]", "SO4g [/cm3]", "SO4l [/cm3]", "SO4s [/cm3]", "SO4Sat [-]", "HNO3 [/cm3]", "HNO3Sat[-]",
+        "Part[/cm3]", "Rad[mum]", "Theta1[-]", "Theta2[-]" };
+
+    void streamingObserver::writeHeader( )
     {
 
-        /* Variable definitions */
-        int counter = 0;
-        float RHw;
-        bool watersup { false };
+        if ( m_settings.format == MicroOutputFormat::Binary ) {
+            /* Magic, number of columns, then each column name as length + characters.
+             * Records follow as rows of doubles, native byte order. */
+            const char magic[8] = { 'E', 'P', 'M', 'M', 'I', 'C', 'R', 'O' };
+            std::uint32_t nCols = microOutputColumns.size();
+            m_file.write( magic, sizeof(magic) );
+            m_file.write( reinterpret_cast<const char*>( &nCols ), sizeof(nCols) );
+            for ( const std::string &name: microOutputColumns ) {
+                std::uint32_t len = name.size();
+                m_file.write( reinterpret_cast<const char*>( &len ), sizeof(len) );
+                m_file.write( name.data(), len );
+            }
+            return;
+        }
 
-        /* Loop over until RHw >= 1.0 */
-        while ( !watersup && counter < m_states.size() ) {
+        const unsigned int prec = 6;
 
-            /* Check value of RHw and update watersub */
-            RHw = m_states[counter][m_indices[3]] * m_states[counter][m_indices[2]] / physFunc::pSat_H2Ol( m_states[counter][m_indices[1]] );
-            if ( RHw >= 1.0 ) {
-                watersup = true;
-            }
+        for ( const std::string &name: microOutputColumns )
+            m_file << std::setw(prec+8) << name + ", ";
+
+        /* New line */
+        m_file << "\n";
+        m_file << std::setfill('-') << std::setw(18*(prec+8)) << "-";
+
+        m_file << std::setfill(' ');
 
-            /* Iterate the counter */
-            counter += 1;
+    } /* End of streamingObserver::writeHeader */
 
+    void streamingObserver::record( const Vector_1D &x, double t )
+    {
+
+        m_lastRecorded = x;
+        m_nRecorded++;
+
+        const double T = x[m_indices[1]];
+        const double P = x[m_indices[2]];
+
+        /* Compute number concentration of air for conversions sake */
+        const double n_air = P / (physConst::kB * T * 1.0e6) ; 
+
+        const double row[18] = {
+            /* Time [s] */
+            t,
+            /* Tracer dilution ratio [-] */
+            x[m_indices[0]],
+            /* Temperature [K] */
+            T,
+            /* Pressure [Pa] */
+            P,
+            /* Gaseous water molecular concentration [molec/cm^3] */
+            x[m_indices[3]] * n_air,
+            /* Rel. humidities [-] */
+            x[m_indices[3]] * P / physFunc::pSat_H2Os( T ),
+            x[m_indices[3]] * P / physFunc::pSat_H2Ol( T ),
+            /* SO4 molecular concentration [molec/cm^3] */
+            x[m_indices[4]] * n_air,
+            /* SO4 gaseous molecular concentration [molec/cm^3] */
+            x[m_indices[6]] * n_air,
+            /* SO4 liquid molecular concentration [molec/cm^3] */
+            x[m_indices[5]] * n_air,
+            /* SO4 on part [molec/cm^3] */
+            x[m_indices[7]] * P / ( physConst::kB * T * 1.0E+06 ),
+            /* SO4 saturation [-] */
+            ( x[m_indices[5]] + x[m_indices[6]] ) * P / physFunc::pSat_H2SO4( T ),
+            /* Gaseous HNO3 molecular concentration [molec/cm^3] */
+            x[m_indices[8]] * P / ( physConst::kB * T * 1.0E+06 ),
+            /* HNO3 saturation [-] */
+            x[m_indices[8]] * physConst::kB * T * 1.0E+06 / physFunc::pSat_HNO3( T, P * physConst::kB * T * 1.0E+06 ),
+            /* Particle concentration [#/cm^3] */
+            x[m_indices[9]] * n_air,
+            /* Particle radius [mum] */
+            x[m_indices[10]] * 1.0E+06,
+            /* Soot coverage [-] */
+            x[m_indices[11]],
+            x[m_indices[12]] };
+
+        if ( m_settings.format == MicroOutputFormat::Binary ) {
+            m_file.write( reinterpret_cast<const char*>( row ), sizeof(row) );
+            return;
         }
 
-        return watersup;
+        const char* sep = ", ";
+        const unsigned int prec = 6;
+
+        /* New line */
+        m_file << "\n";
+        m_file << std::scientific << std::setprecision(prec) << std::setfill(' ');
+        for ( double val: row ) {
+            m_file << val;
+            m_file << sep;
+        }
 
-    } /* End of streamingObserver::checkwatersat */
+    } /* End of streamingObserver::record */
 
     template class odeSolver<void ( const Vector_1D&, Vector_1D&, double )>;
 }
@@ -27,6 +27,8 @@ namespace FVM_ANDS{
     {
         invdx_ = 1.0/dx_;
         invdy_ = 1.0/dy_;
+        dxCell_.assign(nx_, dx_);
+        invdxCell_.assign(nx_, invdx_);
         nInteriorPoints_ = nx_ * ny_;
         nGhostPoints_ = 2*nx_ + 2*ny_;
         nTotalPoints_ = nInteriorPoints_ + nGhostPoints_;
@@ -51,6 +53,18 @@ namespace FVM_ANDS{
         applyBoundaryCondition();
     }
 
+    void AdvDiffSystem::updateCellWidthsX(const Vector_1D& dx_new){
+        if(dx_new.size() != nx_){
+            throw std::invalid_argument("Number of cell widths doesn't match nx!");
+        }
+        dxCell_ = dx_new;
+        invdxCell_.resize(nx_);
+        std::transform(dxCell_.begin(), dxCell_.end(), invdxCell_.begin(), [](double dx) { return 1.0 / dx; });
+        //The narrowest column limits the explicit advection timestep (see courant())
+        dx_ = *std::min_element(dxCell_.begin(), dxCell_.end());
+        invdx_ = 1.0 / dx_;
+    }
+
     void AdvDiffSystem::initVelocVecs(){
         for(int i = 0; i < nx_; i++){
             for(int j = 0; j < ny_; j++){
@@ -192,11 +206,13 @@ namespace FVM_ANDS{
             int idx_S = neighbor_point(FaceDirection::SOUTH, i);
 
             //Diffusion Terms
-            double coeff_C = 1 + 2 * dt_ * (Dh_vec_[i] / (dx_ * dx_) + Dv_vec_[i] / (dy_ * dy_));
-            double coeff_E = -Dh_vec_[i] * dt_ / (dx_ * dx_);
-            double coeff_W = -Dh_vec_[i] * dt_ / (dx_ * dx_) ;
+            //x gradients at the faces use the distance between the neighboring cell centers (= dx on a uniform grid)
+            int col = cellColumn(i);
+            double coeff_E = -Dh_vec_[i] * dt_ / (dxCell_[col] * centerDistE(col));
+            double coeff_W = -Dh_vec_[i] * dt_ / (dxCell_[col] * centerDistW(col));
             double coeff_N = -Dv_vec_[i] * dt_ / (dy_ * dy_);
             double coeff_S = -Dv_vec_[i] * dt_ / (dy_ * dy_);
+            double coeff_C = 1 - coeff_E - coeff_W - coeff_N - coeff_S;
 
             //Operator splitting uses implicit only for diffusion
             if(!operatorSplit && (u_double_ > 0 || v_double_ > 0 || shear_ > 0)){
@@ -238,19 +254,21 @@ namespace FVM_ANDS{
         int idx_N = neighbor_point(FaceDirection::NORTH, i);
         int idx_S = neighbor_point(FaceDirection::SOUTH, i);
 
+        double dx = dxCell_[cellColumn(i)];
+
         double u_W = isWestBoundary? u_vec_[i] : 0.5 * (u_vec_[i] + u_vec_[idx_W]);
         double u_E = isEastBoundary? u_vec_[i] : 0.5 * (u_vec_[i] + u_vec_[idx_E]);
         double v_N = isNorthBoundary? v_vec_[i] : 0.5 * (v_vec_[i] + v_vec_[idx_N]);
         double v_S = isSouthBoundary? v_vec_[i] : 0.5 * (v_vec_[i] + v_vec_[idx_S]);
 
-        if (u_E >= 0) coeff_C += u_E * dt_ / dx_;
-        if (u_W < 0) coeff_C -= u_W * dt_ / dx_;
+        if (u_E >= 0) coeff_C += u_E * dt_ / dx;
+        if (u_W < 0) coeff_C -= u_W * dt_ / dx;
         if (v_N >= 0) coeff_C += v_N * dt_ / dy_;
         if (v_S < 0) coeff_C -= v_S * dt_ / dy_;
 
-        if (u_E < 0) coeff_E += u_E * dt_ / dy_;
+        if (u_E < 0) coeff_E += u_E * dt_ / dx;
 
-        if (u_W >= 0) coeff_W -= u_W * dt_ / dx_;
+        if (u_W >= 0) coeff_W -= u_W * dt_ / dx;
 
         if (v_N < 0) coeff_N += v_N * dt_ / dy_;
 
@@ -267,10 +285,10 @@ namespace FVM_ANDS{
             phi_S_corr += bool_to_signed(v_S >= 0) * v_S * dt_ / dy_ * 0.5 * minmod(i, FaceDirection::SOUTH, 0) * (phi_[i] - phi_[idx_S]);
         
         if (!isWestBoundary)
-            phi_W_corr += bool_to_signed(u_W >= 0) * u_W * dt_ / dx_ * 0.5 * minmod(i, FaceDirection::WEST, 0) * (phi_[i] - phi_[idx_W]);
+            phi_W_corr += bool_to_signed(u_W >= 0) * u_W * dt_ / dx * 0.5 * minmod(i, FaceDirection::WEST, 0) * (phi_[i] - phi_[idx_W]);
 
         if (!isEastBoundary)
-            phi_E_corr -= bool_to_signed(u_E >= 0) * u_E * dt_ / dx_ * 0.5 * minmod(i, FaceDirection::EAST, 0) * (phi_[idx_E] - phi_[i]);
+            phi_E_corr -= bool_to_signed(u_E >= 0) * u_E * dt_ / dx * 0.5 * minmod(i, FaceDirection::EAST, 0) * (phi_[idx_E] - phi_[i]);
         
         double TVD_deferred_corr = phi_N_corr + phi_S_corr + phi_W_corr + phi_E_corr;
         deferredCorr_[i] = TVD_deferred_corr;
@@ -313,20 +331,20 @@ namespace FVM_ANDS{
                             rhs_[i] += v_vec_[i] * dt_ / dy_ * points_[i]->bcVal();
                             break;
                         case FaceDirection::EAST:
-                            rhs_[i] -= u_vec_[i] * dt_ / dx_ * points_[i]->bcVal();
+                            rhs_[i] -= u_vec_[i] * dt_ * invdxCell_[cellColumn(i)] * points_[i]->bcVal();
                             break;
                         case FaceDirection::WEST:
-                            rhs_[i] += u_vec_[i] * dt_ / dx_ * points_[i]->bcVal();
+                            rhs_[i] += u_vec_[i] * dt_ * invdxCell_[cellColumn(i)] * points_[i]->bcVal();
                             break;
                     }
                     if (!points_[i]->secondBoundaryConds()) break;
                     BoundaryCondDescription bc_2 = points_[i]->secondBoundaryConds().value();
                     switch(bc_2.direction){
                         case FaceDirection::EAST:
-                            rhs_[i] -= u_vec_[i] * dt_ / dx_ * bc_2.bcVal;
+                            rhs_[i] -= u_vec_[i] * dt_ * invdxCell_[cellColumn(i)] * bc_2.bcVal;
                             break;
                         case FaceDirection::WEST:
-                            rhs_[i] += u_vec_[i] * dt_ / dx_ * bc_2.bcVal;
+                            rhs_[i] += u_vec_[i] * dt_ * invdxCell_[cellColumn(i)] * bc_2.bcVal;
                             break;
                         default:
                             throw std::runtime_error("Can't have anything but EAST or WEST as secondary BC!");
@@ -611,7 +629,7 @@ namespace FVM_ANDS{
 
             //Even just setting this to 0 is like a 2 ns save out of 12, not sure if worth
             soln[i] = /*(!operatorSplit) * (Dh_ * dt_ * invdx_ * (dphi_dx_E - dphi_dx_W) + Dv_ * dt_ * invdy_ * (dphi_dy_N - dphi_dy_S))\*/
-                     dt_ * invdx_ * (u_local * phi_W - u_local * phi_E) + dt_ * invdy_ * (v_local * phi_S - v_local * phi_N)\
+                     dt_ * invdxCell_[cellColumn(i)] * (u_local * phi_W - u_local * phi_E) + dt_ * invdy_ * (v_local * phi_S - v_local * phi_N)\
                     + source_[i] * dt_ + phi_[i];
             // stop = std::chrono::high_resolution_clock::now();
             // duration = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start);
@@ -26,6 +26,7 @@
 #include "KPP/KPP_Parameters.h"
 #include "KPP/KPP_Global.h"
 #include "KPP/KPP_Sparse.h"
+#include "KPP/KPP_Lanes.hpp"
 
 
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -39,16 +40,13 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-void Fun( 
-    double V[],                            /* Concentrations of variable species (local) */
-    double F[],                            /* Concentrations of fixed species (local) */
-    double RCT[],                          /* Rate constants (local) */
-    double Vdot[]                          /* Time derivative of variable species concentrations */
-)
+/* Written for double and KppLanes alike */
+template <typename T>
+static inline void Fun_T( const T V[], const T F[], const T RCT[], T Vdot[] )
 {
 
     /* Local variables                                                  */
-    double A[NREACT];                        /* Rate for each equation */
+    T A[NREACT];                             /* Rate for each equation */
 
     /* Computation of equation rates                                    */
     A[0] = RCT[0]*V[114]*V[119];
@@ -889,6 +887,21 @@ void Fun(
                +A[460];
 }
 
+void Fun( 
+    double V[],                            /* Concentrations of variable species (local) */
+    double F[],                            /* Concentrations of fixed species (local) */
+    double RCT[],                          /* Rate constants (local) */
+    double Vdot[]                          /* Time derivative of variable species concentrations */
+)
+{
+    Fun_T( V, F, RCT, Vdot );
+}
+
+void Fun_Batch( const KppLanes V[], const KppLanes F[], const KppLanes RCT[], KppLanes Vdot[] )
+{
+    Fun_T( V, F, RCT, Vdot );
+}
+
 /* End of Fun function                                              */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
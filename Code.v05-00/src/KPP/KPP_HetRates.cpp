@@ -100,7 +100,8 @@ double HETHOBr_PSC( const double A, const double B, const double KHETI_SLA[11],
                     bool IS_STRAT,                  bool NATSURFACE );
 
 
-void GC_SETHET( const double TEMP, const double PATM, const double AIRDENS, \
+void GC_SETHET( KppContext &ctx,                                            \
+                const double TEMP, const double PATM, const double AIRDENS, \
                 const double RELHUM, const unsigned int STATE_PSC,          \
                 const double SPC[], const double AREA[NAERO],               \
                 const double RADI[NAERO], const double IWC,                 \
@@ -119,7 +120,9 @@ void GC_SETHET( const double TEMP, const double PATM, const double AIRDENS, \
      * const double AREA[NAERO]   : Aerosol area in m^2/cm^3
      * const double RADI[NAERO]   : Aerosol radius in m 
      * const double IWC           : Ice water content in kg/cm^3
-     * const double KHETI_SLA[11] : Sticking coefficients */
+     * const double KHETI_SLA[11] : Sticking coefficients
+     *
+     * The rates are written to ctx.HET */
      
     /* Aerosol list:
      * 0 : NAT/ice 
@@ -144,6 +147,8 @@ void GC_SETHET( const double TEMP, const double PATM, const double AIRDENS, \
     bool SAFEDIV, PSCBOX, STRATBOX, NATSURFACE;
     bool IS_LAND, IS_ICE;
 
+    double (* const HET)[3] = ctx.HET;
+
     /* GC_SETHET begins here! */
 
     /* Zero scalars and arrays */
@@ -34,6 +34,7 @@
 /*                                                                  */
 /* INTEGRATE - Integrator routine                                   */
 /*   Arguments :                                                    */
+/*      ctx       - Chemical state of the cell (VAR updated in place) */
 /*      TIN       - Start Time for Integration                      */
 /*      TOUT      - End Time for Integration                        */
 /*                                                                  */
@@ -52,23 +53,22 @@
  #define  HALF     (double)0.5
  #define  DeltaMin (double)1.0e-6    
    
-/*~~~> Collect statistics: global variables */   
- int Nfun,Njac,Nstp,Nacc,Nrej,Ndec,Nsol,Nsng;
+/*~~~> Statistics and all other per-cell state live in the KppContext */
 
 
 /*~~~> Function headers */   
- void FunTemplate(double, double [], double [], double*); 
- void JacTemplate(double, double [], double [], double*) ;
+ void FunTemplate(double, double [], double [], KppContext*); 
+ void JacTemplate(double, double [], double [], KppContext*) ;
  int Rosenbrock(double Y[], double Tstart, double Tend,
      double AbsTol[], double RelTol[],
-     void (*ode_Fun)(double, double [], double [], double*), 
-     void (*ode_Jac)(double, double [], double [], double*),
-     double RPAR[], int IPAR[], double* FIX);
+     void (*ode_Fun)(double, double [], double [], KppContext*), 
+     void (*ode_Jac)(double, double [], double [], KppContext*),
+     double RPAR[], int IPAR[], KppContext* ctx);
  int RosenbrockIntegrator(
      double Y[], double Tstart, double Tend ,     
      double  AbsTol[], double  RelTol[],
-     void (*ode_Fun)(double, double [], double [], double*), 
-     void (*ode_Jac)(double, double [], double [], double*),
+     void (*ode_Fun)(double, double [], double [], KppContext*), 
+     void (*ode_Jac)(double, double [], double [], KppContext*),
      int ros_S,
      double ros_M[], double ros_E[], 
      double ros_A[], double ros_C[],
@@ -77,11 +77,11 @@
      char Autonomous, char VectorTol, int Max_no_steps,  
      double Roundoff, double Hmin, double Hmax, double Hstart,
      double FacMin, double FacMax, double FacRej, double FacSafe, 
-     double *Texit, double *Hexit, double* FIX ); 
+     double *Texit, double *Hexit, KppContext* ctx ); 
  char ros_PrepareMatrix (
      double* H, 
      int Direction,  double gam, double Jac0[], 
-     double Ghimj[], int Pivot[] );
+     double Ghimj[], int Pivot[], KppContext* ctx );
  double ros_ErrorNorm ( 
      double Y[], double Ynew[], double Yerr[], 
      double AbsTol[], double RelTol[], 
@@ -90,15 +90,15 @@
  void ros_FunTimeDerivative ( 
      double T, double Roundoff, 
      double Y[], double Fcn0[], 
-     void ode_Fun(double, double [], double [], double*), 
+     void ode_Fun(double, double [], double [], KppContext*), 
      double dFdT[],
-     double* FIX );
+     KppContext* ctx );
  void Fun( double Y[], double FIX[], double RCONST[], double Ydot[] );
  void Jac_SP( double Y[], double FIX[], double RCONST[], double Ydot[] );
- void FunTemplate( double T, double Y[], double Ydot[], double* );
- void JacTemplate( double T, double Y[], double Ydot[], double* );
- void DecompTemplate( double A[], int Pivot[], int* ising );
- void SolveTemplate( double A[], int Pivot[], double b[] );
+ void FunTemplate( double T, double Y[], double Ydot[], KppContext* );
+ void JacTemplate( double T, double Y[], double Ydot[], KppContext* );
+ void DecompTemplate( double A[], int Pivot[], int* ising, KppContext* ctx );
+ void SolveTemplate( double A[], int Pivot[], double b[], KppContext* ctx );
  void WCOPY(int N, double X[], int incX, double Y[], int incY);
  void WAXPY(int N, double Alpha, double X[], int incX, double Y[], int incY );
  void WSCAL(int N, double Alpha, double X[], int incX);
@@ -127,16 +127,12 @@
  void KppSolve ( double A[], double b[] );
  
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-int INTEGRATE( double VAR[] , double FIX[], double TIN   , double TOUT,
+int INTEGRATE( KppContext &ctx, double TIN, double TOUT,
                double ATOL[], double RTOL[], double STEPMIN )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 {
-    static double  RPAR[20];
-    static int  i, IERR, IPAR[20];
-    static int Ns=0, Na=0, Nr=0, Ng=0;
-    #pragma omp threadprivate( RPAR )
-    #pragma omp threadprivate( i, IERR, IPAR )
-    #pragma omp threadprivate( Ns, Na, Nr, Ng )
+    double  RPAR[20];
+    int  i, IERR, IPAR[20];
 
    for ( i = 0; i < 20; i++ ) {
      IPAR[i] = 0;
@@ -149,17 +145,13 @@ int INTEGRATE( double VAR[] , double FIX[], double TIN   , double TOUT,
    RPAR[2] = STEPMIN; /* starting step */
    IPAR[3] = 5;    /* choice of the method */
 
-   IERR = Rosenbrock(VAR, TIN, TOUT,
+   IERR = Rosenbrock(ctx.VAR(), TIN, TOUT,
            ATOL, RTOL,
            &FunTemplate, &JacTemplate,
-           RPAR, IPAR, FIX);
+           RPAR, IPAR, &ctx);
 
-	     
-   Ns=Ns+IPAR[12];
-   Na=Na+IPAR[13];
-   Nr=Nr+IPAR[14];
-   Ng=Ng+IPAR[17];
-//   printf("\n Step=%d  Acc=%d  Rej=%d  Singular=%d\n",Ns,Na,Nr,Ng);
+//   printf("\n Step=%d  Acc=%d  Rej=%d  Singular=%d\n",
+//          ctx.Nstp,ctx.Nacc,ctx.Nrej,ctx.Nsng);
 
 //   if (IERR < 0)
 //     printf("\n Rosenbrock: Unsucessful step at T=%g: IERR=%d\n",
@@ -176,9 +168,9 @@ int INTEGRATE( double VAR[] , double FIX[], double TIN   , double TOUT,
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 int Rosenbrock(double Y[], double Tstart, double Tend,
         double AbsTol[], double RelTol[],
-        void (*ode_Fun)(double, double [], double [], double*), 
-	void (*ode_Jac)(double, double [], double [], double*),
-        double RPAR[], int IPAR[], double* FIX)
+        void (*ode_Fun)(double, double [], double [], KppContext*), 
+	void (*ode_Jac)(double, double [], double [], KppContext*),
+        double RPAR[], int IPAR[], KppContext* ctx)
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    
     Solves the system y'=F(t,y) using a Rosenbrock method defined by:
@@ -308,14 +300,14 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
   /*~~~>  Initialize statistics */
-   Nfun = IPAR[10];
-   Njac = IPAR[11];
-   Nstp = IPAR[12];
-   Nacc = IPAR[13];
-   Nrej = IPAR[14];
-   Ndec = IPAR[15];
-   Nsol = IPAR[16];
-   Nsng = IPAR[17];
+   ctx->Nfun = IPAR[10];
+   ctx->Njac = IPAR[11];
+   ctx->Nstp = IPAR[12];
+   ctx->Nacc = IPAR[13];
+   ctx->Nrej = IPAR[14];
+   ctx->Ndec = IPAR[15];
+   ctx->Nsol = IPAR[16];
+   ctx->Nsng = IPAR[17];
    
   /*~~~>  Autonomous or time dependent ODE. Default is time dependent. */
    Autonomous = !(IPAR[0] == 0);
@@ -460,18 +452,18 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
         Roundoff, Hmin, Hmax, Hstart,
         FacMin, FacMax, FacRej, FacSafe, 
       /* Output parameters */ 
-	&Texit, &Hexit, FIX);
+	&Texit, &Hexit, ctx);
 
 
   /*~~~>  Collect run statistics */
-   IPAR[10] = Nfun;
-   IPAR[11] = Njac;
-   IPAR[12] = Nstp;
-   IPAR[13] = Nacc;
-   IPAR[14] = Nrej;
-   IPAR[15] = Ndec;
-   IPAR[16] = Nsol;
-   IPAR[17] = Nsng;
+   IPAR[10] = ctx->Nfun;
+   IPAR[11] = ctx->Njac;
+   IPAR[12] = ctx->Nstp;
+   IPAR[13] = ctx->Nacc;
+   IPAR[14] = ctx->Nrej;
+   IPAR[15] = ctx->Ndec;
+   IPAR[16] = ctx->Nsol;
+   IPAR[17] = ctx->Nsng;
   /*~~~> Last T and H */
    RPAR[10] = Texit;
    RPAR[11] = Hexit;    
@@ -490,8 +482,8 @@ int RosenbrockIntegrator(
   /*~~~> Input: tolerances  */        
      double  AbsTol[], double  RelTol[],
   /*~~~> Input: ode function and its Jacobian */      
-     void (*ode_Fun)(double, double [], double [], double*), 
-     void (*ode_Jac)(double, double [], double [], double*) ,
+     void (*ode_Fun)(double, double [], double [], KppContext*), 
+     void (*ode_Jac)(double, double [], double [], KppContext*) ,
   /*~~~> Input: The Rosenbrock method parameters */   
      int ros_S,
      double ros_M[], double ros_E[], 
@@ -506,7 +498,7 @@ int RosenbrockIntegrator(
   /*~~~> Output: time at which the solution is returned (T=Tend  if success)   
              and last accepted step  */     
      double *Texit, double *Hexit,
-     double *FIX ) 
+     KppContext *ctx ) 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
       Template for the implementation of a generic Rosenbrock method 
       defined by ros_S (no of stages) and coefficients ros_{A,C,M,E,Alpha,Gamma}
@@ -546,7 +538,7 @@ int RosenbrockIntegrator(
    while ( ( (Direction > 0) && ((T-Tend)+Roundoff <= ZERO) )
        || ( (Direction < 0) && ((Tend-T)+Roundoff <= ZERO) ) ) { 
       
-   if ( Nstp > Max_no_steps )  {                /* Too many steps */
+   if ( ctx->Nstp > Max_no_steps )  {                /* Too many steps */
         *Texit = T;
 	return ros_ErrorMsg(-6,T,H);
    }	
@@ -560,21 +552,21 @@ int RosenbrockIntegrator(
    H = MIN(H,ABS(Tend-T));
 
   /*~~~>   Compute the function at current time  */
-   (*ode_Fun)(T,Y,Fcn0, FIX);
+   (*ode_Fun)(T,Y,Fcn0, ctx);
 
   /*~~~>  Compute the function derivative with respect to T  */
    if (!Autonomous) 
-      ros_FunTimeDerivative ( T, Roundoff, Y, Fcn0, ode_Fun, dFdT, FIX );
+      ros_FunTimeDerivative ( T, Roundoff, Y, Fcn0, ode_Fun, dFdT, ctx );
   
   /*~~~>   Compute the Jacobian at current time  */
-   (*ode_Jac)(T,Y,Jac0, FIX);
+   (*ode_Jac)(T,Y,Jac0, ctx);
  
   /*~~~>  Repeat step calculation until current step accepted  */
    while (1) { /* WHILE STEP NOT ACCEPTED */
 
    
    if( ros_PrepareMatrix( &H, Direction, ros_Gamma[0],
-          Jac0, Ghimj, Pivot) ) { /* More than 5 consecutive failed decompositions */
+          Jac0, Ghimj, Pivot, ctx) ) { /* More than 5 consecutive failed decompositions */
        *Texit = T;
        return ros_ErrorMsg(-8,T,H);
    }
@@ -595,7 +587,7 @@ int RosenbrockIntegrator(
 	     WAXPY(127,ros_A[(istage-1)*(istage-2)/2+j-1],
                    &K[127*(j-1)],1,Ynew,1); 
 	   Tau = T + ros_Alpha[istage-1]*Direction*H;
-           (*ode_Fun)(Tau,Ynew,Fcn, FIX);
+           (*ode_Fun)(Tau,Ynew,Fcn, ctx);
 	} /*end if ros_NewF(istage)*/
       } /* end if istage */
 	 
@@ -610,7 +602,7 @@ int RosenbrockIntegrator(
 	WAXPY(127,HG,dFdT,1,&K[ioffset],1);
       } /* end if !Autonomous */
       
-      SolveTemplate(Ghimj, Pivot, &K[ioffset]);
+      SolveTemplate(Ghimj, Pivot, &K[ioffset], ctx);
 	 
    } /* for istage */	    
 	    
@@ -631,9 +623,9 @@ int RosenbrockIntegrator(
    Hnew = H*Fac;  
 
   /*~~~>  Check the error magnitude and adjust step size  */
-   Nstp++;
+   ctx->Nstp++;
    if ( (Err <= ONE) || (H <= Hmin) ) {    /*~~~> Accept step  */
-      Nacc++;
+      ctx->Nacc++;
       WCOPY(127,Ynew,1,Y,1);
       T += Direction*H;
       Hnew = MAX(Hmin,MIN(Hnew,Hmax));
@@ -644,8 +636,8 @@ int RosenbrockIntegrator(
       H = Hnew;
 	 break; /* EXIT THE LOOP: WHILE STEP NOT ACCEPTED */
    } else {             /*~~~> Reject step  */
-      if (Nacc >= 1) 
-         Nrej++;    
+      if (ctx->Nacc >= 1) 
+         ctx->Nrej++;    
       if (RejectMoreH) 
          Hnew=H*FacRej;   
       RejectMoreH = RejectLastH; RejectLastH = 1;
@@ -689,6 +681,10 @@ double ros_ErrorNorm (
      Err = Err+(Yerr[i]*Yerr[i])/(Scale*Scale);
    } /* for i */
    Err  = SQRT(Err/(double)127);
+   /* NaN counts as a failure, so that the step size shrinks until the
+    * integration stops with IERR = -7 instead of becoming NaN */
+   if ( Err != Err )
+      Err = 1.0E+10;
 
    return Err;
    
@@ -700,9 +696,9 @@ void ros_FunTimeDerivative (
     /*~~~> Input arguments: */ 
         double T, double Roundoff, 
         double Y[], double Fcn0[], 
-	void (*ode_Fun)(double, double [], double [], double*), 
+	void (*ode_Fun)(double, double [], double [], KppContext*), 
     /*~~~> Output arguments: */ 
-        double dFdT[], double* FIX )
+        double dFdT[], KppContext* ctx )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     The time partial derivative of the function by finite differences
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
@@ -711,7 +707,7 @@ void ros_FunTimeDerivative (
    double Delta;    
    
    Delta = SQRT(Roundoff)*MAX(DeltaMin,ABS(T));
-   (*ode_Fun)(T+Delta,Y,dFdT, FIX);
+   (*ode_Fun)(T+Delta,Y,dFdT, ctx);
    WAXPY(127,(-ONE),Fcn0,1,dFdT,1);
    WSCAL(127,(ONE/Delta),dFdT,1);
 
@@ -725,7 +721,7 @@ char ros_PrepareMatrix (
        /* Input arguments: */    
            int Direction,  double gam, double Jac0[], 
        /* Output arguments: */	  
-           double Ghimj[], int Pivot[] )
+           double Ghimj[], int Pivot[], KppContext* ctx )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   Prepares the LHS matrix for stage calculations
   1.  Construct Ghimj = 1/(H*ham) - Jac0
@@ -753,13 +749,13 @@ char ros_PrepareMatrix (
        Ghimj[LU_DIAG[i]] = Ghimj[LU_DIAG[i]]+ghinv;
      } /* for i */
   /*~~~>    Compute LU decomposition  */
-     DecompTemplate( Ghimj, Pivot, &ising );
+     DecompTemplate( Ghimj, Pivot, &ising, ctx );
      if (ising == 0) {
   /*~~~>    if successful done  */
         return 0;  /* Singular = false */
      } else { /* ising .ne. 0 */
   /*~~~>    if unsuccessful half the step size; if 5 consecutive fails return */
-        Nsng++; Nconsecutive++;
+        ctx->Nsng++; Nconsecutive++;
         printf("\nWarning: LU Decomposition returned ising = %d\n",ising);
         if (Nconsecutive <= 5) { /* Less than 5 consecutive failed LUs */
           *H = (*H)*HALF;
@@ -1187,7 +1183,7 @@ void Rodas4 ( int *ros_S, double ros_A[], double ros_C[],
    
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
-void DecompTemplate( double A[], int Pivot[], int* ising )
+void DecompTemplate( double A[], int Pivot[], int* ising, KppContext* ctx )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  
         Template for the LU decomposition   
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
@@ -1196,12 +1192,12 @@ void DecompTemplate( double A[], int Pivot[], int* ising )
   /*~~~> Note: for a full matrix use Lapack:
       DGETRF( 127, 127, A, 127, Pivot, ising ) */
     
-   Ndec++;
+   ctx->Ndec++;
 
 }  /*  DecompTemplate */
  
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
- void SolveTemplate( double A[], int Pivot[], double b[] )
+ void SolveTemplate( double A[], int Pivot[], double b[], KppContext* ctx )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  
      Template for the forward/backward substitution (using pre-computed LU decomposition)   
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
@@ -1211,13 +1207,13 @@ void DecompTemplate( double A[], int Pivot[], int* ising )
       NRHS = 1
       DGETRS( 'N', 127 , NRHS, A, 127, Pivot, b, 127, INFO ) */
      
-   Nsol++;
+   ctx->Nsol++;
 
 }  /*  SolveTemplate */
 
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
-void FunTemplate( double T, double Y[], double Ydot[], double* FIX )
+void FunTemplate( double T, double Y[], double Ydot[], KppContext* ctx )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ 
     Template for the ODE function call.
     Updates the rate coefficients (and possibly the fixed species) at each call    
@@ -1225,24 +1221,24 @@ void FunTemplate( double T, double Y[], double Ydot[], double* FIX )
 {
    double Told;     
 
-   Told = TIME;
-   TIME = T;
+   Told = ctx->TIME;
+   ctx->TIME = T;
    /* 10/18/2018 - T.Fritz: Calls to Update_SUN and Update_RCONST have been removed.
     * SUN is now computed before calling KPP and incorporated in the photolysis rates
     * RCONST is also computed before calling KPP as the rates don't change during the integration.
     * see: http://wiki.seas.harvard.edu/geos-chem/index.php/FlexChem#Remove_calls_to_UPDATE_SUN.2C_UPDATE_RCONST_from_gckpp_Integrator.F90 */
    //Update_SUN();
    //Update_RCONST();
-   Fun( Y, FIX, RCONST, Ydot );
-   TIME = Told;
+   Fun( Y, ctx->FIX(), ctx->RCONST, Ydot );
+   ctx->TIME = Told;
      
-   Nfun++;
+   ctx->Nfun++;
    
 }  /*  FunTemplate */
 
  
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
-void JacTemplate( double T, double Y[], double Jcb[], double* FIX )
+void JacTemplate( double T, double Y[], double Jcb[], KppContext* ctx )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~   
     Template for the ODE Jacobian call.
     Updates the rate coefficients (and possibly the fixed species) at each call    
@@ -1251,18 +1247,18 @@ void JacTemplate( double T, double Y[], double Jcb[], double* FIX )
   /*~~~> Local variables */
    double Told;     
 
-   Told = TIME;
-   TIME = T ; 
+   Told = ctx->TIME;
+   ctx->TIME = T ; 
    /* 10/18/2018 - T.Fritz: Calls to Update_SUN and Update_RCONST have been removed.
     * SUN is now computed before calling KPP and incorporated in the photolysis rates
     * RCONST is also computed before calling KPP as the rates don't change during the integration.
     * see: http://wiki.seas.harvard.edu/geos-chem/index.php/FlexChem#Remove_calls_to_UPDATE_SUN.2C_UPDATE_RCONST_from_gckpp_Integrator.F90 */
    //Update_SUN();
    //Update_RCONST();
-   Jac_SP( Y, FIX, RCONST, Jcb );
-   TIME = Told;
+   Jac_SP( Y, ctx->FIX(), ctx->RCONST, Jcb );
+   ctx->TIME = Told;
      
-   Njac++;
+   ctx->Njac++;
 
 } /* JacTemplate   */                                    
 
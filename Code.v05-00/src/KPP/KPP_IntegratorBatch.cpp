@@ -0,0 +1,470 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+/* Batched version of INTEGRATE: KPP_BATCH cells are advanced in lockstep
+ * with the same Rodas4 scheme and settings as KPP_Integrator.cpp. All cells
+ * share the sparsity pattern of the Jacobian, so every vector and LU entry
+ * is stored as KPP_BATCH consecutive lanes (index i*KPP_BATCH + lane) and
+ * the decomposition/substitution loops vectorize over the lanes. The ODE
+ * function and the Jacobian are the generated routines evaluated on
+ * KppLanes, so that this layout is also theirs.
+ *
+ * Step-size control is shared: the step is sized for the largest error
+ * over the batch. A cell that fails a step the others pass, or whose
+ * matrix is singular, leaves the batch and finishes with the scalar
+ * INTEGRATE from where it stood. */
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+
+#include "KPP/KPP_Parameters.h"
+#include "KPP/KPP_Sparse.h"
+#include "KPP/KPP.hpp"
+#include "KPP/KPP_Lanes.hpp"
+
+#define MAX(a,b) ( ((a) >= (b)) ?(a):(b)  )
+#define MIN(b,c) ( ((b) <  (c)) ?(b):(c)  )
+#define ABS(x)   ( ((x) >=  0 ) ?(x):(-x) )
+
+#define ZERO     (double)0.0
+#define ONE      (double)1.0
+#define DeltaMin (double)1.0e-6
+
+#define W KPP_BATCH
+
+double WLAMCH( char C );
+void Rodas4 ( int *ros_S, double ros_A[], double ros_C[],
+              double ros_M[], double ros_E[],
+              double ros_Alpha[], double ros_Gamma[],
+              char ros_NewF[], double *ros_ELO, char* ros_Name );
+
+/*~~~> ODE function on all lanes: Ydot = F(Y) */
+static void BatchFun( KppContext *ctx[], const bool active[],
+                      const KppLanes FIX[], const KppLanes RCONST[],
+                      const double Y[], double Ydot[] )
+{
+    Fun_Batch( reinterpret_cast<const KppLanes*>( Y ), FIX, RCONST, reinterpret_cast<KppLanes*>( Ydot ) );
+    for ( int l = 0; l < W; l++ )
+        if ( active[l] ) ctx[l]->Nfun++;
+}
+
+/*~~~> Sparse Jacobian on all lanes, in LU_NONZERO layout */
+static void BatchJac( KppContext *ctx[], const bool active[],
+                      const KppLanes FIX[], const KppLanes RCONST[],
+                      const double Y[], double JVS[] )
+{
+    Jac_SP_Batch( reinterpret_cast<const KppLanes*>( Y ), FIX, RCONST, reinterpret_cast<KppLanes*>( JVS ) );
+    for ( int l = 0; l < W; l++ )
+        if ( active[l] ) ctx[l]->Njac++;
+}
+
+/*~~~> Same elimination as KppDecomp, on all lanes at once.
+ *     ising[l] is set to k+1 for lanes with a vanishing pivot k */
+static void BatchDecomp( double JVS[], int ising[] )
+{
+    double Wk[NVAR*W];
+    double a[W];
+
+    for ( int l = 0; l < W; l++ )
+        ising[l] = 0;
+
+    for ( int k = 0; k < NVAR; k++ ) {
+        for ( int l = 0; l < W; l++ ) {
+            if ( ( ising[l] == 0 ) && ( ABS(JVS[LU_DIAG[k]*W+l]) < 1.00E-40 ) )
+                ising[l] = k+1;
+        }
+        for ( int kk = LU_CROW[k]; kk < LU_CROW[k+1]; kk++ ) {
+            #pragma omp simd
+            for ( int l = 0; l < W; l++ )
+                Wk[LU_ICOL[kk]*W+l] = JVS[kk*W+l];
+        }
+        for ( int kk = LU_CROW[k]; kk < LU_DIAG[k]; kk++ ) {
+            const int j = LU_ICOL[kk];
+            #pragma omp simd
+            for ( int l = 0; l < W; l++ ) {
+                a[l] = -Wk[j*W+l] / JVS[LU_DIAG[j]*W+l];
+                Wk[j*W+l] = -a[l];
+            }
+            for ( int jj = LU_DIAG[j]+1; jj < LU_CROW[j+1]; jj++ ) {
+                const int col = LU_ICOL[jj];
+                #pragma omp simd
+                for ( int l = 0; l < W; l++ )
+                    Wk[col*W+l] += a[l] * JVS[jj*W+l];
+            }
+        }
+        for ( int kk = LU_CROW[k]; kk < LU_CROW[k+1]; kk++ ) {
+            #pragma omp simd
+            for ( int l = 0; l < W; l++ )
+                JVS[kk*W+l] = Wk[LU_ICOL[kk]*W+l];
+        }
+    }
+}
+
+/*~~~> Same substitution as KppSolve, on all lanes at once */
+static void BatchSolve( const double JVS[], double X[] )
+{
+    for ( int k = 0; k < NVAR; k++ ) {
+        for ( int kk = LU_CROW[k]; kk < LU_DIAG[k]; kk++ ) {
+            const int j = LU_ICOL[kk];
+            #pragma omp simd
+            for ( int l = 0; l < W; l++ )
+                X[k*W+l] -= JVS[kk*W+l] * X[j*W+l];
+        }
+    }
+    for ( int k = NVAR-1; k >= 0; k-- ) {
+        for ( int kk = LU_DIAG[k]+1; kk < LU_CROW[k+1]; kk++ ) {
+            const int j = LU_ICOL[kk];
+            #pragma omp simd
+            for ( int l = 0; l < W; l++ )
+                X[k*W+l] -= JVS[kk*W+l] * X[j*W+l];
+        }
+        #pragma omp simd
+        for ( int l = 0; l < W; l++ )
+            X[k*W+l] /= JVS[LU_DIAG[k]*W+l];
+    }
+}
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/* RosenbrockBatch - integrates up to KPP_BATCH cells in lockstep   */
+/*   Cells leaving the batch have done[l] = 0 and are left at the   */
+/*   time Texit[l] with last step Hexit[l]                          */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+static void RosenbrockBatch( KppContext *ctx[], const int nCells,
+                             const double Tstart, const double Tend,
+                             const double AbsTol, const double RelTol,
+                             const double STEPMIN,
+                             bool done[], double Texit[], double Hexit[] )
+{
+    int ros_S;
+    double ros_M[6], ros_E[6], ros_A[15], ros_C[15];
+    double ros_Alpha[6], ros_Gamma[6], ros_ELO;
+    char ros_NewF[6], ros_Name[12];
+    Rodas4( &ros_S, ros_A, ros_C, ros_M, ros_E, ros_Alpha, ros_Gamma, ros_NewF, &ros_ELO, ros_Name );
+
+    /*~~~> Same defaults as Rosenbrock for INTEGRATE's settings */
+    const int Max_no_steps = 500000;
+    const double Roundoff = WLAMCH('E');
+    const double Hmin = ZERO;
+    const double Hmax = ABS(Tend-Tstart);
+    const double Hstart = ( STEPMIN == ZERO ) ? MAX(Hmin,DeltaMin) : MIN(ABS(STEPMIN),ABS(Tend-Tstart));
+    const double FacMin = 0.2, FacMax = 6.0, FacRej = 0.1, FacSafe = 0.9;
+#ifndef KPP_BATCH_MAXREJ
+#define KPP_BATCH_MAXREJ 3
+#endif
+    /*~~~> Consecutive rejections a lane may cause before it leaves the batch */
+    const int MaxLaneRej = KPP_BATCH_MAXREJ;
+
+    /* Stored as KppLanes for their alignment, addressed by lane */
+    std::vector<KppLanes> work( 2*LU_NONZERO + (5+ros_S)*NVAR );
+    double *Jac0  = reinterpret_cast<double*>( work.data() );
+    double *Ghimj = Jac0  + LU_NONZERO*W;
+    double *Y     = Ghimj + LU_NONZERO*W;
+    double *Ynew  = Y     + NVAR*W;
+    double *Fcn0  = Ynew  + NVAR*W;
+    double *Fcn   = Fcn0  + NVAR*W;
+    double *dFdT  = Fcn   + NVAR*W;
+    double *K     = dFdT  + NVAR*W;
+
+    bool active[W], pass[W];
+    int ising[W], laneRej[W] = {};
+    double Err[W];
+    KppContext *lane[W];
+
+    /* Unused lanes repeat the first cell so that they never see garbage */
+    for ( int l = 0; l < W; l++ ) {
+        lane[l]   = ( l < nCells ) ? ctx[l] : ctx[0];
+        active[l] = ( l < nCells );
+        done[l]   = ( l < nCells );
+        Texit[l]  = Tstart;
+        Hexit[l]  = ZERO;
+        for ( int i = 0; i < NVAR; i++ )
+            Y[i*W+l] = lane[l]->VAR()[i];
+    }
+
+    /* Fixed species and rates are constant over the integration */
+    std::vector<KppLanes> FIX( NFIX ), RCONST( NREACT );
+    for ( int l = 0; l < W; l++ ) {
+        for ( int i = 0; i < NFIX; i++ )
+            FIX[i][l] = lane[l]->FIX()[i];
+        for ( int i = 0; i < NREACT; i++ )
+            RCONST[i][l] = lane[l]->RCONST[i];
+    }
+
+    double T = Tstart;
+    double H = MIN(Hstart,Hmax);
+    if ( ABS(H) <= 10.0*Roundoff )
+        H = DeltaMin;
+    const int Direction = ( Tend >= Tstart ) ? +1 : -1;
+    char RejectLastH = 0, RejectMoreH = 0;
+    int Nstp = 0, Nacc = 0;
+
+    /*~~~> Takes lane l out of the batch at the current time, suggesting Hnext */
+    auto evict = [&]( int l, double Hnext ) {
+        active[l] = false;
+        done[l]   = false;
+        Texit[l]  = T;
+        Hexit[l]  = Hnext;
+    };
+    auto anyActive = [&]() {
+        for ( int l = 0; l < W; l++ )
+            if ( active[l] ) return true;
+        return false;
+    };
+
+    while ( anyActive() &&
+            ( ( (Direction > 0) && ((T-Tend)+Roundoff <= ZERO) )
+           || ( (Direction < 0) && ((Tend-T)+Roundoff <= ZERO) ) ) ) {
+
+        if ( ( Nstp > Max_no_steps ) || ( ((T+0.1*H) == T) || (H <= Roundoff) ) ) {
+            /* Let the scalar integrator report the failure for each cell */
+            for ( int l = 0; l < W; l++ )
+                if ( active[l] ) evict(l, H);
+            break;
+        }
+
+        H = MIN(H,ABS(Tend-T));
+
+        BatchFun( lane, active, FIX.data(), RCONST.data(), Y, Fcn0 );
+
+        /*~~~> Time derivative by finite differences, as in ros_FunTimeDerivative */
+        const double Delta = sqrt(Roundoff)*MAX(DeltaMin,ABS(T));
+        BatchFun( lane, active, FIX.data(), RCONST.data(), Y, dFdT );
+        #pragma omp simd
+        for ( int i = 0; i < NVAR*W; i++ )
+            dFdT[i] = ( dFdT[i] - Fcn0[i] ) / Delta;
+
+        BatchJac( lane, active, FIX.data(), RCONST.data(), Y, Jac0 );
+
+        while ( 1 ) { /* WHILE STEP NOT ACCEPTED */
+
+            /*~~~> Ghimj = 1/(H*gamma) - Jac0 */
+            const double ghinv = ONE/(Direction*H*ros_Gamma[0]);
+            #pragma omp simd
+            for ( int k = 0; k < LU_NONZERO*W; k++ )
+                Ghimj[k] = -Jac0[k];
+            for ( int i = 0; i < NVAR; i++ ) {
+                #pragma omp simd
+                for ( int l = 0; l < W; l++ )
+                    Ghimj[LU_DIAG[i]*W+l] += ghinv;
+            }
+            BatchDecomp( Ghimj, ising );
+            for ( int l = 0; l < W; l++ ) {
+                if ( active[l] ) {
+                    lane[l]->Ndec++;
+                    if ( ising[l] != 0 ) {
+                        lane[l]->Nsng++;
+                        evict(l, H*0.5);
+                    }
+                }
+            }
+            if ( !anyActive() )
+                break;
+
+            /*~~~> Stages */
+            for ( int istage = 1; istage <= ros_S; istage++ ) {
+                double *Ki = &K[NVAR*W*(istage-1)];
+                if ( istage == 1 ) {
+                    for ( int i = 0; i < NVAR*W; i++ )
+                        Fcn[i] = Fcn0[i];
+                } else if ( ros_NewF[istage-1] ) {
+                    for ( int i = 0; i < NVAR*W; i++ )
+                        Ynew[i] = Y[i];
+                    for ( int j = 1; j <= istage-1; j++ ) {
+                        const double Aij = ros_A[(istage-1)*(istage-2)/2+j-1];
+                        const double *Kj = &K[NVAR*W*(j-1)];
+                        #pragma omp simd
+                        for ( int i = 0; i < NVAR*W; i++ )
+                            Ynew[i] += Aij * Kj[i];
+                    }
+                    BatchFun( lane, active, FIX.data(), RCONST.data(), Ynew, Fcn );
+                }
+
+                for ( int i = 0; i < NVAR*W; i++ )
+                    Ki[i] = Fcn[i];
+                for ( int j = 1; j <= istage-1; j++ ) {
+                    const double HC = ros_C[(istage-1)*(istage-2)/2+j-1]/(Direction*H);
+                    const double *Kj = &K[NVAR*W*(j-1)];
+                    #pragma omp simd
+                    for ( int i = 0; i < NVAR*W; i++ )
+                        Ki[i] += HC * Kj[i];
+                }
+                if ( ros_Gamma[istage-1] ) {
+                    const double HG = Direction*H*ros_Gamma[istage-1];
+                    #pragma omp simd
+                    for ( int i = 0; i < NVAR*W; i++ )
+                        Ki[i] += HG * dFdT[i];
+                }
+
+                BatchSolve( Ghimj, Ki );
+                for ( int l = 0; l < W; l++ )
+                    if ( active[l] ) lane[l]->Nsol++;
+            }
+
+            /*~~~> New solution and error estimate (scalar tolerances, as INTEGRATE) */
+            for ( int i = 0; i < NVAR*W; i++ )
+                Ynew[i] = Y[i];
+            for ( int j = 1; j <= ros_S; j++ ) {
+                const double *Kj = &K[NVAR*W*(j-1)];
+                #pragma omp simd
+                for ( int i = 0; i < NVAR*W; i++ )
+                    Ynew[i] += ros_M[j-1] * Kj[i];
+            }
+            for ( int l = 0; l < W; l++ )
+                Err[l] = ZERO;
+            for ( int i = 0; i < NVAR; i++ ) {
+                for ( int l = 0; l < W; l++ ) {
+                    double Yerr = ZERO;
+                    for ( int j = 1; j <= ros_S; j++ )
+                        Yerr += ros_E[j-1] * K[NVAR*W*(j-1) + i*W+l];
+                    const double Ymax  = MAX(ABS(Y[i*W+l]),ABS(Ynew[i*W+l]));
+                    const double Scale = AbsTol + RelTol*Ymax;
+                    Err[l] += (Yerr*Yerr)/(Scale*Scale);
+                }
+            }
+
+            /*~~~> The step is accepted if every lane passes and sized for the
+             *     worst one. A lane that keeps failing steps the others would
+             *     pass is handed to the scalar integrator */
+            bool anyPass = false, allPass = true;
+            for ( int l = 0; l < W; l++ ) {
+                if ( !active[l] ) continue;
+                Err[l] = sqrt(Err[l]/(double)NVAR);
+                /* NaN counts as a failure */
+                if ( Err[l] != Err[l] )
+                    Err[l] = 1.0E+10;
+                pass[l] = ( Err[l] <= ONE ) || ( H <= Hmin );
+                anyPass = anyPass || pass[l];
+                allPass = allPass && pass[l];
+            }
+            double ErrMax = ZERO;
+            for ( int l = 0; l < W; l++ ) {
+                if ( !active[l] ) continue;
+                if ( !pass[l] && anyPass && ( ++laneRej[l] > MaxLaneRej ) ) {
+                    evict(l, H*MIN(FacMax,MAX(FacMin,FacSafe/pow(Err[l],ONE/ros_ELO))));
+                    continue;
+                }
+                ErrMax = MAX(ErrMax, Err[l]);
+            }
+            if ( anyPass ) {
+                /* Only lanes that passed may be left */
+                allPass = true;
+                for ( int l = 0; l < W; l++ )
+                    allPass = allPass && ( !active[l] || pass[l] );
+            }
+
+            Nstp++;
+            for ( int l = 0; l < W; l++ )
+                if ( active[l] ) lane[l]->Nstp++;
+
+            if ( !anyActive() )
+                break;
+
+            if ( allPass ) {    /*~~~> Accept step  */
+                for ( int l = 0; l < W; l++ )
+                    laneRej[l] = 0;
+                double Fac  = MIN(FacMax,MAX(FacMin,FacSafe/pow(ErrMax,ONE/ros_ELO)));
+                double Hnew = H*Fac;
+                Nacc++;
+                for ( int l = 0; l < W; l++ ) {
+                    if ( !active[l] ) continue;
+                    lane[l]->Nacc++;
+                    for ( int i = 0; i < NVAR; i++ )
+                        Y[i*W+l] = Ynew[i*W+l];
+                    Hexit[l] = H;
+                }
+                T += Direction*H;
+                Hnew = MAX(Hmin,MIN(Hnew,Hmax));
+                /* No step size increase after a rejected step  */
+                if ( RejectLastH )
+                    Hnew = MIN(Hnew,H);
+                RejectLastH = 0; RejectMoreH = 0;
+                H = Hnew;
+                break; /* EXIT THE LOOP: WHILE STEP NOT ACCEPTED */
+            } else {            /*~~~> Reject step  */
+                double Fac  = MIN(FacMax,MAX(FacMin,FacSafe/pow(ErrMax,ONE/ros_ELO)));
+                double Hnew = H*Fac;
+                if ( Nacc >= 1 ) {
+                    for ( int l = 0; l < W; l++ )
+                        if ( active[l] ) lane[l]->Nrej++;
+                }
+                if ( RejectMoreH )
+                    Hnew = H*FacRej;
+                RejectMoreH = RejectLastH; RejectLastH = 1;
+                H = Hnew;
+            }
+
+        } /* while LOOP: WHILE STEP NOT ACCEPTED */
+
+    } /* while: time loop */
+
+    for ( int l = 0; l < nCells; l++ ) {
+        if ( done[l] )
+            Texit[l] = T;
+        for ( int i = 0; i < NVAR; i++ )
+            ctx[l]->VAR()[i] = Y[i*W+l];
+    }
+}
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/* INTEGRATE_BATCH - Integrates nCells cells from TIN to TOUT,      */
+/*   KPP_BATCH at a time.                                           */
+/*   Arguments :                                                    */
+/*      ctx       - Chemical state of each cell (VAR updated)       */
+/*      IERR      - Return code of each cell, as for INTEGRATE      */
+/*   Returns the number of cells that fell back to INTEGRATE        */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+int INTEGRATE_BATCH( KppContext *ctx[], int IERR[], int nCells,
+                     double TIN, double TOUT,
+                     double ATOL[], double RTOL[], double STEPMIN )
+{
+
+    int nScalar = 0;
+
+    for ( int n0 = 0; n0 < nCells; n0 += W ) {
+        const int nBatch = MIN(W, nCells-n0);
+        bool done[W];
+        double Texit[W], Hexit[W];
+
+        for ( int l = 0; l < nBatch; l++ ) {
+            KppContext *c = ctx[n0+l];
+            c->Nfun = 0; c->Njac = 0; c->Nstp = 0; c->Nacc = 0;
+            c->Nrej = 0; c->Ndec = 0; c->Nsol = 0; c->Nsng = 0;
+        }
+
+        RosenbrockBatch( &ctx[n0], nBatch, TIN, TOUT, ATOL[0], RTOL[0], STEPMIN, done, Texit, Hexit );
+
+        for ( int l = 0; l < nBatch; l++ ) {
+            KppContext *c = ctx[n0+l];
+            if ( done[l] ) {
+                IERR[n0+l] = 1;
+                continue;
+            }
+            /* Finish this cell on its own, keeping the batch statistics */
+            const int Nfun = c->Nfun, Njac = c->Njac, Nstp = c->Nstp, Nacc = c->Nacc;
+            const int Nrej = c->Nrej, Ndec = c->Ndec, Nsol = c->Nsol, Nsng = c->Nsng;
+            IERR[n0+l] = INTEGRATE( *c, Texit[l], TOUT, ATOL, RTOL, Hexit[l] );
+            c->Nfun += Nfun; c->Njac += Njac; c->Nstp += Nstp; c->Nacc += Nacc;
+            c->Nrej += Nrej; c->Ndec += Ndec; c->Nsol += Nsol; c->Nsng += Nsng;
+            nScalar++;
+        }
+    }
+
+    return nScalar;
+
+} /* INTEGRATE_BATCH */
+
+#undef W
+
+/* End of INTEGRATE_BATCH function                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
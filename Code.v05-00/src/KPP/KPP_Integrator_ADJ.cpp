@@ -69,7 +69,7 @@ char ros_Name[12]; /* Length 12 */
 
 /*~~~>  Types of Adjoints Implemented */
 enum adjoint { Adj_none=1, Adj_discrete=2, Adj_continuous=3,
-	       Adj_simple_continuous=4 };
+	       Adj_simple_continuous=4, Adj_checkpoint=5 };
 
 /*~~~>  Checkpoints in memory */
 int bufsize = 200000;
@@ -80,11 +80,11 @@ double **chk_dY, **chk_d2Y; /* 2D arrays */
 #pragma omp threadprivate(stack_ptr)
 #pragma omp threadprivate(chk_H, chk_T, chk_Y, chk_K, chk_J, chk_dY, chk_d2Y)
 
+/*~~~>  Chemical state (fixed species and rates) of the current integration */
+KppContext *adjCtx;
+#pragma omp threadprivate(adjCtx)
+
 /* Function Headers */
-int INTEGRATE_ADJ(int NADJ, double Y[], double Lambda[][NVAR],
-                  double TIN, double TOUT, double ATOL_adj[][NVAR],
-		          double RTOL_adj[][NVAR], int ICNTRL_U[],
-                  double RCNTRL_U[], int ISTATUS_U[], double RSTATUS_U[]);
 int RosenbrockADJ( double Y[], int NADJ, double Lambda[][NVAR],
 		           double Tstart, double Tend, double AbsTol[],
         		   double RelTol[], double AbsTol_adj[][NVAR],
@@ -94,14 +94,15 @@ void ros_AllocateDBuffers( int S, int SaveLU );
 void ros_FreeDBuffers( int SaveLU );
 void ros_AllocateCBuffers();
 void ros_FreeCBuffers();
+void ros_AllocateRBuffers();
+void ros_FreeRBuffers();
+void ros_RPush( double T, double H );
 void ros_DPush( int S, double T, double H, double Ystage[],
 	        	double K[], double E[], int P[], int SaveLU );
 void ros_DPop( int S, double* T, double* H, double* Ystage,
     	       double* K, double* E, int* P, int SaveLU );
 void ros_CPush( double T, double H, double Y[], double dY[],
 		        double d2Y[] );
-void ros_CPop( double T, double H, double Y[], double dY[],
-    	       double d2Y[] );
 int ADJ_ros_ErrorMsg( int Code );
 int ros_FwdInt (double Y[], double Tstart, double Tend, double T,
 		        double AbsTol[], double RelTol[], int AdjointType,
@@ -113,6 +114,18 @@ int ros_FwdInt (double Y[], double Tstart, double Tend, double T,
 int ros_DadjInt ( int NADJ, double Lambda[][NVAR], double Tstart,
 		          double Tend, double T, int SaveLU, int ISTATUS[],
 		          double Roundoff, int Autonomous);
+void ros_DadjStep ( int NADJ, double Lambda[][NVAR], double T, double H,
+		            int Direction, double Ystage[], double K[],
+		            double Ghimj[], int Pivot[], int SaveLU,
+		            int ISTATUS[], double Roundoff, int Autonomous );
+int ros_ReplayStep ( double Y[], double T, double H, int Direction,
+		             double Ystage[], double K[], double Ghimj[],
+		             int Pivot[], int ISTATUS[], double Roundoff,
+		             int Autonomous );
+long ros_Beta ( int c, int r, long cap );
+int ros_CheckpointDadjInt ( int NADJ, double Lambda[][NVAR], double Y0[],
+		                    double Tstart, double Tend, int Ncheck,
+		                    int ISTATUS[], double Roundoff, int Autonomous );
 int ros_CadjInt ( int NADJ, double Y[][NVAR], double Tstart, double Tend,
 		          double T, double AbsTol_adj[][NVAR],
 		          double RelTol_adj[][NVAR], double RSTATUS[],
@@ -154,7 +167,6 @@ void WAXPY( int N, double Alpha, double X[], int incX, double Y[],
     	    int incY );
 void WCOPY( int N, double X[], int incX, double Y[], int incY );
 double WLAMCH( char C );
-void Update_PHOTO( );
 void Fun( double Y[], double FIX[], double RCONST[], double Ydot[] );
 void Jac_SP( double Y[], double FIX[], double RCONST[], double Ydot[]);
 void Jac_SP_Vec( double Jac[], double Fcn[], double K[] );
@@ -166,7 +178,8 @@ void KppSolveTR( double JVS[], double X[], double XX[] );
 void Hessian( double V[], double F[], double RCT[], double Hess[] );
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-int INTEGRATE_ADJ( int NADJ, double Y[], double Lambda[][NVAR],
+int INTEGRATE_ADJ( KppContext &ctx,
+                   int NADJ, double Y[], double Lambda[][NVAR],
 	               double TIN, double TOUT, double ATOL_adj[][NVAR],
 		           double RTOL_adj[][NVAR], double ATOL[],
                    double RTOL[], int ICNTRL_U[],
@@ -197,6 +210,8 @@ int INTEGRATE_ADJ( int NADJ, double Y[], double Lambda[][NVAR],
 
 /* if optional parameters are given, and if they are >=0, then they overwrite
    default settings */
+    RCNTRL[2] = STEPMIN; /* starting step */
+
     if(ICNTRL_U != NULL) {
         for(i=0; i<20; i++) {
             if(ICNTRL_U[i] > 0) {
@@ -213,25 +228,24 @@ int INTEGRATE_ADJ( int NADJ, double Y[], double Lambda[][NVAR],
         } /* end for */
     } /* end if */
 
+    adjCtx = &ctx;
     IERR = RosenbrockADJ( Y, NADJ, Lambda, TIN, TOUT, ATOL, RTOL, ATOL_adj,
 	                	  RTOL_adj, RCNTRL, ICNTRL, RSTATUS, ISTATUS );
 
 //  if (IERR < 0)
 //    printf( "RosenbrockADJ: Unsucessful step at T=%f (IERR=%d)", TIN/3600, IERR );
 
-    STEPMIN = RSTATUS[Nhexit];
-
 /* if optional parameters are given for output
          copy to them to return information */
-//    if(ISTATUS_U != NULL) {
-//        for(i=0; i<20; i++)
-//        	ISTATUS_U[i] = ISTATUS[i];
-//    }
-
-//    if(RSTATUS_U != NULL) {
-//        for(i=0; i<20; i++)
-//        	RSTATUS_U[i] = RSTATUS[i];
-//    }
+    if(ISTATUS_U != NULL) {
+        for(i=0; i<20; i++)
+        	ISTATUS_U[i] = ISTATUS[i];
+    }
+
+    if(RSTATUS_U != NULL) {
+        for(i=0; i<20; i++)
+        	RSTATUS_U[i] = RSTATUS[i];
+    }
   
   return IERR;
 
@@ -349,6 +363,14 @@ int RosenbrockADJ( double Y[], int NADJ, double Lambda[][NVAR],
         ICNTRL[7]=1 : save LU factorization
         Note: if ICNTRL[7]=1 the LU factorization is *not* saved
 
+    ICNTRL[8]  -> number of state checkpoints for the discrete adjoint:
+        ICNTRL[8]=0 : store the stages of every forward step (the default)
+        ICNTRL[8]=c : only store the accepted (T,H) sequence and at most c
+                      intermediate states; the stages are recomputed during
+                      the backward sweep following a binomial (revolve)
+                      schedule. Memory is O(c*NVAR) instead of
+                      O(Nsteps*S*NVAR), at the cost of extra forward steps.
+
 ~~~>  Real input parameters:
 
     RCNTRL[0]  -> Hmin, lower bound for the integration step size
@@ -399,8 +421,9 @@ int RosenbrockADJ( double Y[], int NADJ, double Lambda[][NVAR],
     double Roundoff, FacMin, FacMax, FacRej, FacSafe;
     double Hmin, Hmax, Hstart;
     double Texit=0.0;
+    double Y0[NVAR];
     int i, UplimTol, Max_no_steps=0, IERR;
-    int AdjointType=0, CadjMethod=0;
+    int AdjointType=0, CadjMethod=0, Ncheck=0;
     int Autonomous, VectorTol, SaveLU; /* Holds boolean values */
 
     stack_ptr = -1;
@@ -485,6 +508,16 @@ int RosenbrockADJ( double Y[], int NADJ, double Lambda[][NVAR],
 /*~~~> Save or not the forward LU factorization */
     SaveLU = (ICNTRL[7] != 0);
 
+/*~~~>  Checkpointed discrete adjoint: stages are recomputed on the way back */
+    if ( ICNTRL[8] < 0 ) {
+        printf( "User-selected no. of checkpoints: ICNTRL[8]=%d", ICNTRL[8] );
+        return ADJ_ros_ErrorMsg( -9 );
+    }
+    if ( (AdjointType == Adj_discrete) && (ICNTRL[8] > 0) ) {
+        AdjointType = Adj_checkpoint;
+        Ncheck = ICNTRL[8];
+    }
+
 /*~~~>  Unit roundoff (1+Roundoff>1)  */
     Roundoff = WLAMCH('E');
 
@@ -575,6 +608,10 @@ int RosenbrockADJ( double Y[], int NADJ, double Lambda[][NVAR],
 	        (AdjointType == Adj_simple_continuous) ) {
         ros_AllocateCBuffers();
     }
+    else if (AdjointType == Adj_checkpoint) {
+        ros_AllocateRBuffers();
+        WCOPY(NVAR,Y,1,Y0,1);
+    }
 
 /*~~~>  CALL Forward Rosenbrock method */
     IERR = ros_FwdInt(Y, Tstart, Tend, Texit, AbsTol, RelTol, AdjointType, Hmin,
@@ -636,6 +673,10 @@ int RosenbrockADJ( double Y[], int NADJ, double Lambda[][NVAR],
 //            printf("Adjoint simple continuous\n");
             IERR = ros_SimpleCadjInt (NADJ, Lambda, Tstart, Tend, Texit, ISTATUS,
 				                      Autonomous, Roundoff);
+            break;
+        case Adj_checkpoint:
+            IERR = ros_CheckpointDadjInt (NADJ, Lambda, Y0, Tstart, Tend, Ncheck,
+                                          ISTATUS, Roundoff, Autonomous );
     } /* End switch for AdjointType */
 
 //    printf( "ADJOINT STATISTICS\n" );
@@ -649,6 +690,8 @@ int RosenbrockADJ( double Y[], int NADJ, double Lambda[][NVAR],
     else if ( (AdjointType == Adj_continuous) ||
 	        (AdjointType == Adj_simple_continuous) )
         ros_FreeCBuffers();
+    else if (AdjointType == Adj_checkpoint)
+        ros_FreeRBuffers();
 
 //    if ( IERR == 1 ) {}
 //        printf("\nAdjoint integration successful!\n");
@@ -839,6 +882,52 @@ void ros_FreeCBuffers() {
 
 } /* End of ros_FreeCBuffers */
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+void ros_AllocateRBuffers() {
+/*~~~>  Allocate buffer space for the checkpointed discrete adjoint:
+        only the accepted (T,H) sequence is recorded
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    chk_H = (double*) malloc(bufsize * sizeof(double));
+    if (chk_H == NULL) {
+        printf( "Failed allocation of buffer H" );
+        exit(0);
+    }
+
+    chk_T = (double*) malloc(bufsize * sizeof(double));
+    if (chk_T == NULL) {
+        printf( "Failed allocation of buffer T" );
+        exit(0);
+    }
+
+} /* End of ros_AllocateRBuffers */
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+void ros_FreeRBuffers() {
+/*~~~>  Deallocate buffer space for the checkpointed discrete adjoint
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(chk_H);
+    free(chk_T);
+
+} /* End of ros_FreeRBuffers */
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+void ros_RPush( double T, double H ) {
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+~~~> Records the next accepted step for checkpointed discrete adjoints
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    stack_ptr = stack_ptr + 1;
+    if ( stack_ptr >= bufsize ) {
+        printf( "Push failed: buffer overflow" );
+        exit(0);
+    }
+    chk_H[ stack_ptr ] = H;
+    chk_T[ stack_ptr ] = T;
+
+} /* End of ros_RPush */
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 void ros_DPush( int S, double T, double H, double Ystage[],
 		double K[], double E[], int P[], int SaveLU ) {
@@ -870,6 +959,7 @@ void ros_DPush( int S, double T, double H, double Ystage[],
             chk_P[stack_ptr][j] = P[j];
         }
 #else
+        (void) P; /* No pivoting in the sparse LU */
         for(i=0; i<LU_NONZERO; i++)
             chk_J[stack_ptr][i] = E[i];
 #endif
@@ -908,6 +998,7 @@ void ros_DPop( int S, double* T, double* H, double* Ystage,
             P[i] = chk_P[stack_ptr][i];
         }
 #else
+        (void) P; /* No pivoting in the sparse LU */
         for(i=0; i<LU_NONZERO; i++)
             E[i] = chk_J[stack_ptr][i];
 #endif
@@ -942,32 +1033,6 @@ void ros_CPush( double T, double H, double Y[], double dY[],
 
 } /* End of ros_CPush */
 
-/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-void ros_CPop( double T, double H, double Y[], double dY[],
-	       double d2Y[] ) {
-/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-~~~> Retrieves the next trajectory snapshot for discrete adjoints
-~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-    int i;
-
-    if ( stack_ptr <= 0 ) {
-        printf( "Pop failed: empty buffer" );
-        exit(0);
-    }
-    H = chk_H[ stack_ptr ];
-    T = chk_T[ stack_ptr ];
-
-    for(i=0; i<NVAR; i++) {
-        Y[i] = chk_Y[stack_ptr][i];
-        dY[i] = chk_dY[stack_ptr][i];
-        d2Y[i] = chk_d2Y[stack_ptr][i];
-    }
-
-    stack_ptr--;
-
-} /* End of ros_CPop */
-
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 int ADJ_ros_ErrorMsg( int Code ) {
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1190,6 +1255,9 @@ int ros_FwdInt ( double Y[], double Tstart, double Tend, double T,
 	                    WAXPY(NVAR,ONE,dFdT,1,&K[0],1);
 	                ros_CPush( T, H, Y, Fcn0, &K[0] );
 	            }
+	            else if (AdjointType == Adj_checkpoint) { /* Save step only */
+	                ros_RPush( T, H );
+	            }
 	            WCOPY(NVAR,Ynew,1,Y,1);
 	            T = T + Direction*H;
 	            Hnew = MAX(Hmin,MIN(Hnew,Hmax));
@@ -1263,17 +1331,13 @@ int ros_DadjInt ( int NADJ, double Lambda[][NVAR], double Tstart,
 
 /*~~~~ Local variables */
     double Ystage[NVAR*ros_S], K[NVAR*ros_S];
-    double U[NADJ][NVAR*ros_S], V[NADJ][NVAR*ros_S];
 #ifdef FULL_ALGEBRA
-    double Jac[NVAR][NVAR], dJdT[NVAR][NVAR], Ghimj[NVAR][NVAR];
+    double Ghimj[NVAR][NVAR];
 #else
-    double Jac[LU_NONZERO], dJdT[LU_NONZERO], Ghimj[LU_NONZERO];
+    double Ghimj[LU_NONZERO];
 #endif
-    double Hes0[NHESS];
-    double Tmp[NVAR], Tmp2[NVAR];
-    double H=0.0, HC, HA, Tau;
+    double H=0.0;
     int Pivot[NVAR], Direction;
-    int i, j, m, istage, istart, jstart;
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     if (Tend  >=  Tstart)
@@ -1281,116 +1345,377 @@ int ros_DadjInt ( int NADJ, double Lambda[][NVAR], double Tstart,
     else
         Direction = -1;
 
-    /*~~~> Time loop begins below */
-    while ( stack_ptr > 0 ) { /* TimeLoop */
+    /*~~~> Time loop begins below. The stack is 0-based (stack_ptr starts
+     *     at -1), unlike the 1-based one of the Fortran KPP this was
+     *     translated from: entry 0 holds the first step */
+    while ( stack_ptr >= 0 ) { /* TimeLoop */
 
         /*~~~>  Recover checkpoints for stage values and vectors */
         ros_DPop( ros_S, &T, &H, &Ystage[0], &K[0], &Ghimj[0], &Pivot[0], SaveLU );
 
-        /*~~~>    Compute LU decomposition */
-        if (!SaveLU) {
-            ADJ_JacTemplate(T,&Ystage[0],Ghimj);
-            ISTATUS[Njac] = ISTATUS[Njac] + 1;
-            Tau = ONE/(Direction*H*ros_Gamma[0]);
+        ros_DadjStep( NADJ, Lambda, T, H, Direction, Ystage, K, Ghimj, Pivot,
+                      SaveLU, ISTATUS, Roundoff, Autonomous );
+
+    } /* End of TimeLoop */
+
+    /*~~~> Save last state */
+    /*~~~> Succesful exit */
+    return 1;  /*~~~> The integration was successful */
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+} /* End of ros_DadjInt */
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+void ros_DadjStep ( int NADJ, double Lambda[][NVAR], double T, double H,
+		            int Direction, double Ystage[], double K[],
+		            double Ghimj[], int Pivot[], int SaveLU,
+		            int ISTATUS[], double Roundoff, int Autonomous ) {
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   Propagates the discrete adjoint Lambda backwards over one forward step
+   T -> T+Direction*H, given its stage values Ystage and vectors K.
+   If SaveLU, Ghimj and Pivot hold the LU factorization of the step.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*~~~~ Local variables */
+    double U[NADJ][NVAR*ros_S], V[NADJ][NVAR*ros_S];
+#ifdef FULL_ALGEBRA
+    double Jac[NVAR][NVAR], dJdT[NVAR][NVAR];
+#else
+    double Jac[LU_NONZERO], dJdT[LU_NONZERO];
+#endif
+    double Hes0[NHESS];
+    double Tmp[NVAR], Tmp2[NVAR];
+    double HC, HA, Tau;
+    int i, j, m, istage, istart, jstart;
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*~~~>    Compute LU decomposition */
+    if (!SaveLU) {
+        ADJ_JacTemplate(T,&Ystage[0],Ghimj);
+        ISTATUS[Njac] = ISTATUS[Njac] + 1;
+        Tau = ONE/(Direction*H*ros_Gamma[0]);
 #ifdef FULL_ALGEBRA
-            for(j=0; j<NVAR; j++) {
+        for(j=0; j<NVAR; j++) {
 	            for(i=0; i<NVAR; i++)
 	                Ghimj[i][j] = -Ghimj[i][j];
-            }
-            for(i=0; i<NVAR; i++)
+        }
+        for(i=0; i<NVAR; i++)
 	            Ghimj[i][i] = Ghimj[i][i]+Tau;
 #else
-            WSCAL(LU_NONZERO,(-ONE),Ghimj,1);
-            for (i=0; i<NVAR; i++)
+        WSCAL(LU_NONZERO,(-ONE),Ghimj,1);
+        for (i=0; i<NVAR; i++)
 	            Ghimj[LU_DIAG[i]] = Ghimj[LU_DIAG[i]]+Tau;
 #endif
-            ros_Decomp(Ghimj, Pivot, &j, ISTATUS);
-        }
+        ros_Decomp(Ghimj, Pivot, &j, ISTATUS);
+    }
 
 /*~~~>   Compute Hessian at the beginning of the interval */
-        ADJ_HessTemplate(T,&Ystage[0],Hes0);
+    ADJ_HessTemplate(T,&Ystage[0],Hes0);
 
 /*~~~>   Compute the stages */
-        for (istage = ros_S - 1; istage >= 0; istage--) { /* Stage loop */
-
-            /*~~~> Current istage first entry */
-            istart = NVAR*istage;
-
-            /*~~~> Compute U */
-            for (m = 0; m<NADJ; m++) {
-                WCOPY(NVAR,&Lambda[m][0],1,&U[m][istart],1);
-                WSCAL(NVAR,ros_M[istage],&U[m][istart],1);
-            } /* m=0:NADJ-1 */
-            for (j = istage+1; j < ros_S; j++) {
-                jstart = NVAR*j;
-                HA = ros_A[j*(j-1)/2+istage];
-                HC = ros_C[j*(j-1)/2+istage]/(Direction*H);
-                for ( m = 0; m < NADJ; m++ ) {
-                    WAXPY(NVAR,HA,&V[m][jstart],1,&U[m][istart],1);
-                    WAXPY(NVAR,HC,&U[m][jstart],1,&U[m][istart],1);
+    for (istage = ros_S - 1; istage >= 0; istage--) { /* Stage loop */
+
+        /*~~~> Current istage first entry */
+        istart = NVAR*istage;
+
+        /*~~~> Compute U */
+        for (m = 0; m<NADJ; m++) {
+            WCOPY(NVAR,&Lambda[m][0],1,&U[m][istart],1);
+            WSCAL(NVAR,ros_M[istage],&U[m][istart],1);
+        } /* m=0:NADJ-1 */
+        for (j = istage+1; j < ros_S; j++) {
+            jstart = NVAR*j;
+            HA = ros_A[j*(j-1)/2+istage];
+            HC = ros_C[j*(j-1)/2+istage]/(Direction*H);
+            for ( m = 0; m < NADJ; m++ ) {
+                WAXPY(NVAR,HA,&V[m][jstart],1,&U[m][istart],1);
+                WAXPY(NVAR,HC,&U[m][jstart],1,&U[m][istart],1);
 	            } /* m=0:NADJ-1 */
-            }
-            for ( m = 0; m < NADJ; m++ )
+        }
+        for ( m = 0; m < NADJ; m++ )
 	            ros_Solve('T', Ghimj, Pivot, &U[m][istart], ISTATUS); /* m=1:NADJ-1 */
 
-            /*~~~> Compute V */
-            Tau = T + ros_Alpha[istage]*Direction*H;
-            ADJ_JacTemplate(Tau,&Ystage[istart],Jac);
-            ISTATUS[Njac]++;
-            for ( m = 0; m < NADJ; m++ ) {
+        /*~~~> Compute V */
+        Tau = T + ros_Alpha[istage]*Direction*H;
+        ADJ_JacTemplate(Tau,&Ystage[istart],Jac);
+        ISTATUS[Njac]++;
+        for ( m = 0; m < NADJ; m++ ) {
 #ifdef FULL_ALGEBRA
 	            for (i=istart; i < istart+NVAR-1; i++ )
 	                V[[m][i] = MATMUL(TRANSPOSE(Jac),U[m][i]];
 #else
 	            JacTR_SP_Vec(Jac,&U[m][istart],&V[m][istart]);
 #endif
-            } /* m=0:NADJ-1 */
-        } /*End of Stage loop */
+        } /* m=0:NADJ-1 */
+    } /*End of Stage loop */
 
-        if (!Autonomous)
+    if (!Autonomous)
 /*~~~>  Compute the Jacobian derivative with respect to T.
-        Last "Jac" computed for stage 1 */
-            ros_JacTimeDerivative ( T, Roundoff, &Ystage[0], Jac, dJdT, ISTATUS );
+    Last "Jac" computed for stage 1 */
+        ros_JacTimeDerivative ( T, Roundoff, &Ystage[0], Jac, dJdT, ISTATUS );
 
 /*~~~>  Compute the new solution */
-        /*~~~>  Compute Lambda */
-        for( istage = 0; istage < ros_S; istage++ ) {
-            istart = NVAR*istage;
-            for (m = 0; m < NADJ; m++) {
+    /*~~~>  Compute Lambda */
+    for( istage = 0; istage < ros_S; istage++ ) {
+        istart = NVAR*istage;
+        for (m = 0; m < NADJ; m++) {
 	            /* Add V_i */
 	            WAXPY(NVAR,ONE,&V[m][istart],1,&Lambda[m][0],1);
 	            /* Add (H0xK_i)^T * U_i */
 	            HessTR_Vec ( Hes0, &U[m][istart], &K[istart], Tmp );
 	            WAXPY(NVAR,ONE,Tmp,1,&Lambda[m][0],1);
-            } /* m=0:NADJ-1 */
-        }
+        } /* m=0:NADJ-1 */
+    }
 
-        /* Add H * dJac_dT_0^T * \sum(gamma_i U_i) */
-        /* Tmp holds sum gamma_i U_i */
-        if (!Autonomous) {
-            for( m = 0; m < NADJ; m++ ) {
+    /* Add H * dJac_dT_0^T * \sum(gamma_i U_i) */
+    /* Tmp holds sum gamma_i U_i */
+    if (!Autonomous) {
+        for( m = 0; m < NADJ; m++ ) {
 	            for(i=0; i<NVAR; i++)
 	                Tmp[i] = ZERO;
 	            for( istage = 0; istage < ros_S; istage++ ) {
-                    istart = NVAR*istage;
-                    WAXPY(NVAR,ros_Gamma[istage],&U[m][istart],1,Tmp,1);
-                }
+                istart = NVAR*istage;
+                WAXPY(NVAR,ros_Gamma[istage],&U[m][istart],1,Tmp,1);
+            }
+#ifdef FULL_ALGEBRA
+            Tmp2 = MATMUL(TRANSPOSE(dJdT),Tmp);
+#else
+            JacTR_SP_Vec(dJdT,Tmp,Tmp2);
+#endif
+            WAXPY(NVAR,H,Tmp2,1,&Lambda[m][0],1);
+        } /* m=0:NADJ-1 */
+    } /* .NOT.Autonomous */
+
+} /* End of ros_DadjStep */
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+int ros_ReplayStep ( double Y[], double T, double H, int Direction,
+		             double Ystage[], double K[], double Ghimj[],
+		             int Pivot[], int ISTATUS[], double Roundoff,
+		             int Autonomous ) {
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   Recomputes an accepted forward step T -> T+Direction*H exactly as
+   ros_FwdInt did, without error control.
+~~~> Y - Input: the state at T; Output: the state at T+Direction*H
+~~~> Ystage, K, Ghimj, Pivot - Output: stage values, stage vectors and
+     LU factorization of the step, as stored by ros_DPush
+~~~> Returns TRUE if the matrix is repeatedly singular
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/* ~~~~ Local variables */
+    double Ynew[NVAR], Fcn0[NVAR], Fcn[NVAR], dFdT[NVAR];
+#ifdef FULL_ALGEBRA
+    double Jac0[NVAR][NVAR];
+#else
+    double Jac0[LU_NONZERO];
+#endif
+    double HC, HG, Tau;
+    int ioffset, i, j, istage;
+    int Singular; /* Boolean value */
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    ADJ_FunTemplate(T,Y,Fcn0);
+    ISTATUS[Nfun] = ISTATUS[Nfun] + 1;
+
+    if (!Autonomous)
+        ros_FunTimeDerivative ( T, Roundoff, Y, Fcn0, dFdT, ISTATUS );
+
+    ADJ_JacTemplate(T,Y,Jac0);
+    ISTATUS[Njac] = ISTATUS[Njac] + 1;
+
+    Singular = ros_PrepareMatrix ( H,Direction,ros_Gamma[0],Jac0,Ghimj,Pivot,
+                                   ISTATUS );
+    if (Singular)
+        return Singular;
+
+/*~~~>   Compute the stages */
+    for( istage = 0; istage < ros_S; istage++ ) { /* Stage */
+
+        ioffset = NVAR*istage;
+
+        if ( istage == 0 ) {
+            WCOPY(NVAR,Fcn0,1,Fcn,1);
+            WCOPY(NVAR,Y,1,Ynew,1);
+        }
+        else if ( ros_NewF[istage] ) {
+            WCOPY(NVAR,Y,1,Ynew,1);
+            for ( j = 0; j < istage; j++ ) {
+                WAXPY( NVAR,ros_A[(istage)*(istage-1)/2+j],
+                       &K[NVAR*j],1,Ynew,1 );
+            }
+            Tau = T + ros_Alpha[istage]*Direction*H;
+            ADJ_FunTemplate(Tau,Ynew,Fcn);
+            ISTATUS[Nfun] = ISTATUS[Nfun] + 1;
+        }
+
+        for(i=0; i<NVAR; i++)
+            Ystage[ioffset+i] = Ynew[i];
+        WCOPY(NVAR,Fcn,1,&K[ioffset],1);
+        for( j = 0; j < istage; j++ ) {
+            HC = ros_C[(istage)*(istage-1)/2+j]/(Direction*H);
+            WAXPY(NVAR,HC,&K[NVAR*j],1,&K[ioffset],1);
+        }
+        if (( !Autonomous) && (ros_Gamma[istage] != ZERO)) {
+            HG = Direction*H*ros_Gamma[istage];
+            WAXPY(NVAR,HG,dFdT,1,&K[ioffset],1);
+        }
+        ros_Solve('N', Ghimj, Pivot, &K[ioffset], ISTATUS);
+    } /* End of Stage loop */
+
+/*~~~>  Compute the new solution */
+    for( j=0; j<ros_S; j++ )
+        WAXPY(NVAR,ros_M[j],&K[NVAR*j],1,Y,1);
+
+    return FALSE;
+
+} /* End of ros_ReplayStep */
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+long ros_Beta ( int c, int r, long cap ) {
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   Number of steps that can be reversed with c checkpoints and at most r
+   recomputations of each step, beta(c,r) = (c+r)!/(c!r!), capped at cap
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    long beta = 1;
+    int k;
+
+    for( k = 1; k <= r; k++ ) {
+        beta = beta * (c+k) / k;
+        if ( beta >= cap )
+            return cap;
+    }
+
+    return beta;
+
+} /* End of ros_Beta */
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+int ros_CheckpointDadjInt ( int NADJ, double Lambda[][NVAR], double Y0[],
+		                    double Tstart, double Tend, int Ncheck,
+		                    int ISTATUS[], double Roundoff, int Autonomous ) {
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   Discrete adjoint sweep over the (T,H) sequence recorded by ros_FwdInt,
+   recomputing the forward steps from at most Ncheck stored states.
+   Checkpoints are placed following the binomial schedule of Griewank's
+   revolve: a segment of n steps with c free checkpoints is split at the
+   first step m such that the right part can be reversed with c-1
+   checkpoints and the left part with one recomputation less.
+!~~~> Lambda[NADJ][NVAR] - Input: adjoint at Tend; Output: adjoint at Tstart
+!~~~> Y0 - Input: the initial condition at Tstart
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*~~~~ Local variables */
+    double Y[NVAR], Ystage[NVAR*ros_S], K[NVAR*ros_S];
 #ifdef FULL_ALGEBRA
-                Tmp2 = MATMUL(TRANSPOSE(dJdT),Tmp);
+    double Ghimj[NVAR][NVAR];
 #else
-                JacTR_SP_Vec(dJdT,Tmp,Tmp2);
+    double Ghimj[LU_NONZERO];
 #endif
-                WAXPY(NVAR,H,Tmp2,1,&Lambda[m][0],1);
-            } /* m=0:NADJ-1 */
-        } /* .NOT.Autonomous */
+    double *chk_S = NULL; /* Stored states, (Ncheck+1) x NVAR */
+    int *chk_I = NULL; /* Step index of each stored state */
+    int Pivot[NVAR], Direction;
+    int nStep, top, free_chk, i0, i1, m, i, t;
+    long n;
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if (Tend  >=  Tstart)
+        Direction = 1;
+    else
+        Direction = -1;
+
+    nStep = stack_ptr + 1;
+    if ( nStep <= 0 )
+        return 1;
+    Ncheck = MIN(Ncheck, nStep);
+
+    chk_S = (double*) malloc((Ncheck+1) * NVAR * sizeof(double));
+    chk_I = (int*) malloc((Ncheck+1) * sizeof(int));
+    if ( (chk_S == NULL) || (chk_I == NULL) ) {
+        printf( "Failed allocation of checkpoint states" );
+        exit(0);
+    }
+
+/*~~~>  The initial state is always available */
+    top = 0;
+    chk_I[0] = 0;
+    WCOPY(NVAR,Y0,1,&chk_S[0],1);
+
+/*~~~>  Steps i1, i1+1, ... have been reversed */
+    i1 = nStep;
+    while ( i1 > 0 ) { /* TimeLoop */
+
+        i0 = chk_I[top];
+        n  = i1 - i0;
+        free_chk = Ncheck - top;
+
+        if ( n == 1 ) {
+/*~~~>  Recompute the last step of the segment and reverse it */
+            WCOPY(NVAR,&chk_S[top*NVAR],1,Y,1);
+            if ( ros_ReplayStep( Y, chk_T[i0], chk_H[i0], Direction, Ystage, K,
+                                 Ghimj, Pivot, ISTATUS, Roundoff, Autonomous ) ) {
+                free(chk_S);
+                free(chk_I);
+                return ADJ_ros_ErrorMsg( -8 );
+            }
+            ros_DadjStep( NADJ, Lambda, chk_T[i0], chk_H[i0], Direction, Ystage,
+                          K, Ghimj, Pivot, TRUE, ISTATUS, Roundoff, Autonomous );
+            i1 = i0;
+            if ( top > 0 )
+                top--;
+            continue;
+        }
+
+/*~~~>  Choose the next checkpoint */
+        if ( free_chk > 0 ) {
+            t = 0;
+            while ( ros_Beta( free_chk, t, n ) < n )
+                t++;
+            m = i0 + (int) MAX(1, n - ros_Beta( free_chk-1, t, n ));
+        }
+        else
+            m = i1 - 1;
+
+/*~~~>  Advance from the last checkpoint to step m */
+        WCOPY(NVAR,&chk_S[top*NVAR],1,Y,1);
+        for ( i = i0; i < m; i++ ) {
+            if ( ros_ReplayStep( Y, chk_T[i], chk_H[i], Direction, Ystage, K,
+                                 Ghimj, Pivot, ISTATUS, Roundoff, Autonomous ) ) {
+                free(chk_S);
+                free(chk_I);
+                return ADJ_ros_ErrorMsg( -8 );
+            }
+        }
+
+        if ( free_chk > 0 ) {
+            top++;
+            chk_I[top] = m;
+            WCOPY(NVAR,Y,1,&chk_S[top*NVAR],1);
+        }
+        else {
+/*~~~>  No checkpoint left: reverse step m from the recomputed state */
+            if ( ros_ReplayStep( Y, chk_T[m], chk_H[m], Direction, Ystage, K,
+                                 Ghimj, Pivot, ISTATUS, Roundoff, Autonomous ) ) {
+                free(chk_S);
+                free(chk_I);
+                return ADJ_ros_ErrorMsg( -8 );
+            }
+            ros_DadjStep( NADJ, Lambda, chk_T[m], chk_H[m], Direction, Ystage,
+                          K, Ghimj, Pivot, TRUE, ISTATUS, Roundoff, Autonomous );
+            i1 = m;
+        }
+
     } /* End of TimeLoop */
 
-    /*~~~> Save last state */
+    free(chk_S);
+    free(chk_I);
+
     /*~~~> Succesful exit */
     return 1;  /*~~~> The integration was successful */
 
-/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-} /* End of ros_DadjInt */
+} /* End of ros_CheckpointDadjInt */
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1972,6 +2297,9 @@ void ros_Solve( char How, double A[], int Pivot[], double b[],
   Template for the forward/backward substitution
   (using pre-computed LU decomposition)
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+#ifndef FULL_ALGEBRA
+    (void) Pivot; /* No pivoting in the sparse LU */
+#endif
     switch (How) {
         case 'N':
 #ifdef FULL_ALGEBRA
@@ -2484,17 +2812,16 @@ void Rodas4() {
 void ADJ_FunTemplate( double T, double Y[], double Ydot[] ) {
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   Template for the ODE function call.
-  Updates the rate coefficients (and possibly the fixed species) at each call
+  The rate coefficients are constant over the integration, as in INTEGRATE
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*~~~> Local variables */
     double Told;
 
-    Told = TIME;
-    TIME = T;
-    Update_PHOTO();
-    Fun( Y, FIX, RCONST, Ydot );
-    TIME = Told;
+    Told = adjCtx->TIME;
+    adjCtx->TIME = T;
+    Fun( Y, adjCtx->FIX(), adjCtx->RCONST, Ydot );
+    adjCtx->TIME = Told;
 
 } /* End of ADJ_FunTemplate */
 
@@ -2502,7 +2829,7 @@ void ADJ_FunTemplate( double T, double Y[], double Ydot[] ) {
 void ADJ_JacTemplate( double T, double Y[], double Jcb[] ) {
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   Template for the ODE Jacobian call.
-  Updates the rate coefficients (and possibly the fixed species) at each call
+  The rate coefficients are constant over the integration, as in INTEGRATE
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*~~~> Local variables */
@@ -2512,11 +2839,10 @@ void ADJ_JacTemplate( double T, double Y[], double Jcb[] ) {
     int i, j;
 #endif
 
-    Told = TIME;
-    TIME = T;
-    Update_PHOTO();
+    Told = adjCtx->TIME;
+    adjCtx->TIME = T;
 #ifdef FULL_ALGEBRA
-    Jac_SP(Y, FIX, RCONST, JV);
+    Jac_SP(Y, adjCtx->FIX(), adjCtx->RCONST, JV);
     for(j=0; j<NVAR; j++) {
         for(i=0; i<NVAR; i++)
             Jcb[i][j] = (double)0.0;
@@ -2524,9 +2850,9 @@ void ADJ_JacTemplate( double T, double Y[], double Jcb[] ) {
     for(i=0; i<LU_NONZERO; i++)
         Jcb[LU_ICOL[i]][LU_IROW[i]] = JV[i];
 #else
-    Jac_SP( Y, FIX, RCONST, Jcb );
+    Jac_SP( Y, adjCtx->FIX(), adjCtx->RCONST, Jcb );
 #endif
-    TIME = Told;
+    adjCtx->TIME = Told;
 
 } /* End of ADJ_JacTemplate */
 
@@ -2534,17 +2860,16 @@ void ADJ_JacTemplate( double T, double Y[], double Jcb[] ) {
 void ADJ_HessTemplate( double T, double Y[], double Hes[] ) {
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   Template for the ODE Hessian call.
-  Updates the rate coefficients (and possibly the fixed species) at each call
+  The rate coefficients are constant over the integration, as in INTEGRATE
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*~~~> Local variables */
     double Told;
 
-    Told = TIME;
-    TIME = T;
-    Update_PHOTO();
-    Hessian( Y, FIX, RCONST, Hes );
-    TIME = Told;
+    Told = adjCtx->TIME;
+    adjCtx->TIME = T;
+    Hessian( Y, adjCtx->FIX(), adjCtx->RCONST, Hes );
+    adjCtx->TIME = Told;
 
 } /* End of ADJ_HessTemplate */
 
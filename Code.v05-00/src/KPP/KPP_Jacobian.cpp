@@ -26,6 +26,7 @@
 #include "KPP/KPP_Parameters.h"
 #include "KPP/KPP_Global.h"
 #include "KPP/KPP_Sparse.h"
+#include "KPP/KPP_Lanes.hpp"
 
 
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -39,16 +40,13 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-void Jac_SP( 
-    double V[],                            /* Concentrations of variable species (local) */
-    double F[],                            /* Concentrations of fixed species (local) */
-    double RCT[],                          /* Rate constants (local) */
-    double JVS[]                           /* sparse Jacobian of variables */
-)
+/* Written for double and KppLanes alike */
+template <typename T>
+static inline void Jac_SP_T( const T V[], const T F[], const T RCT[], T JVS[] )
 {
 
     /* Local variables                                                  */
-    double B[839];                           /* Temporary array */
+    T B[839];                                /* Temporary array */
 
     /* B(0) = dA(0)/dV(114)                                             */
     B[0] = RCT[0]*V[119];
@@ -6049,6 +6047,21 @@ void Jac_SP(
                -B[297]-B[299]-B[301]-B[347]-B[365]-B[424]-B[687];
 }
 
+void Jac_SP( 
+    double V[],                            /* Concentrations of variable species (local) */
+    double F[],                            /* Concentrations of fixed species (local) */
+    double RCT[],                          /* Rate constants (local) */
+    double JVS[]                           /* sparse Jacobian of variables */
+)
+{
+    Jac_SP_T( V, F, RCT, JVS );
+}
+
+void Jac_SP_Batch( const KppLanes V[], const KppLanes F[], const KppLanes RCT[], KppLanes JVS[] )
+{
+    Jac_SP_T( V, F, RCT, JVS );
+}
+
 /* End of Jac_SP function                                           */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
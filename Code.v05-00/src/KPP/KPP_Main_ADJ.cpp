@@ -55,11 +55,13 @@
    Driver for the Adjoint (ADJ) model
    ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
+int KPP_Main_ADJ( const KppContext &ambient,                          \
+                  const double finalPlume[], const double initBackg[],  \
                   const double temperature_K, const double pressure_Pa, \
                   const double airDens, const double timeArray[],       \
                   const unsigned int NT,                                \
                   const double RTOLS, const double ATOLS,               \
+                  const int NCHECK,                                     \
                   double VAR_OUTPUT[], double *METRIC_OUT,              \
                   const bool VERBOSE, const bool RETRY )
 {
@@ -80,6 +82,10 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
     const double TEND   = timeArray[NT-1];
 
     /* ---- INITIALIZE ARRAYS --------------- */
+
+    /* Fixed species and photolysis rates of the ambient box, without
+     * heterogeneous chemistry */
+    KppContext adjKPP = ambient;
    
     double VAR_BACKG[NVAR];
     double VAR_RUN[NVAR];
@@ -188,6 +194,10 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
         ICNTRL[7]=1 : save LU factorization
         Note: if ICNTRL[7]=1 the LU factorization is *not* saved
 
+    ICNTRL[8]  -> number of state checkpoints for the discrete adjoint:
+        ICNTRL[8]=0 : store the stages of every forward step (the default)
+        ICNTRL[8]=c : store at most c states and recompute the stages
+
     ~~~>  Real input parameters:
 
     RCNTRL[0]  -> Hmin, lower bound for the integration step size
@@ -235,6 +245,10 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
     
     /* Running the discrete adjoint */
     ICNTRL[6] = 2;
+
+    /* Number of stored states for the checkpointed discrete adjoint.
+     * 0 stores the whole forward trajectory */
+    ICNTRL[8] = NCHECK;
     
     /* ---- INITIALIZE ARRAYS FOR CURR. RUN - */
 
@@ -242,20 +256,20 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
         VAR_RUN[i] = VAR_BACKG[i];
                 
     for ( i = 0; i < NREACT; i++ )
-        RCONST[i] = 0.0E+00;
+        adjKPP.RCONST[i] = 0.0E+00;
 
     for ( i = 0; i < NSPEC; i++ ) {
-        HET[i][0] = 0.0E+00;
-        HET[i][1] = 0.0E+00;
-        HET[i][2] = 0.0E+00;
+        adjKPP.HET[i][0] = 0.0E+00;
+        adjKPP.HET[i][1] = 0.0E+00;
+        adjKPP.HET[i][2] = 0.0E+00;
     }
 
-    Update_RCONST( temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
+    Update_RCONST( adjKPP, temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
 
     /* ---- COMPUTE SENSITIVITIES ----------- */
 
-    TIME = TSTART;
-    IERR = INTEGRATE_ADJ( NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL,
+    adjKPP.TIME = TSTART;
+    IERR = INTEGRATE_ADJ( adjKPP, NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL,
                           RCNTRL, ISTATUS, RSTATUS, STEPMIN );
 
     /* If integration failed, stop here */
@@ -522,18 +536,18 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
                 VAR_INIT[ind_HNO3] = VAR_RUN[ind_HNO3];
     
                 for ( i = 0; i < NREACT; i++ )
-                    RCONST[i] = 0.0E+00;
+                    adjKPP.RCONST[i] = 0.0E+00;
 
                 for ( i = 0; i < NSPEC; i++ ) {
-                    HET[i][0] = 0.0E+00;
-                    HET[i][1] = 0.0E+00;
-                    HET[i][2] = 0.0E+00;
+                    adjKPP.HET[i][0] = 0.0E+00;
+                    adjKPP.HET[i][1] = 0.0E+00;
+                    adjKPP.HET[i][2] = 0.0E+00;
                 }
 
-                Update_RCONST( temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
+                Update_RCONST( adjKPP, temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
     
-                TIME = TSTART;
-                IERR = INTEGRATE_ADJ( NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
+                adjKPP.TIME = TSTART;
+                IERR = INTEGRATE_ADJ( adjKPP, NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
                 
                 /* Compute metric */
                 METRIC = 0.0;
@@ -556,7 +570,7 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
                         && ( VAR_INIT[ind_NO] > 0.0E+00 ) \
                         && ( VAR_INIT[ind_NO2] > 0.0E+00 ) \
                         && ( VAR_INIT[ind_O3] > 0.0E+00 ) \
-                        && ( VAR_INIT[ind_HNO3] > 0.0E+00 ) \ 
+                        && ( VAR_INIT[ind_HNO3] > 0.0E+00 ) \
                         && ( VAR_RUN[ind_NO] > 0.0E+00 ) \
                         && ( VAR_RUN[ind_NO2] > 0.0E+00 ) \
                         && ( VAR_RUN[ind_O3] > 0.0E+00 ) \
@@ -622,20 +636,20 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
             /* ---- INITIALIZE RATES ------------------ */
 
             for ( i = 0; i < NREACT; i++ )
-                RCONST[i] = 0.0E+00;
+                adjKPP.RCONST[i] = 0.0E+00;
 
             for ( i = 0; i < NSPEC; i++ ) {
-                HET[i][0] = 0.0E+00;
-                HET[i][1] = 0.0E+00;
-                HET[i][2] = 0.0E+00;
+                adjKPP.HET[i][0] = 0.0E+00;
+                adjKPP.HET[i][1] = 0.0E+00;
+                adjKPP.HET[i][2] = 0.0E+00;
             }
 
-            Update_RCONST( temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
+            Update_RCONST( adjKPP, temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
 
             /* ---- COMPUTE SENSITIVITIES -------------- */
 
-            TIME = TSTART;
-            IERR = INTEGRATE_ADJ( NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
+            adjKPP.TIME = TSTART;
+            IERR = INTEGRATE_ADJ( adjKPP, NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
 
             if ( IERR < 0 ) {
                 printf(" Adjoint integration failed\n Metric: %e\n", METRIC);
@@ -691,20 +705,20 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
             /* ---- INITIALIZE RATES ------------------ */
 
             for ( i = 0; i < NREACT; i++ )
-                RCONST[i] = 0.0E+00;
+                adjKPP.RCONST[i] = 0.0E+00;
 
             for ( i = 0; i < NSPEC; i++ ) {
-                HET[i][0] = 0.0E+00;
-                HET[i][1] = 0.0E+00;
-                HET[i][2] = 0.0E+00;
+                adjKPP.HET[i][0] = 0.0E+00;
+                adjKPP.HET[i][1] = 0.0E+00;
+                adjKPP.HET[i][2] = 0.0E+00;
             }
 
-            Update_RCONST( temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
+            Update_RCONST( adjKPP, temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
 
             /* ---- COMPUTE SENSITIVITIES -------------- */
 
-            TIME = TSTART;
-            IERR = INTEGRATE_ADJ( NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
+            adjKPP.TIME = TSTART;
+            IERR = INTEGRATE_ADJ( adjKPP, NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
 
             if ( IERR < 0 ) {
                 printf(" Forward integration failed\n");
@@ -821,20 +835,20 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
         /* ---- INITIALIZE RATES ------------------ */
 
         for ( i = 0; i < NREACT; i++ )
-            RCONST[i] = 0.0E+00;
+            adjKPP.RCONST[i] = 0.0E+00;
 
         for ( i = 0; i < NSPEC; i++ ) {
-            HET[i][0] = 0.0E+00;
-            HET[i][1] = 0.0E+00;
-            HET[i][2] = 0.0E+00;
+            adjKPP.HET[i][0] = 0.0E+00;
+            adjKPP.HET[i][1] = 0.0E+00;
+            adjKPP.HET[i][2] = 0.0E+00;
         }
 
-        Update_RCONST( temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
+        Update_RCONST( adjKPP, temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
 
         /* ---- COMPUTE SENSITIVITIES -------------- */
 
-        TIME = TSTART;
-        IERR = INTEGRATE_ADJ( NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
+        adjKPP.TIME = TSTART;
+        IERR = INTEGRATE_ADJ( adjKPP, NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
 
         if ( IERR < 0 ) {
             printf(" Forward integration failed\n");
@@ -883,20 +897,20 @@ int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
         /* ---- INITIALIZE RATES ------------------ */
 
         for ( i = 0; i < NREACT; i++ )
-            RCONST[i] = 0.0E+00;
+            adjKPP.RCONST[i] = 0.0E+00;
 
         for ( i = 0; i < NSPEC; i++ ) {
-            HET[i][0] = 0.0E+00;
-            HET[i][1] = 0.0E+00;
-            HET[i][2] = 0.0E+00;
+            adjKPP.HET[i][0] = 0.0E+00;
+            adjKPP.HET[i][1] = 0.0E+00;
+            adjKPP.HET[i][2] = 0.0E+00;
         }
 
-        Update_RCONST( temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
+        Update_RCONST( adjKPP, temperature_K, pressure_Pa, airDens, VAR_RUN[ind_H2O] );
 
         /* ---- COMPUTE SENSITIVITIES -------------- */
 
-        TIME = TSTART;
-        IERR = INTEGRATE_ADJ( NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
+        adjKPP.TIME = TSTART;
+        IERR = INTEGRATE_ADJ( adjKPP, NADJ, VAR_RUN, Y_adj, TSTART, TEND, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
 
         if ( IERR < 0 ) {
             printf(" Forward integration failed\n");
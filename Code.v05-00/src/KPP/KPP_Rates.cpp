@@ -23,6 +23,10 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "Core/Interface.hpp"
 #include "KPP/KPP_Parameters.h"
@@ -398,11 +402,19 @@ void Update_SUN( )
 /*                                                                  */
 /* Update_RCONST - function to update rate constants                */
 /*   Arguments :                                                    */
+/*      RCONST    - Rate constants (output)                         */
+/*      PHOTOL    - Photolysis rates                                */
+/*      HET       - Heterogeneous reaction rates                    */
+/*                                                                  */
+/* The thermal rates only depend on temperature and air density     */
+/* (pressure follows from both) and are cached on quantised (T, M). */
+/* Photolysis, heterogeneous and water-dependent rates are          */
+/* computed for every call.                                         */
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-void Update_RCONST( const double TEMP, const double PRESS,  \
-                    const double AIRDENS, const double H2O ) 
+static void Compute_ThermalRCONST( double RCONST[], const double TEMP, \
+                                   const double PRESS, const double AIRDENS )
 {
 
 /* Begin INLINED RCONST                                             */
@@ -420,7 +432,6 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[  7] = (GCARR(4.80E-11, 0.0E+00, 250.0, TEMP));
     RCONST[  8] = (GCARR(1.80E-12, 0.0E+00, 0.0, TEMP));
     RCONST[  9] = (GCARR(3.30E-12, 0.0E+00, 270.0, TEMP));
-    RCONST[ 10] = (GC_HO2NO3(3.00E-13, 0.0E+00, 460.0, 2.1E-33, 0.0, 920.0, AIRDENS, TEMP, H2O));
     RCONST[ 11] = (GC_OHCO(1.50E-13, 0.0E+00, 0.0, PRESS, AIRDENS, TEMP));
     RCONST[ 12] = (GCARR(2.45E-12, 0.0E+00, -1775.0, TEMP));
     RCONST[ 13] = (GCARR(2.80E-12, 0.0E+00, 300.0, TEMP));
@@ -635,10 +646,6 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[222] = (GCJPLPR(1.05E-02, 4.8E+00, -11234.0, 7.58E16, 2.1E0, -11234.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[223] = (GCARR(1.06E-16, 0.0E+00, 0.0, TEMP));
     RCONST[224] = (GCARR(5.30E-17, 0.0E+00, 0.0, TEMP));
-    RCONST[225] = (HET[ind_HO2][0]);
-    RCONST[226] = (HET[ind_NO2][0]);
-    RCONST[227] = (HET[ind_NO3][0]);
-    RCONST[228] = (HET[ind_N2O5][0]);
     RCONST[229] = (GCJPLPR(3.30E-31, 4.3E+00, 0.0, 1.6E-12, 0.0, 0.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[230] = (GCARR(1.60E-11, 0.0E+00, -780.0, TEMP));
     RCONST[231] = (GCARR(4.50E-12, 0.0E+00, 460.0, TEMP));
@@ -660,11 +667,6 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[247] = (GCARR(8.77E-11, 0.0E+00, -4330.0, TEMP));
     RCONST[248] = (GCJPLPR(4.20E-31, 2.4E+00, 0.0, 2.7E-11, 0.0, 0.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[249] = (GCJPLPR(5.20E-31, 3.2E+00, 0.0, 6.9E-12, 2.9E0, 0.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
-    RCONST[250] = (HET[ind_BrNO3][0]);
-    RCONST[251] = (HET[ind_HOBr][0]);
-    RCONST[252] = (HET[ind_HBr][0]);
-    RCONST[253] = (HET[ind_HOBr][1]);
-    RCONST[254] = (HET[ind_HBr][1]);
     RCONST[255] = (GCARR(3.35E-11, 0.0E+00, 380.0, TEMP));
     RCONST[256] = (GC_RO2NO("B", 2.70E-12, 0.0E+00, 350.0, 5.0, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[257] = (GC_RO2NO("A", 2.70E-12, 0.0E+00, 350.0, 5.0, 0.0, 0.0, AIRDENS, TEMP));
@@ -802,6 +804,24 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[389] = (GCARR(4.10E-13, 0.0E+00, 290.0, TEMP));
     RCONST[390] = (GCARR(3.60E-12, 0.0E+00, -840.0, TEMP));
     RCONST[391] = (GCARR(6.50E-12, 0.0E+00, 135.0, TEMP));
+
+}
+
+static void Compute_LocalRCONST( double RCONST[], const double PHOTOL[], \
+                                 const double HET[][3], const double TEMP, \
+                                 const double AIRDENS, const double H2O )
+{
+
+    RCONST[ 10] = (GC_HO2NO3(3.00E-13, 0.0E+00, 460.0, 2.1E-33, 0.0, 920.0, AIRDENS, TEMP, H2O));
+    RCONST[225] = (HET[ind_HO2][0]);
+    RCONST[226] = (HET[ind_NO2][0]);
+    RCONST[227] = (HET[ind_NO3][0]);
+    RCONST[228] = (HET[ind_N2O5][0]);
+    RCONST[250] = (HET[ind_BrNO3][0]);
+    RCONST[251] = (HET[ind_HOBr][0]);
+    RCONST[252] = (HET[ind_HBr][0]);
+    RCONST[253] = (HET[ind_HOBr][1]);
+    RCONST[254] = (HET[ind_HBr][1]);
     RCONST[392] = (HET[ind_N2O5][1]);
     RCONST[393] = (HET[ind_ClNO3][0]);
     RCONST[394] = (HET[ind_ClNO3][1]);
@@ -888,102 +908,84 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
 
 }
 
-/* End of Update_RCONST function                                    */
-/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+namespace {
 
+    struct ThermalKey {
+        long iT, iM;
+        bool operator==( const ThermalKey &other ) const
+            { return ( iT == other.iT ) && ( iM == other.iM ); }
+    };
 
-/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-/*                                                                  */
-/* Update_PHOTO - function to update photolytical rate constants    */
-/*   Arguments :                                                    */
-/*                                                                  */
-/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+    struct ThermalKeyHash {
+        std::size_t operator()( const ThermalKey &key ) const
+            { return std::hash<long>()( key.iT ) ^ ( std::hash<long>()( key.iM ) << 1 ); }
+    };
+
+    /* Shared by all threads */
+    std::unordered_map<ThermalKey, std::array<double, NREACT>, ThermalKeyHash> thermalCache;
+    std::shared_mutex thermalMutex;
+    /* Resolution of the cache, off if 0. Guarded by thermalMutex */
+    double thermalDT    = KPP_RCONST_DT;
+    double thermalDLogM = KPP_RCONST_DLOGM;
 
-void Update_PHOTO( )
+}
+
+void Update_RCONST( KppContext &ctx, const double TEMP, const double PRESS, \
+                    const double AIRDENS, const double H2O )
 {
 
-    Update_JRates( PHOTOL,           \
-                   MAX( SZA_CST[0] + \
-                        SZA_CST[1] * \
-                        cos( SZA_CST[2] * fabs( TIME / double(3600.0) - 12.0 ) ), 0.0E+00 ) );
+    /* The resolution is read under the same lock as the entry, so that a
+     * concurrent Set_RCONST_Cache cannot pair a key with another resolution */
+    double dT, dLogM;
+    ThermalKey key = { 0, 0 };
+    bool found = false;
+    {
+        std::shared_lock<std::shared_mutex> lock( thermalMutex );
+        dT    = thermalDT;
+        dLogM = thermalDLogM;
+        if ( dT > 0.0E+00 ) {
+            key = { lround( TEMP / dT ), lround( log( AIRDENS ) / dLogM ) };
+            auto it = thermalCache.find( key );
+            if ( it != thermalCache.end() ) {
+                memcpy( ctx.RCONST, it->second.data(), NREACT * sizeof(double) );
+                found = true;
+            }
+        }
+    }
 
-    RCONST[400] = (PHOTOL[  1]); // O3 -> O + O2
-    RCONST[401] = (PHOTOL[  2]); // O3 -> O1D + O2
-    RCONST[402] = (PHOTOL[  0]); // O2 -> 2O
-    RCONST[403] = (PHOTOL[ 10]); //  NO2 -> NO + O // 1.41E-02
-    RCONST[404] = (PHOTOL[  8]); // H2O2 -> 2OH
-    RCONST[405] = (PHOTOL[  9]); // MP -> CH2O + HO2 + OH
-    RCONST[406] = (PHOTOL[  6]); // CH2O -> HO2 + H + CO
-    RCONST[407] = (PHOTOL[  7]); // CH2O -> H2 + CO
-    RCONST[408] = (PHOTOL[ 15]); // HNO3 -> OH + NO2
-    RCONST[409] = (PHOTOL[ 14]); // HNO2 -> OH + NO
-    RCONST[410] = (PHOTOL[ 16]); // HNO4 -> OH + NO3
-    RCONST[411] = (PHOTOL[ 17]); // HNO4 -> HO2 + NO2
-    RCONST[412] = (PHOTOL[ 11]); // NO3 -> NO2 + O
-    RCONST[413] = (PHOTOL[ 12]); // NO3 -> NO + O2
-    RCONST[414] = (PHOTOL[ 13]); // N2O5 -> NO3 + NO2
-    RCONST[415] = (PHOTOL[ 60]); // ALD2 -> .88MO2 + HO2 + .88CO + .12MCO3
-    RCONST[416] = (PHOTOL[ 61]); // ALD2 -> CH4 + CO
-    RCONST[417] = (PHOTOL[ 58]); // PAN -> .7MCO3 + .7NO2 + .3MO2 + .3NO3
-    RCONST[418] = (PHOTOL[ 69]); // RCHO -> ETO2 + HO2 + CO
-    RCONST[419] = (PHOTOL[ 75]); // ACET -> MCO3 + MO2
-    RCONST[420] = (PHOTOL[ 76]); // ACET -> 2MO2 + CO
-    RCONST[421] = (PHOTOL[ 68]); // MEK -> .85MCO3 + .85ETO2 + .15MO2 + .15RCO3
-    RCONST[422] = (PHOTOL[ 67]); // GLYC -> .9CH2O + 1.73HO2 + CO + .07OH + .1MOH
-    RCONST[423] = (PHOTOL[ 71]); // GLYX -> 2HO2 + 2CO
-    RCONST[424] = (PHOTOL[ 72]); // GLYX -> H2 + 2CO
-    RCONST[425] = (PHOTOL[ 73]); // GLYX -> CH2O + CO
-    RCONST[426] = (PHOTOL[ 70]); // MGLY -> MCO3 + CO +HO2
-    RCONST[427] = (PHOTOL[ 62]); // MVK -> PRPE + CO
-    RCONST[428] = (PHOTOL[ 63]); // MVK -> MCO3 + CH2O + CO + HO2
-    RCONST[429] = (PHOTOL[ 64]); // MVK -> MO2 + RCO3
-    RCONST[430] = (PHOTOL[ 65]); // MACR -> CO + HO2 + CH2O + MCO3
-    RCONST[431] = (PHOTOL[ 74]); // HAC -> MCO3 + CH2O + HO2
-    RCONST[432] = (PHOTOL[ 77]); // INPN -> OH + HO2 + RCHO + NO2
-    RCONST[433] = (PHOTOL[ 78]); // PRPN -> OH + HO2 + RCHO + NO2
-    RCONST[434] = (PHOTOL[ 79]); // ETP -> OH + HO2 + ALD2
-    RCONST[435] = (PHOTOL[ 80]); // RA3P -> OH + HO2 + RCHO
-    RCONST[436] = (PHOTOL[ 81]); // RB3P -> OH + HO2 + ACET
-    RCONST[437] = (PHOTOL[ 82]); // R4P -> OH + HO2 + RCHO
-    RCONST[438] = (PHOTOL[ 83]); // PP -> OH + HO2 + ALD2 + CH2O
-    RCONST[439] = (PHOTOL[ 84]); // RP -> OH + HO2 + ALD2
-    RCONST[440] = (PHOTOL[ 85]); // RIP -> OH + HO2 + .71CH2O + .425MVK + .285MACR + .29HC5
-    RCONST[441] = (PHOTOL[ 86]); // IAP -> OH + HO2 + .67CO + .19H2 + .36HAC + .26GLYC + .58MGLY
-    RCONST[442] = (PHOTOL[ 87]); // ISNP -> OH + HO2 + RCHO + NO2
-    RCONST[443] = (PHOTOL[ 88]); // VRP -> OH + .3HO2 + .3CH2O + .7MCO3 + .7GLYC + .3MGLY
-    RCONST[444] = (PHOTOL[ 89]); // MRP -> OH + HO2 + HAC + .5CO + .5CH2O
-    RCONST[445] = (PHOTOL[ 90]); // MAOP -> OH + CH2O + MCO3
-    RCONST[446] = (PHOTOL[ 97]); // R4N2 -> NO2 + .32ACET + .19MEK + .18MO2 + .27HO2 + .32ALD2 + .13RCHO + .05A3O2 + .18B3O2 + .32ETO2
-    RCONST[447] = (PHOTOL[ 98]); // MAP -> OH + MO2
-    RCONST[448] = (PHOTOL[ 91]); // MACRN -> NO2 + HAC + MGLY -> 0.5CH2O + HO2 + .5CO
-    RCONST[449] = (PHOTOL[ 92]); // MVKN -> GLYC + NO2 + MCO3
-    RCONST[450] = (PHOTOL[ 93]); // ISOPNB -> HC5 + NO2 + HO2
-    RCONST[451] = (PHOTOL[ 22]); // Br2 -> 2Br
-    RCONST[452] = (PHOTOL[ 27]); // BrO -> Br + O
-    RCONST[453] = (PHOTOL[ 31]); // HOBr -> Br + OH
-    RCONST[454] = (PHOTOL[ 28]); // BrNO3 -> Br + NO3
-    RCONST[455] = (PHOTOL[ 29]); // BrNO3 -> BrO + NO2
-    RCONST[456] = (PHOTOL[ 30]); // BrNO2 -> Br + NO2
-    RCONST[457] = (PHOTOL[103]); // MPN -> CH2O + NO3 + HO2
-    RCONST[458] = (PHOTOL[104]); // MPN -> MO2 + NO2
-    RCONST[459] = (PHOTOL[ 94]); // ISOPND -> HC5 + NO2 + HO2
-    RCONST[460] = (PHOTOL[ 95]); // PROPNN -> CH2O + NO2 + CO + MO2
-    RCONST[461] = (PHOTOL[ 96]); // ATOOH -> OH + CH2O + MCO3
-    RCONST[462] = (PHOTOL[ 35]); // N2O -> N2 + O1D
-    RCONST[463] = (PHOTOL[ 99]); // SO4 -> SO2 + 2OH
-    RCONST[464] = (PHOTOL[  5]); // NO -> O + N
-    RCONST[465] = (PHOTOL[ 32]); // BrCl -> Br + Cl
-    RCONST[466] = (PHOTOL[ 21]); // Cl2 -> 2Cl
-    RCONST[467] = (PHOTOL[ 26]); // ClO -> Cl + O
-    RCONST[468] = (PHOTOL[ 24]); // OClO -> ClO + O
-    RCONST[469] = (PHOTOL[ 25]); // Cl2O2 -> Cl + ClOO
-    RCONST[470] = (PHOTOL[ 20]); // ClNO2 -> Cl + NO2
-    RCONST[471] = (PHOTOL[ 18]); // ClNO3 -> Cl + NO3
-    RCONST[472] = (PHOTOL[ 19]); // ClNO3 -> ClO + NO2
-    RCONST[473] = (PHOTOL[ 23]); // HOCl -> Cl + OH
-    RCONST[474] = (PHOTOL[101]); // ClOO -> Cl + O2
+    if ( dT <= 0.0E+00 ) {
+        Compute_ThermalRCONST( ctx.RCONST, TEMP, PRESS, AIRDENS );
+    } else if ( !found ) {
+        /* Rates are evaluated at the node, so that they do not depend
+         * on which cell filled the entry first */
+        const double TEMP_Q    = key.iT * dT;
+        const double AIRDENS_Q = exp( key.iM * dLogM );
+        const double PRESS_Q   = PRESS * ( TEMP_Q / TEMP ) * ( AIRDENS_Q / AIRDENS );
+        std::array<double, NREACT> rates = {};
+        Compute_ThermalRCONST( rates.data(), TEMP_Q, PRESS_Q, AIRDENS_Q );
+        memcpy( ctx.RCONST, rates.data(), NREACT * sizeof(double) );
+        std::unique_lock<std::shared_mutex> lock( thermalMutex );
+        /* Drop the entry if the resolution changed in the meantime */
+        if ( ( thermalDT == dT ) && ( thermalDLogM == dLogM ) ) {
+            if ( thermalCache.size() >= KPP_RCONST_CACHE_MAX )
+                thermalCache.clear();
+            thermalCache.emplace( key, rates );
+        }
+    }
+
+    Compute_LocalRCONST( ctx.RCONST, ctx.PHOTOL, ctx.HET, TEMP, AIRDENS, H2O );
 
 }
 
-/* End of Update_PHOTO function                                     */
+void Set_RCONST_Cache( const double dT, const double dLogM )
+{
+
+    std::unique_lock<std::shared_mutex> lock( thermalMutex );
+    thermalDT    = dT;
+    thermalDLogM = dLogM;
+    thermalCache.clear();
+
+}
+
+/* End of Update_RCONST function                                    */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -68,13 +68,13 @@ int InitSaveData()
   return 0;
 }
 
-int SaveData()
+int SaveData( const KppContext &ctx )
 {
 int i;
 
-  fprintf( fpDat, "%6.1f ", TIME/3600.0 );
+  fprintf( fpDat, "%6.1f ", ctx.TIME/3600.0 );
   for( i = 0; i < NLOOKAT; i++ )
-    fprintf( fpDat, "%24.16e ", C[ LOOKAT[i] ] );
+    fprintf( fpDat, "%24.16e ", ctx.C[ LOOKAT[i] ] );
   fprintf( fpDat, "\n");
   return 0;
 }
@@ -0,0 +1,75 @@
+#include "LAGRID/FixedGridResampler.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+namespace LAGRID {
+
+    namespace {
+        RemapOperator buildResampleOperator(const Remapping& grid, const Vector_1D& xEdges, const Vector_1D& yEdges) {
+            if(xEdges.size() < 2 || yEdges.size() < 2) {
+                throw std::invalid_argument("FixedGridResampler: model grid needs at least one cell along each axis");
+            }
+            int nx = xEdges.size() - 1;
+            int ny = yEdges.size() - 1;
+            Vector_1D dy(ny);
+            for(int j = 0; j < ny; j++) {
+                dy[j] = yEdges[j + 1] - yEdges[j];
+            }
+            //Every model cell is a box of its own, carrying its area per unit concentration
+            Vector_2D unitPhi(ny, Vector_1D(nx, 1.0));
+            vector<vector<int>> mask(ny, vector<int>(nx, 1));
+            FreeCoordBoxGrid unitBoxGrid(Vector_2D(ny, xEdges), dy, unitPhi, yEdges[0], mask);
+            return RemapOperator(unitBoxGrid, mask, grid);
+        }
+    }
+
+    FixedGridResampler::FixedGridResampler(const Remapping& grid, const Vector_1D& xEdges, const Vector_1D& yEdges):
+        grid_(grid),
+        xEdges_(xEdges),
+        yEdges_(yEdges),
+        op_(buildResampleOperator(grid, xEdges, yEdges)),
+        coverage_(op_.apply(Vector_2D(yEdges.size() - 1, Vector_1D(xEdges.size() - 1, 1.0))))
+    {
+    }
+
+    Vector_2D FixedGridResampler::apply(const Vector_2D& phi) const {
+        Vector_2D phi_new = op_.apply(phi);
+        for(std::size_t j = 0; j < phi_new.size(); j++) {
+            for(std::size_t i = 0; i < phi_new[j].size(); i++) {
+                phi_new[j][i] = coverage_[j][i] > 0 ? phi_new[j][i] / coverage_[j][i] : std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+        return phi_new;
+    }
+
+    Vector_1D FixedGridResampler::applyX(const Vector_1D& phi) const {
+        return resample1D(xEdges_, phi, grid_.x0, grid_.dx, grid_.nx);
+    }
+
+    Vector_1D FixedGridResampler::applyY(const Vector_1D& phi) const {
+        return resample1D(yEdges_, phi, grid_.y0, grid_.dy, grid_.ny);
+    }
+
+    Vector_1D resample1D(const Vector_1D& edges, const Vector_1D& phi, double x0, double dx, int n) {
+        if(phi.size() + 1 != edges.size()) {
+            throw std::invalid_argument("resample1D: field does not match the cell edges");
+        }
+        Vector_1D sum(n, 0);
+        Vector_1D covered(n, 0);
+        for(std::size_t k = 0; k < phi.size(); k++) {
+            int start = std::max(std::floor((edges[k] - x0) / dx), 0.0);
+            int end = std::min(std::floor((edges[k + 1] - x0) / dx), static_cast<double>(n - 1));
+            for(int i = start; i <= end; i++) {
+                double overlap = std::min(edges[k + 1], x0 + dx * (i + 1)) - std::max(edges[k], x0 + dx * i);
+                if(overlap <= 0) continue;
+                sum[i] += phi[k] * overlap;
+                covered[i] += overlap;
+            }
+        }
+        for(int i = 0; i < n; i++) {
+            sum[i] = covered[i] > 0 ? sum[i] / covered[i] : std::numeric_limits<double>::quiet_NaN();
+        }
+        return sum;
+    }
+
+}
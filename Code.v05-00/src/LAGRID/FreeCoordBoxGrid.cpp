@@ -1,16 +1,18 @@
 #include "LAGRID/FreeCoordBoxGrid.hpp"
 namespace LAGRID {
     FreeCoordBoxGrid::FreeCoordBoxGrid(const Vector_1D& dx, const Vector_1D& dy, const Vector_2D& phi, const Vector_1D& x0, double y0, double cutoff) {
+        int nx = dx.size();
+        int ny = dy.size();
         auto isInteriorCell = [&](int i, int j) -> bool {
-            bool edgeIndex = (i == 0 || j == 0 || i == dx.size() - 1 || j == dy.size() - 1);
+            bool edgeIndex = (i == 0 || j == 0 || i == nx - 1 || j == ny - 1);
             return !edgeIndex && (phi[j+1][i] > cutoff && phi[j-1][i] > cutoff && 
                                   phi[j][i+1] > cutoff && phi[j][i-1] > cutoff);
         };
 
         double curr_y = y0; // Y coordinate of bottom edge of the cell row
-        for(int j = 0; j < dy.size(); j++) {
+        for(int j = 0; j < ny; j++) {
             double curr_x = x0[j]; // X coord of left edge of cell column
-            for(int i = 0; i < dx.size(); i++) {
+            for(int i = 0; i < nx; i++) {
                 if(phi[j][i] < cutoff) {
                     curr_x += dx[j];
                     continue;
@@ -28,15 +30,16 @@ namespace LAGRID {
 
     FreeCoordBoxGrid::FreeCoordBoxGrid(const Vector_1D& dx, const Vector_1D& dy, const Vector_2D& phi, const Vector_1D& x0, double y0, const vector<vector<int>>& mask) {
         int nx = phi[0].size();
+        int ny = dy.size();
         auto isInteriorCell = [&](int i, int j) -> bool {
-            bool edgeIndex = (i == 0 || j == 0 || i == nx - 1 || j == dy.size() - 1);
+            bool edgeIndex = (i == 0 || j == 0 || i == nx - 1 || j == ny - 1);
             return !edgeIndex && (mask[j+1][i] == 1 && mask[j-1][i] == 1 && 
                                   mask[j][i+1] == 1 && mask[j][i-1] == 1);
         };
 
         double curr_y = y0; // Y coordinate of bottom edge of the cell row
 
-        for(int j = 0; j < dy.size(); j++) {
+        for(int j = 0; j < ny; j++) {
             double curr_x = x0[j]; // X coord of left edge of cell column
             for(int i = 0; i < nx; i++) {
                 if(mask[j][i] == 0) {
@@ -55,6 +58,32 @@ namespace LAGRID {
         setMinMaxCoords();
     }
     
+    FreeCoordBoxGrid::FreeCoordBoxGrid(const Vector_2D& xEdges, const Vector_1D& dy, const Vector_2D& phi, double y0, const vector<vector<int>>& mask) {
+        int nx = phi[0].size();
+        int ny = dy.size();
+        auto isInteriorCell = [&](int i, int j) -> bool {
+            bool edgeIndex = (i == 0 || j == 0 || i == nx - 1 || j == ny - 1);
+            return !edgeIndex && (mask[j+1][i] == 1 && mask[j-1][i] == 1 && 
+                                  mask[j][i+1] == 1 && mask[j][i-1] == 1);
+        };
+
+        double curr_y = y0; // Y coordinate of bottom edge of the cell row
+
+        for(int j = 0; j < ny; j++) {
+            for(int i = 0; i < nx; i++) {
+                if(mask[j][i] == 0) continue;
+                double dx = xEdges[j][i + 1] - xEdges[j][i];
+                boxes.emplace_back(xEdges[j][i], curr_y + dy[j], xEdges[j][i + 1], curr_y, phi[j][i] * dx * dy[j]);
+                if(!isInteriorCell(i, j)) {
+                    boundaryBoxIndices.push_back(boxes.size() - 1);
+                }
+            }
+            curr_y += dy[j];
+        }
+
+        setMinMaxCoords();
+    }
+    
     void FreeCoordBoxGrid::setMinMaxCoords() {
         minX = std::numeric_limits<double>::max();
         minY = std::numeric_limits<double>::max();
@@ -0,0 +1,104 @@
+#include "LAGRID/PaddedGrid.hpp"
+#include <algorithm>
+#include <stdexcept>
+namespace LAGRID {
+
+    PaddedGrid::PaddedGrid(int ny, int nx, int halo):
+        PaddedGrid(ny, nx, halo, halo, halo, halo)
+    {
+    }
+
+    PaddedGrid::PaddedGrid(int ny, int nx, int haloLeft, int haloRight, int haloTop, int haloBot):
+        stride_(haloLeft + nx + haloRight),
+        rows_(haloBot + ny + haloTop),
+        rowOrigin_(haloBot),
+        colOrigin_(haloLeft),
+        nx_(nx),
+        ny_(ny)
+    {
+        if(nx < 0 || ny < 0 || haloLeft < 0 || haloRight < 0 || haloTop < 0 || haloBot < 0) {
+            throw std::invalid_argument("PaddedGrid: sizes must be nonnegative");
+        }
+        data_.assign(static_cast<std::size_t>(stride_) * rows_, 0.0);
+    }
+
+    PaddedGrid::PaddedGrid(const Vector_2D& phi, int halo):
+        PaddedGrid(phi.size(), phi.empty() ? 0 : phi[0].size(), halo)
+    {
+        for(int j = 0; j < ny_; j++) {
+            if(static_cast<int>(phi[j].size()) != nx_) {
+                throw std::invalid_argument("PaddedGrid: rows of the input field differ in length");
+            }
+            std::copy(phi[j].begin(), phi[j].end(), (*this)[j].begin());
+        }
+    }
+
+    void PaddedGrid::extend(int nLeft, int nRight, int nTop, int nBot) {
+        if(nLeft < 0 || nRight < 0 || nTop < 0 || nBot < 0) {
+            throw std::invalid_argument("PaddedGrid::extend: the grid can only grow");
+        }
+        if(nLeft > haloLeft() || nRight > haloRight() || nTop > haloTop() || nBot > haloBot()) {
+            //Grow the halo geometrically on the sides that ran out, so repeated extends are amortized O(1)
+            auto grown = [](int halo, int n) { return n > halo ? n + std::max(halo, n) : halo; };
+            reallocate(grown(haloLeft(), nLeft), grown(haloRight(), nRight), grown(haloTop(), nTop), grown(haloBot(), nBot));
+        }
+        //The halo is all zeros, so moving the window is enough
+        colOrigin_ -= nLeft;
+        rowOrigin_ -= nBot;
+        nx_ += nLeft + nRight;
+        ny_ += nTop + nBot;
+    }
+
+    void PaddedGrid::reserve(int haloLeft_new, int haloRight_new, int haloTop_new, int haloBot_new) {
+        if(haloLeft_new <= haloLeft() && haloRight_new <= haloRight() && haloTop_new <= haloTop() && haloBot_new <= haloBot()) return;
+        reallocate(std::max(haloLeft_new, haloLeft()), std::max(haloRight_new, haloRight()),
+                   std::max(haloTop_new, haloTop()), std::max(haloBot_new, haloBot()));
+    }
+
+    void PaddedGrid::reallocate(int haloLeft_new, int haloRight_new, int haloTop_new, int haloBot_new) {
+        int stride_new = haloLeft_new + nx_ + haloRight_new;
+        int rows_new = haloBot_new + ny_ + haloTop_new;
+        Vector_1D data_new(static_cast<std::size_t>(stride_new) * rows_new, 0.0);
+        for(int j = 0; j < ny_; j++) {
+            auto row = (*this)[j];
+            std::copy(row.begin(), row.end(), data_new.begin() + static_cast<std::size_t>(j + haloBot_new) * stride_new + haloLeft_new);
+        }
+        data_ = std::move(data_new);
+        stride_ = stride_new;
+        rows_ = rows_new;
+        rowOrigin_ = haloBot_new;
+        colOrigin_ = haloLeft_new;
+    }
+
+    void PaddedGrid::reset(int ny, int nx) {
+        if(nx < 0 || ny < 0) {
+            throw std::invalid_argument("PaddedGrid: sizes must be nonnegative");
+        }
+        //Spare storage beyond the grid is zeroed too, as it becomes halo once the grid is extended
+        data_.assign(std::max(data_.size(), static_cast<std::size_t>(nx) * ny), 0.0);
+        stride_ = nx;
+        rows_ = ny;
+        rowOrigin_ = 0;
+        colOrigin_ = 0;
+        nx_ = nx;
+        ny_ = ny;
+    }
+
+    Vector_2D PaddedGrid::toVector2D() const {
+        Vector_2D phi(ny_);
+        for(int j = 0; j < ny_; j++) {
+            auto row = (*this)[j];
+            phi[j].assign(row.begin(), row.end());
+        }
+        return phi;
+    }
+
+    void PaddedGrid::copyTo(Vector_2D& phi) const {
+        phi.resize(ny_);
+        for(int j = 0; j < ny_; j++) {
+            auto row = (*this)[j];
+            phi[j].assign(row.begin(), row.end());
+        }
+    }
+
+}
@@ -0,0 +1,152 @@
+#include "LAGRID/RemapOperator.hpp"
+#include <algorithm>
+#include <stdexcept>
+namespace LAGRID {
+
+    RemapOperator::RemapOperator(const FreeCoordBoxGrid& unitBoxGrid, const vector<vector<int>>& mask, const Remapping& remapping):
+        dx_(remapping.dx),
+        dy_(remapping.dy)
+    {
+        //Boxes are generated row by row over the masked cells, so the n-th box comes from the n-th masked cell.
+        for(std::size_t j = 0; j < mask.size(); j++) {
+            for(std::size_t i = 0; i < mask[j].size(); i++) {
+                if(mask[j][i] == 0) continue;
+                srcRow_.push_back(j);
+                srcCol_.push_back(i);
+            }
+        }
+        if(srcRow_.size() != unitBoxGrid.boxes.size()) {
+            throw std::invalid_argument("RemapOperator: box grid does not match the mask");
+        }
+
+        double cellArea = remapping.dx * remapping.dy;
+        boxStart_.reserve(unitBoxGrid.boxes.size() + 1);
+        boxStart_.push_back(0);
+        //Same overlap logic as mapToStructuredGrid
+        for(auto& b: unitBoxGrid.boxes) {
+            int startGridIdx_x = std::max(std::floor((b.topLeftX - remapping.x0) / remapping.dx), 0.0);
+            int endGridIdx_x = std::min(std::floor((b.botRightX - remapping.x0) / remapping.dx), static_cast<double>(remapping.nx - 1));
+            int startGridIdx_y = std::max(std::floor((b.botRightY - remapping.y0) / remapping.dy), 0.0);
+            int endGridIdx_y = std::min(std::floor((b.topLeftY - remapping.y0) / remapping.dy), static_cast<double>(remapping.ny - 1));
+
+            for (int j = startGridIdx_y; j <= endGridIdx_y; j++) {
+                for(int i = startGridIdx_x; i <= endGridIdx_x; i++) {
+                    double area = coveredArea(remapping, b, i, j);
+                    dstRow_.push_back(j);
+                    dstCol_.push_back(i);
+                    weights_.push_back((b.mass * area / b.area()) / cellArea);
+                }
+            }
+            boxStart_.push_back(weights_.size());
+        }
+
+        xCoords_ = Vector_1D(remapping.nx);
+        yCoords_ = Vector_1D(remapping.ny);
+        xEdges_ = Vector_1D(remapping.nx + 1);
+        std::generate(xCoords_.begin(), xCoords_.end(), [&remapping, i = 0] () mutable { return remapping.x0 + remapping.dx * ( (i++) + 0.5);});
+        std::generate(yCoords_.begin(), yCoords_.end(), [&remapping, j = 0] () mutable { return remapping.y0 + remapping.dy * ( (j++) + 0.5);});
+        std::generate(xEdges_.begin(), xEdges_.end(), [&remapping, i = 0] () mutable { return remapping.x0 + remapping.dx * (i++);});
+    }
+
+    void RemapOperator::addBuffer(double bufLen_left, double bufLen_right, double bufLen_top, double bufLen_bot) {
+        //Same number of buffer rows/columns as twoDGridVariable::addBuffer
+        int numCols_leftBuffer = std::floor(bufLen_left / dx_);
+        int numCols_rightBuffer = std::floor(bufLen_right / dx_);
+
+        Vector_1D xCoords_new(numCols_leftBuffer + xCoords_.size() + numCols_rightBuffer);
+        double x0 = xCoords_[0] - numCols_leftBuffer * dx_;
+        std::generate(xCoords_new.begin(), xCoords_new.end(), [this, x0, i = 0] () mutable { return x0 + (i++) * dx_;});
+        Vector_1D xEdges_new(xCoords_new.size() + 1);
+        std::generate(xEdges_new.begin(), xEdges_new.end(), [this, x0, i = 0] () mutable { return x0 + (i++ - 0.5) * dx_;});
+
+        xCoords_ = std::move(xCoords_new);
+        xEdges_ = std::move(xEdges_new);
+        colOffset_ += numCols_leftBuffer;
+        addRowBuffers(bufLen_top, bufLen_bot);
+    }
+
+    void RemapOperator::addBuffer(double bufLen_left, double bufLen_right, double bufLen_top, double bufLen_bot, int blockCells, int maxLevel) {
+        Vector_1D widths_left = coarsenedBufferWidths(bufLen_left, dx_, blockCells, maxLevel);
+        Vector_1D widths_right = coarsenedBufferWidths(bufLen_right, dx_, blockCells, maxLevel);
+
+        Vector_1D xEdges_new;
+        xEdges_new.reserve(widths_left.size() + xEdges_.size() + widths_right.size());
+        //Left buffer is built outwards from the fine block, then flipped
+        double x = xEdges_.front();
+        for(double w: widths_left) {
+            x -= w;
+            xEdges_new.push_back(x);
+        }
+        std::reverse(xEdges_new.begin(), xEdges_new.end());
+        xEdges_new.insert(xEdges_new.end(), xEdges_.begin(), xEdges_.end());
+        x = xEdges_.back();
+        for(double w: widths_right) {
+            x += w;
+            xEdges_new.push_back(x);
+        }
+
+        xCoords_.resize(xEdges_new.size() - 1);
+        for(std::size_t i = 0; i < xCoords_.size(); i++) {
+            xCoords_[i] = 0.5 * (xEdges_new[i] + xEdges_new[i + 1]);
+        }
+        xEdges_ = std::move(xEdges_new);
+        colOffset_ += widths_left.size();
+        addRowBuffers(bufLen_top, bufLen_bot);
+    }
+
+    void RemapOperator::addRowBuffers(double bufLen_top, double bufLen_bot) {
+        int numRows_topBuffer = std::floor(bufLen_top / dy_);
+        int numRows_botBuffer = std::floor(bufLen_bot / dy_);
+
+        Vector_1D yCoords_new(numRows_botBuffer + yCoords_.size() + numRows_topBuffer);
+        double y0 = yCoords_[0] - numRows_botBuffer * dy_;
+        std::generate(yCoords_new.begin(), yCoords_new.end(), [this, y0, j = 0] () mutable { return y0 + (j++) * dy_;});
+
+        yCoords_ = std::move(yCoords_new);
+        rowOffset_ += numRows_botBuffer;
+    }
+
+    Vector_2D RemapOperator::apply(const Vector_2D& phi) const {
+        PaddedGrid phi_new(0, 0);
+        apply(phi, phi_new);
+        return phi_new.toVector2D();
+    }
+
+    void RemapOperator::apply(const Vector_2D& phi, PaddedGrid& phi_new) const {
+        phi_new.reset(yCoords_.size(), xCoords_.size());
+        for(std::size_t b = 0; b < srcRow_.size(); b++) {
+            double val = phi[srcRow_[b]][srcCol_[b]];
+            if(val == 0) continue;
+            for(std::size_t e = boxStart_[b]; e < boxStart_[b + 1]; e++) {
+                phi_new(dstRow_[e] + rowOffset_, dstCol_[e] + colOffset_) += weights_[e] * val;
+            }
+        }
+    }
+
+    void RemapOperator::applyInPlace(const std::vector<Vector_2D*>& fields) const {
+        #pragma omp parallel default(shared)
+        {
+            PaddedGrid phi_new(0, 0);
+            #pragma omp for schedule(dynamic, 1)
+            for(std::size_t n = 0; n < fields.size(); n++) {
+                apply(*fields[n], phi_new);
+                phi_new.copyTo(*fields[n]);
+            }
+        }
+    }
+
+    RemapOperator buildRemapOperator(double dy_old, const Vector_1D& dy_new, double dx_old, double x0_old, double y0_new,
+                                     const vector<vector<int>>& mask, const Remapping& remapping) {
+        Vector_2D unitPhi(mask.size(), Vector_1D(mask[0].size(), 1.0));
+        FreeCoordBoxGrid unitBoxGrid = rectToBoxGrid(dy_old, dy_new, dx_old, x0_old, y0_new, unitPhi, mask);
+        return RemapOperator(unitBoxGrid, mask, remapping);
+    }
+
+    RemapOperator buildRemapOperator(double dy_old, const Vector_1D& dy_new, const Vector_1D& xEdges_old, double y0_new,
+                                     const vector<vector<int>>& mask, const Remapping& remapping) {
+        Vector_2D unitPhi(mask.size(), Vector_1D(mask[0].size(), 1.0));
+        FreeCoordBoxGrid unitBoxGrid = rectToBoxGrid(dy_old, dy_new, xEdges_old, y0_new, unitPhi, mask);
+        return RemapOperator(unitBoxGrid, mask, remapping);
+    }
+
+}
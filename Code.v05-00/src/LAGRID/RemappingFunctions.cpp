@@ -1,10 +1,8 @@
 #include "LAGRID/RemappingFunctions.hpp"
+#include <stdexcept>
 namespace LAGRID {
 
     void twoDGridVariable::addBuffer(double bufLen_left, double bufLen_right, double bufLen_top, double bufLen_bot) {
-        int nx_before = xCoords.size();
-        int ny_before = yCoords.size();
-
         //Generate coords of buffer areas
         int numRows_topBuffer = std::floor(bufLen_top / dy);
         Vector_1D topBufferCoords(numRows_topBuffer);
@@ -28,18 +26,8 @@ namespace LAGRID {
         xCoords.insert(xCoords.begin(), leftBufferCoords.begin(), leftBufferCoords.end());
         xCoords.insert(xCoords.end(), rightBufferCoords.begin(), rightBufferCoords.end());
 
-        //Expand phi 2d array
-        for(int j = 0; j < numRows_topBuffer + numRows_botBuffer; j++) {
-            phi.push_back(Vector_1D(nx_before, 0));
-        }
-
-        //rotate right by numRows_botBuffer to get those on the other side.
-        std::rotate(phi.rbegin(), phi.rbegin() + numRows_botBuffer, phi.rend());
-        for(int j = 0; j < yCoords.size(); j++) {
-            phi[j].insert(phi[j].begin(), numCols_leftBuffer, 0);
-            phi[j].insert(phi[j].end(), numCols_rightBuffer, 0);
-        }
-
+        //Expand phi, the new cells come out of the zero halo
+        phi.extend(numCols_leftBuffer, numCols_rightBuffer, numRows_topBuffer, numRows_botBuffer);
     }
 
     /*
@@ -134,27 +122,70 @@ namespace LAGRID {
         return FreeCoordBoxGrid(dx_new, dy_new, phi_new, x0_new, y0_new, mask);
     }
 
-    twoDGridVariable mapToStructuredGrid(const FreeCoordBoxGrid& boxGrid, const Remapping& remapping) {
+    FreeCoordBoxGrid rectToBoxGrid(double dy_old, const Vector_1D& dy_new, const Vector_1D& xEdges_old, double y0_new, const Vector_2D& phi_old, const vector<vector<int>>& mask) {
+        int ny = phi_old.size();
+        int nx = phi_old[0].size();
+        double xCenter = 0.5 * (xEdges_old[0] + xEdges_old[nx]);
+
+        Vector_2D phi_new(ny, Vector_1D(nx));
+        Vector_2D xEdges_new(ny, Vector_1D(nx + 1));
+        for(int j = 0; j < ny; j++) {
+            double scaling = dy_new[j] / dy_old;
+            for(int i = 0; i <= nx; i++) {
+                xEdges_new[j][i] = xCenter + (xEdges_old[i] - xCenter) * scaling;
+            }
+            double cellAreaRatio = scaling * scaling;
+            for(int i = 0; i < nx; i++) {
+                phi_new[j][i] = phi_old[j][i] / cellAreaRatio;
+            }
+        }
+        return FreeCoordBoxGrid(xEdges_new, dy_new, phi_new, y0_new, mask);
+    }
+
+    Vector_1D coarsenedBufferWidths(double bufLen, double dx, int blockCells, int maxLevel) {
+        if(blockCells <= 0 || maxLevel < 0) {
+            throw std::invalid_argument("coarsenedBufferWidths: blockCells must be positive and maxLevel non-negative");
+        }
+        Vector_1D widths;
+        double covered = 0;
+        int level = 0;
+        double width = dx;
+        while(covered + 0.5 * width < bufLen) {
+            widths.push_back(width);
+            covered += width;
+            if(level < maxLevel && widths.size() % blockCells == 0) {
+                level++;
+                width *= 2;
+            }
+        }
+        return widths;
+    }
+
+    twoDGridVariable mapToStructuredGrid(const FreeCoordBoxGrid& boxGrid, const Remapping& remapping,
+                                         double bufLen_left, double bufLen_right, double bufLen_top, double bufLen_bot) {
         Vector_1D xCoords(remapping.nx);
         Vector_1D yCoords(remapping.ny);
 
         //Using some type-deduced local variables i, j that are default const (added with C++14 generic lambdas), so need the mutable to be able to modify them in the lambda.
         std::generate(xCoords.begin(), xCoords.end(), [&remapping, i = 0] () mutable { return remapping.x0 + remapping.dx * ( (i++) + 0.5);});
         std::generate(yCoords.begin(), yCoords.end(), [&remapping, j = 0] () mutable { return remapping.y0 + remapping.dy * ( (j++) + 0.5);});
-        Vector_2D phi(remapping.ny, Vector_1D(remapping.nx, 0));
+        //Same number of buffer columns/rows as twoDGridVariable::addBuffer
+        PaddedGrid phi(remapping.ny, remapping.nx,
+                       std::floor(bufLen_left / remapping.dx), std::floor(bufLen_right / remapping.dx),
+                       std::floor(bufLen_top / remapping.dy), std::floor(bufLen_bot / remapping.dy));
         double cellArea = remapping.dx * remapping.dy;
 
         for(auto& b: boxGrid.boxes) {
             //Need the std::min bounding to deal with edge cases of some boundary cell being included in the remapping.
             int startGridIdx_x = std::max(std::floor((b.topLeftX - remapping.x0) / remapping.dx), 0.0);
-            int endGridIdx_x = std::min(std::floor((b.botRightX - remapping.x0) / remapping.dx), static_cast<double>(phi[0].size() - 1));
+            int endGridIdx_x = std::min(std::floor((b.botRightX - remapping.x0) / remapping.dx), static_cast<double>(phi.nx() - 1));
             int startGridIdx_y = std::max(std::floor((b.botRightY - remapping.y0) / remapping.dy), 0.0);
-            int endGridIdx_y = std::min(std::floor((b.topLeftY - remapping.y0) / remapping.dy), static_cast<double>(phi.size() - 1));
+            int endGridIdx_y = std::min(std::floor((b.topLeftY - remapping.y0) / remapping.dy), static_cast<double>(phi.ny() - 1));
 
             for (int j = startGridIdx_y; j <= endGridIdx_y; j++) {
                 for(int i = startGridIdx_x; i <= endGridIdx_x; i++) {
                     double area = coveredArea(remapping, b, i, j);
-                    phi[j][i] += (b.mass * area / b.area()) / cellArea;
+                    phi(j, i) += (b.mass * area / b.area()) / cellArea;
                 }
             }
         }
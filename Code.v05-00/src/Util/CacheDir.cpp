@@ -0,0 +1,44 @@
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include "Util/CacheDir.hpp"
+
+std::string UserCacheDir()
+{
+
+    const char* cacheHome = std::getenv( "XDG_CACHE_HOME" );
+    const char* home      = std::getenv( "HOME" );
+    std::filesystem::path dir;
+    if ( ( cacheHome != nullptr ) && ( *cacheHome != '\0' ) )
+        dir = cacheHome;
+    else if ( ( home != nullptr ) && ( *home != '\0' ) )
+        dir = std::filesystem::path( home ) / ".cache";
+    else
+        return "";
+    dir /= "APCEMM";
+
+    std::error_code ec;
+    std::filesystem::create_directories( dir, ec );
+    return ec ? "" : dir.string();
+
+} /* End of UserCacheDir */
+
+std::string UserCacheFile( const std::string &sourceFile, const std::string &prefix, \
+                           const std::string &extension )
+{
+
+    const std::string dir = UserCacheDir();
+    if ( dir.empty() )
+        return "";
+
+    std::error_code ec;
+    const std::filesystem::path absSource = std::filesystem::weakly_canonical( sourceFile, ec );
+    std::stringstream name;
+    name << dir << "/" << prefix << "_" << std::hex \
+         << std::hash<std::string>{}( ec ? sourceFile : absSource.string() ) << extension;
+    return name.str();
+
+} /* End of UserCacheFile */
+
+/* End of CacheDir.cpp */
@@ -13,27 +13,17 @@
 
 #include "Util/MC_Rand.hpp"
 
-void setSeed() {
-
-    /* Sets seed for pseudo-random generator.
-     * For that use the current unix timestamp as our random seed. */
-    srand(time(0));
-
-} /* End of setSeed */
-
-template <typename T>
-T fRand(const T fMin, const T fMax) {
-
-    /* Returns a random number between fMin and fMax */
-
-    double f = (double) rand()/RAND_MAX;
-    return (T) fMin + f * (fMax - fMin);
-
-} /* End of fRand */
-
-template double fRand(const double fMin, const double fMax);
-template float fRand(const float fMin, const float fMax);
-template int fRand(const int fMin, const int fMax);
-template unsigned int fRand(const unsigned int fMin, const unsigned int fMax);
+std::uint32_t randStream( const std::string &name ) {
+
+    /* 32-bit FNV-1a hash: unlike std::hash, the same on every platform
+     * and in every run */
+    std::uint32_t hash = 0x811C9DC5;
+    for ( const char c: name ) {
+        hash ^= (unsigned char) c;
+        hash *= 0x01000193;
+    }
+    return hash;
+
+} /* End of randStream */
 
 /* End of MC_Rand.cpp */
@@ -14,6 +14,14 @@ namespace VectorUtils {
         return areas;
     }
 
+    Vector_1D cellWidths (const Vector_1D& edges) {
+        Vector_1D widths(edges.size() - 1);
+        for(int i = 0; i < widths.size(); i++) {
+            widths[i] = edges[i+1] - edges[i];
+        }
+        return widths;
+    }
+
     double VecMin2D (const Vector_2D& vec) {
         double min = std::numeric_limits<double>::max();
         for (int j = 0; j < vec.size(); j++) {
@@ -85,10 +85,43 @@ namespace YamlInputReader{
         input.SIMULATION_PARAMETER_SWEEP = parseBoolString(paramSweepSubmenu["Parameter sweep (T/F)"].as<string>(), "Parameter sweep (T/F");
         input.SIMULATION_MONTECARLO = parseBoolString(paramSweepSubmenu["Run Monte Carlo (T/F)"].as<string>(), "Run Monte Carlo (T/F)");
         input.SIMULATION_MCRUNS =  parseIntString(paramSweepSubmenu["Num Monte Carlo runs (int)"].as<string>(), "Num Monte Carlo runs (int)");
+        //Optional: seed of the Monte Carlo sampling and of the temperature perturbations
+        input.SIMULATION_RANDOM_SEED = 0;
+        if(paramSweepSubmenu["Random seed (non-negative int)"]) {
+            const int seed = parseIntString(paramSweepSubmenu["Random seed (non-negative int)"].as<string>(), "Random seed (non-negative int)");
+            if(seed < 0) {
+                throw std::invalid_argument("Random seed must be non-negative!");
+            }
+            input.SIMULATION_RANDOM_SEED = seed;
+        }
 
         YAML::Node outputSubmenu = simNode["OUTPUT SUBMENU"];
         input.SIMULATION_OUTPUT_FOLDER = parseFileSystemPath(outputSubmenu["Output folder (string)"].as<string>());
         input.SIMULATION_OVERWRITE = parseBoolString(outputSubmenu["Overwrite if folder exists (T/F)"].as<string>(), "Overwrite if folder exists (T/F)");
+        //Optional: early plume microphysics output. Defaults write every other state as text.
+        input.SIMULATION_MICRO_FORMAT = "text";
+        input.SIMULATION_MICRO_WRITE_EVERY = 2;
+        input.SIMULATION_MICRO_REL_CHANGE = 0;
+        if(outputSubmenu["EPM micro output format (none/text/binary)"]) {
+            input.SIMULATION_MICRO_FORMAT = outputSubmenu["EPM micro output format (none/text/binary)"].as<string>();
+        }
+        if(outputSubmenu["EPM micro output every N steps (positive int)"]) {
+            input.SIMULATION_MICRO_WRITE_EVERY = parseIntString(outputSubmenu["EPM micro output every N steps (positive int)"].as<string>(), "EPM micro output every N steps (positive int)");
+        }
+        if(outputSubmenu["EPM micro output rel. change threshold (nonnegative double)"]) {
+            input.SIMULATION_MICRO_REL_CHANGE = parseDoubleString(outputSubmenu["EPM micro output rel. change threshold (nonnegative double)"].as<string>(), "EPM micro output rel. change threshold (nonnegative double)");
+        }
+        if(input.SIMULATION_MICRO_FORMAT != "none" && input.SIMULATION_MICRO_FORMAT != "text" && input.SIMULATION_MICRO_FORMAT != "binary") {
+            throw std::invalid_argument("EPM micro output format must be one of none, text or binary!");
+        }
+        if(input.SIMULATION_MICRO_WRITE_EVERY < 1 || input.SIMULATION_MICRO_REL_CHANGE < 0) {
+            throw std::invalid_argument("EPM micro output every N steps must be positive and the rel. change threshold nonnegative!");
+        }
+        //Optional: scalar time series of every case in one file, in the output folder. Off by default.
+        input.SIMULATION_SUMMARY_FILENAME = "";
+        if(outputSubmenu["Sweep summary file (string)"] && !outputSubmenu["Sweep summary file (string)"].IsNull()) {
+            input.SIMULATION_SUMMARY_FILENAME = outputSubmenu["Sweep summary file (string)"].as<string>();
+        }
         input.SIMULATION_THREADED_FFT = parseBoolString(simNode["Use threaded FFT (T/F)"].as<string>(), "Use threaded FFT (T/F)");
 
         YAML::Node fftwWisdomSubmenu = simNode["FFTW WISDOM SUBMENU"];
@@ -96,6 +129,11 @@ namespace YamlInputReader{
         input.SIMULATION_DIRECTORY_W_WRITE_PERMISSION = parseFileSystemPath(fftwWisdomSubmenu["Dir w/ write permission (string)"].as<string>());
         input.SIMULATION_INPUT_BACKG_COND = parseFileSystemPath(simNode["Input background condition (string)"].as<string>());
         input.SIMULATION_INPUT_ENG_EI = parseFileSystemPath(simNode["Input engine emissions (string)"].as<string>());
+        //Optional: keep binary copies of the two input files above in the user cache folder. Off by default.
+        input.SIMULATION_PRECOMPILE_INPUTS = false;
+        if(simNode["Precompile input files (T/F)"]) {
+            input.SIMULATION_PRECOMPILE_INPUTS = parseBoolString(simNode["Precompile input files (T/F)"].as<string>(), "Precompile input files (T/F)");
+        }
 
         YAML::Node saveForwardSubmenu = simNode["SAVE FORWARD RESULTS SUBMENU"];
         input.SIMULATION_SAVE_FORWARD = parseBoolString(saveForwardSubmenu["Save forward results (T/F)"].as<string>(), "Save forward results (T/F)");
@@ -104,6 +142,14 @@ namespace YamlInputReader{
         YAML::Node adjointSubmenu = simNode["ADJOINT OPTIMIZATION SUBMENU"];
         input.SIMULATION_ADJOINT = parseBoolString(adjointSubmenu["Turn on adjoint optim. (T/F)"].as<string>(), "Turn on adjoint optim. (T/F)");
         input.SIMULATION_ADJOINT_FILENAME = adjointSubmenu["netCDF filename format (string)"].as<string>();
+        //Optional: memory for the forward trajectory of the adjoint. 0 stores every step.
+        input.SIMULATION_ADJOINT_CHECKPOINT_MB = 0.0;
+        if(adjointSubmenu["Checkpoint memory [MB] (double)"]) {
+            input.SIMULATION_ADJOINT_CHECKPOINT_MB = parseDoubleString(adjointSubmenu["Checkpoint memory [MB] (double)"].as<string>(), "Checkpoint memory [MB] (double)");
+        }
+        if(input.SIMULATION_ADJOINT_CHECKPOINT_MB < 0) {
+            throw std::invalid_argument("Adjoint checkpoint memory must be nonnegative!");
+        }
 
         YAML::Node boxModelSubmenu = simNode["BOX MODEL SUBMENU"];
         input.SIMULATION_BOXMODEL = parseBoolString(boxModelSubmenu["Run box model (T/F)"].as<string>(), "Run box model (T/F)");
@@ -112,50 +158,58 @@ namespace YamlInputReader{
         if(input.SIMULATION_PARAMETER_SWEEP == input.SIMULATION_MONTECARLO){
             throw std::invalid_argument("In Simulation Menu: Parameter sweep and Monte Carlo cannot have the same value!");
         }
+        if(input.SIMULATION_MONTECARLO && input.SIMULATION_MCRUNS < 1){
+            throw std::invalid_argument("In Simulation Menu: Num Monte Carlo runs cannot be less than 1!");
+        }
     }
     void readParamMenu(OptInput& input, const YAML::Node& paramNode){
 
-        input.PARAMETER_PARAM_MAP["PLUMEPROCESS"] = parseParamSweepInput(paramNode["Plume Process [hr] (double)"].as<string>(), "Plume Process [hr] (double)");
+        //Set by readSimMenu: Monte Carlo runs sample every parameter nRuns times from the seed
+        const bool monteCarlo = input.SIMULATION_MONTECARLO;
+        const int nRuns = input.SIMULATION_MCRUNS;
+        const std::uint64_t seed = input.SIMULATION_RANDOM_SEED;
+
+        input.PARAMETER_PARAM_MAP["PLUMEPROCESS"] = parseParamSweepInput(paramNode["Plume Process [hr] (double)"].as<string>(), "Plume Process [hr] (double)", monteCarlo, nRuns, seed);
 
         YAML::Node metParamSubmenu = paramNode["METEOROLOGICAL PARAMETERS SUBMENU"];
-        input.PARAMETER_PARAM_MAP["TEMPERATURE"] = parseParamSweepInput(metParamSubmenu["Temperature [K] (double)"].as<string>(), "Temperature [K] (double)");
-        input.PARAMETER_PARAM_MAP["RHW"] = parseParamSweepInput(metParamSubmenu["R.Hum. wrt water [%] (double)"].as<string>(), "R.Hum. wrt water [%] (double)");
-        input.PARAMETER_PARAM_MAP["PRESSURE"] = parseParamSweepInput(metParamSubmenu["Pressure [hPa] (double)"].as<string>(), "Pressure [hPa] (double)");
-        input.PARAMETER_PARAM_MAP["DH"] = parseParamSweepInput(metParamSubmenu["Horiz. diff. coeff. [m^2/s] (double)"].as<string>(), "Horiz. diff. coeff. [m^2/s] (double)");
-        input.PARAMETER_PARAM_MAP["DV"] = parseParamSweepInput(metParamSubmenu["Verti. diff. [m^2/s] (double)"].as<string>(), "Verti. diff. [m^2/s] (double)");
-        input.PARAMETER_PARAM_MAP["SHEAR"] = parseParamSweepInput(metParamSubmenu["Wind shear [1/s] (double)"].as<string>(), "Wind shear [1/s] (double)");
-        input.PARAMETER_PARAM_MAP["NBV"] = parseParamSweepInput(metParamSubmenu["Brunt-Vaisala Frequency [s^-1] (double)"].as<string>(), "Brunt-Vaisala Frequency [s^-1] (double)");
+        input.PARAMETER_PARAM_MAP["TEMPERATURE"] = parseParamSweepInput(metParamSubmenu["Temperature [K] (double)"].as<string>(), "Temperature [K] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["RHW"] = parseParamSweepInput(metParamSubmenu["R.Hum. wrt water [%] (double)"].as<string>(), "R.Hum. wrt water [%] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["PRESSURE"] = parseParamSweepInput(metParamSubmenu["Pressure [hPa] (double)"].as<string>(), "Pressure [hPa] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["DH"] = parseParamSweepInput(metParamSubmenu["Horiz. diff. coeff. [m^2/s] (double)"].as<string>(), "Horiz. diff. coeff. [m^2/s] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["DV"] = parseParamSweepInput(metParamSubmenu["Verti. diff. [m^2/s] (double)"].as<string>(), "Verti. diff. [m^2/s] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["SHEAR"] = parseParamSweepInput(metParamSubmenu["Wind shear [1/s] (double)"].as<string>(), "Wind shear [1/s] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["NBV"] = parseParamSweepInput(metParamSubmenu["Brunt-Vaisala Frequency [s^-1] (double)"].as<string>(), "Brunt-Vaisala Frequency [s^-1] (double)", monteCarlo, nRuns, seed);
 
         YAML::Node locTimeSubmenu = paramNode["LOCATION AND TIME SUBMENU"];
-        input.PARAMETER_PARAM_MAP["LONGITUDE"] = parseParamSweepInput(locTimeSubmenu["LON [deg] (double)"].as<string>(), "LAT [deg] (double)");
-        input.PARAMETER_PARAM_MAP["LATITUDE"] = parseParamSweepInput(locTimeSubmenu["LAT [deg] (double)"].as<string>(), "LON [deg] (double)");
-        input.PARAMETER_PARAM_MAP["EDAY"] = parseParamSweepInput(locTimeSubmenu["Emission day [1-365] (int)"].as<string>(), "Emission day [1-365] (int)");
-        input.PARAMETER_PARAM_MAP["ETIME"] = parseParamSweepInput(locTimeSubmenu["Emission time [hr] (double)"].as<string>(), "Emission time [hr] (double)");
+        input.PARAMETER_PARAM_MAP["LONGITUDE"] = parseParamSweepInput(locTimeSubmenu["LON [deg] (double)"].as<string>(), "LON [deg] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["LATITUDE"] = parseParamSweepInput(locTimeSubmenu["LAT [deg] (double)"].as<string>(), "LAT [deg] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["EDAY"] = parseParamSweepInput(locTimeSubmenu["Emission day [1-365] (int)"].as<string>(), "Emission day [1-365] (int)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["ETIME"] = parseParamSweepInput(locTimeSubmenu["Emission time [hr] (double)"].as<string>(), "Emission time [hr] (double)", monteCarlo, nRuns, seed);
        
         YAML::Node backMixRatioSubmenu = paramNode["BACKGROUND MIXING RATIOS SUBMENU"];
-        input.PARAMETER_PARAM_MAP["BACKG_NOX"] = parseParamSweepInput(backMixRatioSubmenu["NOx [ppt] (double)"].as<string>(), "NOx [ppt] (double)");
-        input.PARAMETER_PARAM_MAP["BACKG_HNO3"] = parseParamSweepInput(backMixRatioSubmenu["HNO3 [ppt] (double)"].as<string>(), "HNO3 [ppt] (double)");
-        input.PARAMETER_PARAM_MAP["BACKG_O3"] = parseParamSweepInput(backMixRatioSubmenu["O3 [ppb] (double)"].as<string>(), "O3 [ppb] (double)");
-        input.PARAMETER_PARAM_MAP["BACKG_CO"] = parseParamSweepInput(backMixRatioSubmenu["CO [ppb] (double)"].as<string>(), "CO [ppb] (double)");
-        input.PARAMETER_PARAM_MAP["BACKG_CH4"] = parseParamSweepInput(backMixRatioSubmenu["CH4 [ppm] (double)"].as<string>(), "CH4 [ppm] (double)");
-        input.PARAMETER_PARAM_MAP["BACKG_SO2"] = parseParamSweepInput(backMixRatioSubmenu["SO2 [ppt] (double)"].as<string>(), "SO2 [ppt] (double)");
+        input.PARAMETER_PARAM_MAP["BACKG_NOX"] = parseParamSweepInput(backMixRatioSubmenu["NOx [ppt] (double)"].as<string>(), "NOx [ppt] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["BACKG_HNO3"] = parseParamSweepInput(backMixRatioSubmenu["HNO3 [ppt] (double)"].as<string>(), "HNO3 [ppt] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["BACKG_O3"] = parseParamSweepInput(backMixRatioSubmenu["O3 [ppb] (double)"].as<string>(), "O3 [ppb] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["BACKG_CO"] = parseParamSweepInput(backMixRatioSubmenu["CO [ppb] (double)"].as<string>(), "CO [ppb] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["BACKG_CH4"] = parseParamSweepInput(backMixRatioSubmenu["CH4 [ppm] (double)"].as<string>(), "CH4 [ppm] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["BACKG_SO2"] = parseParamSweepInput(backMixRatioSubmenu["SO2 [ppt] (double)"].as<string>(), "SO2 [ppt] (double)", monteCarlo, nRuns, seed);
 
         YAML::Node eiSubmenu = paramNode["EMISSION INDICES SUBMENU"];
-        input.PARAMETER_PARAM_MAP["EI_NOX"] = parseParamSweepInput(eiSubmenu["NOx [g(NO2)/kg_fuel] (double)"].as<string>(), "NOx [g(NO2)/kg_fuel] (double)");
-        input.PARAMETER_PARAM_MAP["EI_CO"] = parseParamSweepInput(eiSubmenu["CO [g/kg_fuel] (double)"].as<string>(), "CO [g/kg_fuel] (double)");
-        input.PARAMETER_PARAM_MAP["EI_UHC"] = parseParamSweepInput(eiSubmenu["UHC [g/kg_fuel] (double)"].as<string>(), "UHC [g/kg_fuel] (double)");
-        input.PARAMETER_PARAM_MAP["EI_SO2"] = parseParamSweepInput(eiSubmenu["SO2 [g/kg_fuel] (double)"].as<string>(), "SO2 [g/kg_fuel] (double)");
-        input.PARAMETER_PARAM_MAP["EI_SO2TOSO4"] =  parseParamSweepInput(eiSubmenu["SO2 to SO4 conv [%] (double)"].as<string>(), "SO2 to SO4 conv [%] (double)");
-        input.PARAMETER_PARAM_MAP["EI_SOOT"] = parseParamSweepInput(eiSubmenu["Soot [g/kg_fuel] (double)"].as<string>(), "Soot [g/kg_fuel] (double)");
+        input.PARAMETER_PARAM_MAP["EI_NOX"] = parseParamSweepInput(eiSubmenu["NOx [g(NO2)/kg_fuel] (double)"].as<string>(), "NOx [g(NO2)/kg_fuel] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["EI_CO"] = parseParamSweepInput(eiSubmenu["CO [g/kg_fuel] (double)"].as<string>(), "CO [g/kg_fuel] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["EI_UHC"] = parseParamSweepInput(eiSubmenu["UHC [g/kg_fuel] (double)"].as<string>(), "UHC [g/kg_fuel] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["EI_SO2"] = parseParamSweepInput(eiSubmenu["SO2 [g/kg_fuel] (double)"].as<string>(), "SO2 [g/kg_fuel] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["EI_SO2TOSO4"] =  parseParamSweepInput(eiSubmenu["SO2 to SO4 conv [%] (double)"].as<string>(), "SO2 to SO4 conv [%] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["EI_SOOT"] = parseParamSweepInput(eiSubmenu["Soot [g/kg_fuel] (double)"].as<string>(), "Soot [g/kg_fuel] (double)", monteCarlo, nRuns, seed);
         
-        input.PARAMETER_PARAM_MAP["EI_SOOTRAD"] = parseParamSweepInput(paramNode["Soot Radius [m] (double)"].as<string>(), "Soot Radius [m] (double)");
-        input.PARAMETER_PARAM_MAP["FF"] = parseParamSweepInput(paramNode["Total fuel flow [kg/s] (double)"].as<string>(), "Total fuel flow [kg/s] (double)");
-        input.PARAMETER_PARAM_MAP["AMASS"] = parseParamSweepInput(paramNode["Aircraft mass [kg] (double)"].as<string>(), "Aircraft mass [kg] (double)");
-        input.PARAMETER_PARAM_MAP["FSPEED"] = parseParamSweepInput(paramNode["Flight speed [m/s] (double)"].as<string>(), "Flight speed [m/s] (double)");
-        input.PARAMETER_PARAM_MAP["NUMENG"] = parseParamSweepInput(paramNode["Num. of engines [2/4] (int)"].as<string>(), " Num. of engines [2/4] (int)"); // Why is this a vector1d in the first place...
-        input.PARAMETER_PARAM_MAP["WINGSPAN"] = parseParamSweepInput(paramNode["Wingspan [m] (double)"].as<string>(), "Wingspan [m] (double)");
-        input.PARAMETER_PARAM_MAP["COREEXITTEMP"] = parseParamSweepInput(paramNode["Core exit temp. [K] (double)"].as<string>(), "Core exit temp. [K] (double)");
-        input.PARAMETER_PARAM_MAP["BYPASSAREA"] = parseParamSweepInput(paramNode["Exit bypass area [m^2] (double)"].as<string>(), "Exit bypass area [m^2] (double)");
+        input.PARAMETER_PARAM_MAP["EI_SOOTRAD"] = parseParamSweepInput(paramNode["Soot Radius [m] (double)"].as<string>(), "Soot Radius [m] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["FF"] = parseParamSweepInput(paramNode["Total fuel flow [kg/s] (double)"].as<string>(), "Total fuel flow [kg/s] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["AMASS"] = parseParamSweepInput(paramNode["Aircraft mass [kg] (double)"].as<string>(), "Aircraft mass [kg] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["FSPEED"] = parseParamSweepInput(paramNode["Flight speed [m/s] (double)"].as<string>(), "Flight speed [m/s] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["NUMENG"] = parseParamSweepInput(paramNode["Num. of engines [2/4] (int)"].as<string>(), " Num. of engines [2/4] (int)", monteCarlo, nRuns, seed); // Why is this a vector1d in the first place...
+        input.PARAMETER_PARAM_MAP["WINGSPAN"] = parseParamSweepInput(paramNode["Wingspan [m] (double)"].as<string>(), "Wingspan [m] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["COREEXITTEMP"] = parseParamSweepInput(paramNode["Core exit temp. [K] (double)"].as<string>(), "Core exit temp. [K] (double)", monteCarlo, nRuns, seed);
+        input.PARAMETER_PARAM_MAP["BYPASSAREA"] = parseParamSweepInput(paramNode["Exit bypass area [m^2] (double)"].as<string>(), "Exit bypass area [m^2] (double)", monteCarlo, nRuns, seed);
         
         //convert hPa to Pa because the solver uses Pa as the default unit
         for(double& i: input.PARAMETER_PARAM_MAP["PRESSURE"]){
@@ -181,6 +235,27 @@ namespace YamlInputReader{
         input.CHEMISTRY_HETCHEM = parseBoolString(chemNode["Perform hetero. chem. (T/F)"].as<string>(), "Perform hetero. chem. (T/F)");
         input.CHEMISTRY_TIMESTEP = parseDoubleString(chemNode["Chemistry Timestep [min] (double)"].as<string>(), "Chemistry Timestep [min] (double)");
         input.CHEMISTRY_JRATE_FOLDER = parseFileSystemPath(chemNode["Photolysis rates folder (string)"].as<string>());
+        //Optional: integrate cells with matching concentrations and rates once. 0 integrates every cell.
+        input.CHEMISTRY_CLUSTER_RTOL = 0.0;
+        if(chemNode["Cluster cells rel. tolerance [-] (double)"]) {
+            input.CHEMISTRY_CLUSTER_RTOL = parseDoubleString(chemNode["Cluster cells rel. tolerance [-] (double)"].as<string>(), "Cluster cells rel. tolerance [-] (double)");
+        }
+        if(input.CHEMISTRY_CLUSTER_RTOL < 0) {
+            throw std::invalid_argument("Cluster cells rel. tolerance must be nonnegative!");
+        }
+        //Optional: temperature resolution of the thermal rate constant cache. 0 computes exact rates.
+        input.CHEMISTRY_RCONST_DT = 0.0;
+        if(chemNode["Rate constant cache dT [K] (double)"]) {
+            input.CHEMISTRY_RCONST_DT = parseDoubleString(chemNode["Rate constant cache dT [K] (double)"].as<string>(), "Rate constant cache dT [K] (double)");
+        }
+        if(input.CHEMISTRY_RCONST_DT < 0) {
+            throw std::invalid_argument("Rate constant cache dT must be nonnegative!");
+        }
+        //Optional: integrate the cells of a row together, KPP_BATCH at a time. Off integrates one cell at a time.
+        input.CHEMISTRY_BATCH = false;
+        if(chemNode["Integrate cells in batches (T/F)"]) {
+            input.CHEMISTRY_BATCH = parseBoolString(chemNode["Integrate cells in batches (T/F)"].as<string>(), "Integrate cells in batches (T/F)");
+        }
     }
     void readAeroMenu(OptInput& input, const YAML::Node& aeroNode){
         input.AEROSOL_GRAVSETTLING = parseBoolString(aeroNode["Turn on grav. settling (T/F)"].as<string>(), "Turn on grav. settling (T/F)");
@@ -272,6 +347,73 @@ namespace YamlInputReader{
         input.TS_AERO_FILENAME = aeroTsSubmenu["Inst timeseries file (string)"].as<string>();
         input.TS_AEROSOL = parseVectorIntString(aeroTsSubmenu["Aerosol indices to include (list of ints)"].as<string>(), "Aerosol indices to include (list of ints)");
         input.TS_AERO_FREQ = parseDoubleString(aeroTsSubmenu["Save frequency [min] (double)"].as<string>(), "Save frequency [min] (double)");
+        //Optional: append every save to one file per case instead of writing one file per save.
+        input.TS_AERO_APPEND = false;
+        if(aeroTsSubmenu["Single file per case (T/F)"]) {
+            input.TS_AERO_APPEND = parseBoolString(aeroTsSubmenu["Single file per case (T/F)"].as<string>(), "Single file per case (T/F)");
+        }
+        //Optional: subset of variables to save, all of them by default.
+        input.TS_AERO_VARS.clear();
+        if(aeroTsSubmenu["Variables to save (list of strings)"]) {
+            const string varString = trim(aeroTsSubmenu["Variables to save (list of strings)"].as<string>());
+            if(varString != "all") {
+                for(const string& var: split(varString, " ")) {
+                    if(std::find(TS_AERO_VAR_NAMES.begin(), TS_AERO_VAR_NAMES.end(), var) == TS_AERO_VAR_NAMES.end()) {
+                        throw std::invalid_argument("Unknown aerosol timeseries variable " + var + " at parameter Variables to save (list of strings)");
+                    }
+                    input.TS_AERO_VARS.push_back(var);
+                }
+            }
+        }
+        //Optional: netCDF deflate level, 0 turns compression off.
+        input.TS_AERO_DEFLATE = 0;
+        if(aeroTsSubmenu["Deflate level (int 0-9)"]) {
+            input.TS_AERO_DEFLATE = parseIntString(aeroTsSubmenu["Deflate level (int 0-9)"].as<string>(), "Deflate level (int 0-9)");
+            if(input.TS_AERO_DEFLATE < 0 || input.TS_AERO_DEFLATE > 9) {
+                throw std::invalid_argument("Deflate level (int 0-9) must be between 0 and 9!");
+            }
+        }
+        //Optional: significant digits kept per variable, e.g. "H2O:4 IWC:3" or "all:3". Full precision by default.
+        input.TS_AERO_SIGDIGITS.clear();
+        if(aeroTsSubmenu["Significant digits (list of name:digits)"]) {
+            const string paramLocation = "Significant digits (list of name:digits)";
+            const string digitString = trim(aeroTsSubmenu[paramLocation].as<string>());
+            if(digitString != "none") {
+                for(const string& token: split(digitString, " ")) {
+                    const vector<string> nameDigits = split(token, ":");
+                    if(nameDigits.size() != 2) {
+                        throw std::invalid_argument("Expected name:digits, got " + token + " at parameter " + paramLocation);
+                    }
+                    const string& var = nameDigits[0];
+                    if(var != "all" && std::find(TS_AERO_VAR_NAMES.begin(), TS_AERO_VAR_NAMES.end(), var) == TS_AERO_VAR_NAMES.end()) {
+                        throw std::invalid_argument("Unknown aerosol timeseries variable " + var + " at parameter " + paramLocation);
+                    }
+                    const int digits = parseIntString(nameDigits[1], paramLocation);
+                    if(digits < 1 || digits > 7) {
+                        throw std::invalid_argument("Significant digits must be between 1 and 7 at parameter " + paramLocation);
+                    }
+                    input.TS_AERO_SIGDIGITS[var] = digits;
+                }
+            }
+        }
+        //Optional: resample the saved fields onto a fixed analysis grid, defined like the model domain. Off by default.
+        input.TS_AERO_RESAMPLE = false;
+        if(aeroTsSubmenu["Resample to analysis grid (T/F)"]) {
+            input.TS_AERO_RESAMPLE = parseBoolString(aeroTsSubmenu["Resample to analysis grid (T/F)"].as<string>(), "Resample to analysis grid (T/F)");
+        }
+        if(input.TS_AERO_RESAMPLE) {
+            input.TS_AERO_GRID_NX = parseIntString(aeroTsSubmenu["Analysis grid NX (positive int)"].as<string>(), "Analysis grid NX (positive int)");
+            input.TS_AERO_GRID_NY = parseIntString(aeroTsSubmenu["Analysis grid NY (positive int)"].as<string>(), "Analysis grid NY (positive int)");
+            input.TS_AERO_GRID_XLIM_RIGHT = parseDoubleString(aeroTsSubmenu["Analysis grid XLIM_RIGHT (positive double)"].as<string>(), "Analysis grid XLIM_RIGHT (positive double)");
+            input.TS_AERO_GRID_XLIM_LEFT = parseDoubleString(aeroTsSubmenu["Analysis grid XLIM_LEFT (positive double)"].as<string>(), "Analysis grid XLIM_LEFT (positive double)");
+            input.TS_AERO_GRID_YLIM_UP = parseDoubleString(aeroTsSubmenu["Analysis grid YLIM_UP (positive double)"].as<string>(), "Analysis grid YLIM_UP (positive double)");
+            input.TS_AERO_GRID_YLIM_DOWN = parseDoubleString(aeroTsSubmenu["Analysis grid YLIM_DOWN (positive double)"].as<string>(), "Analysis grid YLIM_DOWN (positive double)");
+            if(input.TS_AERO_GRID_NX <= 0 || input.TS_AERO_GRID_NY <= 0 ||
+               input.TS_AERO_GRID_XLIM_RIGHT + input.TS_AERO_GRID_XLIM_LEFT <= 0 ||
+               input.TS_AERO_GRID_YLIM_UP + input.TS_AERO_GRID_YLIM_DOWN <= 0) {
+                throw std::invalid_argument("The analysis grid must have a positive number of cells and a positive extent along x and y!");
+            }
+        }
 
         YAML::Node plSubmenu = diagNode["PRODUCTION & LOSS SUBMENU"];
         input.PL_PL = parseBoolString(plSubmenu["Turn on P/L diag (T/F)"].as<string>(), "Turn on P/L diag (T/F)");
@@ -286,6 +428,15 @@ namespace YamlInputReader{
         input.ADV_GRID_XLIM_LEFT = parseDoubleString(gridSubmenu["XLIM_LEFT (positive double)"].as<string>(), "XLIM_LEFT (positive double)");
         input.ADV_GRID_YLIM_UP = parseDoubleString(gridSubmenu["YLIM_UP (positive double)"].as<string>(), "YLIM_UP (positive double)");
         input.ADV_GRID_YLIM_DOWN = parseDoubleString(gridSubmenu["YLIM_DOWN (positive double)"].as<string>(), "YLIM_DOWN (positive double)");
+        //Optional: LAGRID buffers made of blocks that coarsen in x away from the contrail. 0 levels keeps a uniform grid.
+        input.ADV_GRID_COARSEN_LEVELS = 0;
+        input.ADV_GRID_COARSEN_BLOCKSIZE = 8;
+        if(gridSubmenu["Buffer Coarsening Levels (nonnegative int)"]) {
+            input.ADV_GRID_COARSEN_LEVELS = parseIntString(gridSubmenu["Buffer Coarsening Levels (nonnegative int)"].as<string>(), "Buffer Coarsening Levels (nonnegative int)");
+        }
+        if(gridSubmenu["Cells per Coarsening Block (positive int)"]) {
+            input.ADV_GRID_COARSEN_BLOCKSIZE = parseIntString(gridSubmenu["Cells per Coarsening Block (positive int)"].as<string>(), "Cells per Coarsening Block (positive int)");
+        }
         
         YAML::Node csizeSubmenu = advancedNode["INITIAL CONTRAIL SIZE SUBMENU"];
         input.ADV_CSIZE_DEPTH_BASE = parseDoubleString(csizeSubmenu["Base Contrail Depth [m] (double)"].as<string>(), "Base Contrail Depth [m] (double)");
@@ -295,6 +446,31 @@ namespace YamlInputReader{
 
         input.ADV_AMBIENT_LAPSERATE = parseDoubleString(advancedNode["Ambient Lapse Rate [K/km] (double)"].as<string>(), "Ambient Lapse Rate [K/km] (double)");
         input.ADV_TROPOPAUSE_PRESSURE = parseDoubleString(advancedNode["Tropopause Pressure [Pa] (double)"].as<string>(), "Tropopause Pressure [Pa] (double)");
+        //Optional: stiff (implicit) solver for the EPM microphysics ODEs
+        input.ADV_EPM_INTEGRATOR = "rkf78";
+        if(advancedNode["EPM ODE integrator (rkf78/rosenbrock4)"]) {
+            input.ADV_EPM_INTEGRATOR = advancedNode["EPM ODE integrator (rkf78/rosenbrock4)"].as<string>();
+        }
+        if(input.ADV_EPM_INTEGRATOR != "rkf78" && input.ADV_EPM_INTEGRATOR != "rosenbrock4") {
+            throw std::invalid_argument("EPM ODE integrator must be one of rkf78 or rosenbrock4!");
+        }
+        //Optional: pretabulated EPM results. An empty file name turns the table off.
+        input.ADV_EPM_TABLE_BUILD = false;
+        input.ADV_EPM_TABLE_FILE = "";
+        input.ADV_EPM_TABLE_MAXERR = 0.05;
+        if(advancedNode["EPM RESPONSE SURFACE SUBMENU"]) {
+            YAML::Node epmTableSubmenu = advancedNode["EPM RESPONSE SURFACE SUBMENU"];
+            input.ADV_EPM_TABLE_BUILD = parseBoolString(epmTableSubmenu["Build EPM table (T/F)"].as<string>(), "Build EPM table (T/F)");
+            string tableFile = epmTableSubmenu["EPM table file (string)"].as<string>();
+            input.ADV_EPM_TABLE_FILE = tableFile.empty() ? tableFile : parseFileSystemPath(tableFile);
+            input.ADV_EPM_TABLE_MAXERR = parseDoubleString(epmTableSubmenu["Max. interp. rel. error [-] (double)"].as<string>(), "Max. interp. rel. error [-] (double)");
+        }
+        if(input.ADV_EPM_TABLE_BUILD && input.ADV_EPM_TABLE_FILE.empty()) {
+            throw std::invalid_argument("Building an EPM table requires an EPM table file!");
+        }
+        if(input.ADV_EPM_TABLE_MAXERR < 0) {
+            throw std::invalid_argument("Max. interp. rel. error must be nonnegative!");
+        }
 
         if(input.ADV_GRID_NX < 0 ||
            input.ADV_GRID_NY < 0 ||
@@ -305,6 +481,9 @@ namespace YamlInputReader{
             
             throw std::invalid_argument("No values in GRID SUBMENU can be less than zero!");
         }
+        if(input.ADV_GRID_COARSEN_LEVELS < 0 || input.ADV_GRID_COARSEN_BLOCKSIZE <= 0) {
+            throw std::invalid_argument("Buffer Coarsening Levels must be nonnegative and Cells per Coarsening Block positive!");
+        }
     }
 
     vector<std::unordered_map<string, double>> generateCasesHelper(vector<std::unordered_map<string, double>>& allCases, const vector<std::pair<string, Vector_1D>>& params, const int row){
@@ -338,6 +517,17 @@ namespace YamlInputReader{
 
     vector<std::unordered_map<string, double>> generateCases(const OptInput& input){
 
+        //Monte Carlo run i takes the i-th sample of every parameter
+        if(input.SIMULATION_MONTECARLO){
+            vector<std::unordered_map<string, double>> allCases(input.SIMULATION_MCRUNS);
+            for (const auto& p: input.PARAMETER_PARAM_MAP){
+                for (int i = 0; i < input.SIMULATION_MCRUNS; i++){
+                    allCases[i][p.first] = p.second[i];
+                }
+            }
+            return allCases;
+        }
+
         //Convert parameter map to vector, each row of the vector represents one parameter
         vector<std::pair<string, Vector_1D>> params;
         for (const auto& p: input.PARAMETER_PARAM_MAP){
@@ -347,19 +537,25 @@ namespace YamlInputReader{
         return generateCasesHelper(allCases, params, 0);
     }
 
-    Vector_1D parseParamSweepInput(const string paramString, const string paramLocation, bool monteCarlo, int nRuns){
+    Vector_1D parseParamSweepInput(const string paramString, const string paramLocation, bool monteCarlo, int nRuns, std::uint64_t seed){
         const string s = trim(paramString);
         const vector<string> colon_split_tokens = split(s, ":");
         if(monteCarlo){
-            if(colon_split_tokens.size() != 0 && colon_split_tokens.size() != 2){
+            if(colon_split_tokens.size() != 1 && colon_split_tokens.size() != 2){
                 throw std::invalid_argument("Monte Carlo Simulation requires parameter input format of min:max or a singular (constant) value at " + paramLocation + "!");
             }
-            setSeed();
+            //A constant takes the same value in every run
+            if(colon_split_tokens.size() == 1){
+                return Vector_1D(nRuns, parseDoubleString(colon_split_tokens[0], paramLocation));
+            }
+            //Each parameter draws its own stream, so samples don't depend on the order parameters are read in
+            const RandKey key = randKey(seed);
+            const std::uint32_t stream = randStream(paramLocation);
             Vector_1D paramVector;
             const double min = parseDoubleString(colon_split_tokens[0], "");
             const double max = parseDoubleString(colon_split_tokens[1], "");
             for(int i = 0; i < nRuns; i++){
-                paramVector.push_back(fRand(min, max));
+                paramVector.push_back(fRand(min, max, key, { (std::uint32_t) i, stream, 0, 0 }));
             }
             return paramVector;
         }
@@ -1,6 +1,10 @@
 #include "LAGRID/RemappingFunctions.hpp"
+#include "LAGRID/RemapOperator.hpp"
+#include "LAGRID/FixedGridResampler.hpp"
+#include "LAGRID/PaddedGrid.hpp"
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <cmath>
 #include <iostream>
 TEST_CASE("FreeCoordBoxGrid and Remapping") {
     Vector_1D dy = {1, 2, 3, 4};
@@ -108,4 +112,321 @@ TEST_CASE("FreeCoordBoxGrid and Remapping") {
         }
         REQUIRE(std::abs(mass_before - mass) < 1e-12);
     }
-}
\ No newline at end of file
+
+    SECTION("Adding Buffer within the reserved halo") {
+        auto padded = LAGRID::mapToStructuredGrid(testgrid, testremap, 6, 10, 4, 8);
+        REQUIRE(padded.phi.haloLeft() == 3);
+        REQUIRE(padded.phi.haloRight() == 5);
+        REQUIRE(padded.phi.haloTop() == 2);
+        REQUIRE(padded.phi.haloBot() == 4);
+        const double* origin = &padded.phi(0, 0);
+        padded.addBuffer(6, 10, 4, 8);
+        //The old cells have not moved, the buffer came out of the halo
+        REQUIRE(&padded.phi(4, 3) == origin);
+        REQUIRE(padded.phi.haloLeft() == 0);
+        REQUIRE(padded.phi.haloRight() == 0);
+        REQUIRE(padded.phi.haloTop() == 0);
+        REQUIRE(padded.phi.haloBot() == 0);
+
+        twoDGrid.addBuffer(6, 10, 4, 8);
+        REQUIRE(padded.phi.toVector2D() == twoDGrid.phi.toVector2D());
+        REQUIRE(padded.xCoords == twoDGrid.xCoords);
+        REQUIRE(padded.yCoords == twoDGrid.yCoords);
+    }
+}
+
+TEST_CASE("Padded grid") {
+    Vector_2D phi = {
+        {1, 2, 3},
+        {4, 5, 6}
+    };
+    LAGRID::PaddedGrid grid(phi, 2);
+    REQUIRE(grid.ny() == 2);
+    REQUIRE(grid.nx() == 3);
+    REQUIRE(grid[1][2] == 6);
+
+    SECTION("Extending within the halo") {
+        grid.extend(1, 2, 1, 2);
+        REQUIRE(grid.nx() == 6);
+        REQUIRE(grid.ny() == 5);
+        REQUIRE(grid.haloLeft() == 1);
+        REQUIRE(grid.haloRight() == 0);
+        REQUIRE(grid.haloTop() == 1);
+        REQUIRE(grid.haloBot() == 0);
+        REQUIRE(grid(2, 1) == 1);
+        REQUIRE(grid(3, 3) == 6);
+        double sum = 0;
+        for (int j = 0; j < grid.size(); j++) {
+            for (int i = 0; i < grid[0].size(); i++) {
+                sum += grid[j][i];
+            }
+        }
+        REQUIRE(sum == 21);
+    }
+
+    SECTION("Growing past the halo") {
+        grid(0, 0) = 10;
+        grid.extend(5, 0, 0, 3);
+        REQUIRE(grid.haloLeft() >= 5);
+        REQUIRE(grid.haloBot() >= 3);
+        REQUIRE(grid.haloRight() == 2);
+        Vector_2D expanded = grid.toVector2D();
+        REQUIRE(expanded.size() == 5);
+        REQUIRE(expanded[0].size() == 8);
+        REQUIRE(expanded[3][5] == 10);
+        REQUIRE(expanded[4][7] == 6);
+        REQUIRE(expanded[2][5] == 0);
+
+        //Spare capacity left by the geometric growth is used before reallocating again
+        int haloLeft = grid.haloLeft();
+        grid.extend(haloLeft, 0, 0, 0);
+        REQUIRE(grid.haloLeft() == 0);
+        REQUIRE(grid(3, 5 + haloLeft) == 10);
+    }
+
+    SECTION("Reset and copied out") {
+        grid.extend(1, 0, 0, 0);
+        grid.reset(3, 2);
+        REQUIRE(grid.ny() == 3);
+        REQUIRE(grid.nx() == 2);
+        REQUIRE(grid.toVector2D() == Vector_2D(3, Vector_1D(2, 0)));
+        //Storage left over from the larger grid is all halo, so it must be zero too
+        grid(2, 1) = 7;
+        grid.extend(0, 1, 1, 0);
+        REQUIRE(grid.toVector2D() == Vector_2D({ {0, 0, 0}, {0, 0, 0}, {0, 7, 0}, {0, 0, 0} }));
+
+        Vector_2D copy = { {9, 9, 9, 9, 9} };
+        grid.copyTo(copy);
+        REQUIRE(copy == grid.toVector2D());
+    }
+}
+
+TEST_CASE("Remap operator") {
+    Vector_2D phi = {
+        {0, 0, 2, 0, 0},
+        {0, 1, 2, 1, 0},
+        {0, 1, 3, 1, 0},
+        {0, 0, 1, 0, 0}
+    };
+    Vector_2D phi2 = {
+        {0, 0, 5, 0, 0},
+        {0, 4, 2, 1, 0},
+        {0, 1, 7, 1, 0},
+        {0, 0, 1, 0, 0}
+    };
+    std::vector<std::vector<int>> mask = {
+        {0, 0, 1, 0, 0},
+        {0, 1, 1, 1, 0},
+        {0, 1, 1, 1, 0},
+        {0, 0, 1, 0, 0}
+    };
+    double dy_old = 2;
+    double dx_old = 3;
+    Vector_1D dy_new = {2, 2.2, 2.4, 2.6};
+    LAGRID::Remapping remapping(-12, -1, 2, 2, 14, 7);
+
+    auto remapOp = LAGRID::buildRemapOperator(dy_old, dy_new, dx_old, -7.5, 0, mask, remapping);
+    remapOp.addBuffer(6, 10, 4, 8);
+
+    SECTION("Matches box grid remapping") {
+        for(auto& field: {phi, phi2}) {
+            auto boxGrid = LAGRID::rectToBoxGrid(dy_old, dy_new, dx_old, -7.5, 0, field, mask);
+            auto reference = LAGRID::mapToStructuredGrid(boxGrid, remapping);
+            reference.addBuffer(6, 10, 4, 8);
+
+            Vector_2D remapped = remapOp.apply(field);
+            REQUIRE(remapped.size() == reference.phi.size());
+            REQUIRE(remapped[0].size() == reference.phi[0].size());
+            for (int j = 0; j < remapped.size(); j++) {
+                REQUIRE(remapOp.yCoords()[j] == Catch::Approx(reference.yCoords[j]));
+                for (int i = 0; i < remapped[0].size(); i++) {
+                    REQUIRE(remapped[j][i] == Catch::Approx(reference.phi[j][i]).margin(1e-12));
+                }
+            }
+            for (int i = 0; i < remapped[0].size(); i++) {
+                REQUIRE(remapOp.xCoords()[i] == Catch::Approx(reference.xCoords[i]));
+            }
+        }
+    }
+
+    SECTION("Through a reused padded grid") {
+        //Left over from a larger grid
+        LAGRID::PaddedGrid phi_new(40, 40, 3);
+        phi_new(5, 5) = 100;
+        for(auto& field: {phi, phi2, phi}) {
+            remapOp.apply(field, phi_new);
+            REQUIRE(phi_new.ny() == remapOp.ny());
+            REQUIRE(phi_new.nx() == remapOp.nx());
+            REQUIRE(phi_new.toVector2D() == remapOp.apply(field));
+        }
+    }
+
+    SECTION("Multiple fields in place") {
+        Vector_2D a = phi;
+        Vector_2D b = phi2;
+        remapOp.applyInPlace({&a, &b});
+        double mass_a = 0;
+        double mass_b = 0;
+        for (int j = 0; j < a.size(); j++) {
+            for (int i = 0; i < a[0].size(); i++) {
+                mass_a += a[j][i] * remapOp.dx() * remapOp.dy();
+                mass_b += b[j][i] * remapOp.dx() * remapOp.dy();
+            }
+        }
+        REQUIRE(mass_a == Catch::Approx(VectorUtils::Vec2DSum(phi) * dx_old * dy_old));
+        REQUIRE(mass_b == Catch::Approx(VectorUtils::Vec2DSum(phi2) * dx_old * dy_old));
+    }
+}
+
+TEST_CASE("Coarsened buffers") {
+    Vector_2D phi = {
+        {0, 0, 2, 0, 0},
+        {0, 1, 2, 1, 0},
+        {0, 1, 3, 1, 0},
+        {0, 0, 1, 0, 0}
+    };
+    std::vector<std::vector<int>> mask = {
+        {0, 0, 1, 0, 0},
+        {1, 1, 1, 1, 0},
+        {0, 1, 1, 1, 1},
+        {0, 0, 1, 0, 0}
+    };
+    double dy_old = 2;
+    Vector_1D dy_new = {2, 2.2, 2.4, 2.6};
+    LAGRID::Remapping remapping(-15, -1, 2, 2, 16, 7);
+
+    SECTION("Buffer widths") {
+        Vector_1D widths = LAGRID::coarsenedBufferWidths(105, 5, 2, 2);
+        Vector_1D expected = {5, 5, 10, 10, 20, 20, 20, 20};
+        REQUIRE(widths == expected);
+
+        Vector_1D uniform = LAGRID::coarsenedBufferWidths(100, 5, 2, 0);
+        REQUIRE(uniform.size() == 20);
+        REQUIRE(LAGRID::coarsenedBufferWidths(0, 5, 2, 2).empty());
+        REQUIRE_THROWS(LAGRID::coarsenedBufferWidths(100, 5, 0, 2));
+    }
+
+    SECTION("Uniform edges match uniform spacing") {
+        Vector_1D xEdges = {-7.5, -4.5, -1.5, 1.5, 4.5, 7.5};
+        auto reference = LAGRID::rectToBoxGrid(dy_old, dy_new, 3, -7.5, 0, phi, mask);
+        auto boxGrid = LAGRID::rectToBoxGrid(dy_old, dy_new, xEdges, 0, phi, mask);
+        REQUIRE(boxGrid.boxes.size() == reference.boxes.size());
+        REQUIRE(boxGrid.boundaryBoxIndices == reference.boundaryBoxIndices);
+        for (int n = 0; n < boxGrid.boxes.size(); n++) {
+            REQUIRE(boxGrid.boxes[n].topLeftX == Catch::Approx(reference.boxes[n].topLeftX));
+            REQUIRE(boxGrid.boxes[n].botRightX == Catch::Approx(reference.boxes[n].botRightX));
+            REQUIRE(boxGrid.boxes[n].botRightY == Catch::Approx(reference.boxes[n].botRightY));
+            REQUIRE(boxGrid.boxes[n].mass == Catch::Approx(reference.boxes[n].mass));
+        }
+    }
+
+    SECTION("Conservative remap from and onto non-uniform grids") {
+        //Outer columns are twice as wide, as if they were part of a coarse buffer block
+        Vector_1D xEdges_old = {-10.5, -4.5, -1.5, 1.5, 4.5, 10.5};
+        Vector_1D dx_old = VectorUtils::cellWidths(xEdges_old);
+        double mass_before = 0;
+        for (int j = 0; j < phi.size(); j++) {
+            for (int i = 0; i < phi[0].size(); i++) {
+                mass_before += mask[j][i] * phi[j][i] * dx_old[i] * dy_old;
+            }
+        }
+
+        auto uniformOp = LAGRID::buildRemapOperator(dy_old, dy_new, xEdges_old, 0, mask, remapping);
+        auto coarseOp = LAGRID::buildRemapOperator(dy_old, dy_new, xEdges_old, 0, mask, remapping);
+        uniformOp.addBuffer(12, 20, 4, 8);
+        coarseOp.addBuffer(12, 20, 4, 8, 2, 2);
+
+        //Buffer block widths: 2, 2, 4, 4, 8... away from the fine block
+        const Vector_1D& xEdges = coarseOp.xEdges();
+        REQUIRE(xEdges.size() == coarseOp.nx() + 1);
+        Vector_1D widths = VectorUtils::cellWidths(xEdges);
+        Vector_1D leftBuffer = LAGRID::coarsenedBufferWidths(12, 2, 2, 2);
+        Vector_1D rightBuffer = LAGRID::coarsenedBufferWidths(20, 2, 2, 2);
+        REQUIRE(widths.size() == leftBuffer.size() + remapping.nx + rightBuffer.size());
+        REQUIRE(widths.front() == Catch::Approx(leftBuffer.back()));
+        REQUIRE(widths.back() == Catch::Approx(rightBuffer.back()));
+        REQUIRE(coarseOp.nx() < uniformOp.nx());
+        for (int i = 0; i < coarseOp.nx(); i++) {
+            REQUIRE(widths[i] > 0);
+            REQUIRE(coarseOp.xCoords()[i] == Catch::Approx(0.5 * (xEdges[i] + xEdges[i + 1])));
+        }
+        REQUIRE(xEdges[leftBuffer.size()] == Catch::Approx(remapping.x0));
+
+        Vector_2D uniformPhi = uniformOp.apply(phi);
+        Vector_2D coarsePhi = coarseOp.apply(phi);
+        REQUIRE(coarsePhi.size() == uniformPhi.size());
+        int shift = std::floor(12 / remapping.dx) - leftBuffer.size();
+        double mass_after = 0;
+        for (int j = 0; j < coarsePhi.size(); j++) {
+            for (int i = 0; i < coarsePhi[0].size(); i++) {
+                mass_after += coarsePhi[j][i] * widths[i] * coarseOp.dy();
+                //Mass only lands in the fine block, which is the same on both grids
+                if (coarsePhi[j][i] != 0) {
+                    REQUIRE(coarsePhi[j][i] == Catch::Approx(uniformPhi[j][i + shift]));
+                }
+            }
+        }
+        REQUIRE(mass_after == Catch::Approx(mass_before));
+    }
+}
+
+TEST_CASE("Fixed grid resampling") {
+    //Model grid: non-uniform in x, uniform in y, covering [-6, 6] x [0, 8]
+    Vector_1D xEdges = {-6, -2, 0, 1, 2, 6};
+    Vector_1D yEdges = {0, 2, 4, 6, 8};
+    Vector_2D phi(4, Vector_1D(5));
+    for (int j = 0; j < 4; j++) {
+        for (int i = 0; i < 5; i++) {
+            phi[j][i] = 1 + i + 10 * j;
+        }
+    }
+    //Analysis grid is coarser and sticks out of the model grid on the right and at the top
+    LAGRID::Remapping grid(-6, 0, 4, 4, 4, 3);
+    LAGRID::FixedGridResampler resampler(grid, xEdges, yEdges);
+
+    SECTION("Conserves the covered mass") {
+        Vector_2D resampled = resampler.apply(phi);
+        REQUIRE(resampled.size() == 3);
+        REQUIRE(resampled[0].size() == 4);
+        REQUIRE(resampler.xCoords()[0] == Catch::Approx(-4));
+        REQUIRE(resampler.yCoords()[2] == Catch::Approx(10));
+
+        double mass_before = 0;
+        for (int j = 0; j < 4; j++) {
+            for (int i = 0; i < 5; i++) {
+                mass_before += phi[j][i] * (xEdges[i + 1] - xEdges[i]) * (yEdges[j + 1] - yEdges[j]);
+            }
+        }
+        double mass_after = 0;
+        for (int j = 0; j < 2; j++) {
+            for (int i = 0; i < 3; i++) {
+                mass_after += resampled[j][i] * grid.dx * grid.dy;
+            }
+        }
+        REQUIRE(mass_after == Catch::Approx(mass_before));
+        //Cell [-6, -2] x [0, 4] is exactly the first model column, rows 0 and 1
+        REQUIRE(resampled[0][0] == Catch::Approx(0.5 * (1 + 11)));
+        //Cell [-2, 2] x [0, 4] averages three model columns of widths 2, 1 and 1
+        REQUIRE(resampled[0][1] == Catch::Approx((2 * 2 + 3 + 4) / 4.0 + 5));
+        //Nothing of the model grid reaches x > 6 or y > 8
+        REQUIRE(std::isnan(resampled[0][3]));
+        REQUIRE(std::isnan(resampled[2][0]));
+    }
+
+    SECTION("Profiles along one axis") {
+        Vector_1D xProfile = {1, 2, 3, 4, 5};
+        Vector_1D resampledX = resampler.applyX(xProfile);
+        REQUIRE(resampledX.size() == 4);
+        REQUIRE(resampledX[0] == Catch::Approx(1));
+        REQUIRE(resampledX[1] == Catch::Approx((2 * 2 + 3 + 4) / 4.0));
+        REQUIRE(resampledX[2] == Catch::Approx(5));
+        REQUIRE(std::isnan(resampledX[3]));
+
+        Vector_1D yProfile = {1, 2, 3, 4};
+        Vector_1D resampledY = resampler.applyY(yProfile);
+        REQUIRE(resampledY.size() == 3);
+        REQUIRE(resampledY[0] == Catch::Approx(1.5));
+        REQUIRE(resampledY[1] == Catch::Approx(3.5));
+        REQUIRE(std::isnan(resampledY[2]));
+    }
+}
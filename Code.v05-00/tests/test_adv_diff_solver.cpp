@@ -419,4 +419,99 @@ namespace FVM_ANDS{
         REQUIRE(std::abs(maxy-0.381) < 0.01);
 
     }
+    TEST_CASE("Non-uniform x spacing"){
+        //Fine center block with columns twice and four times as wide towards the sides
+        Vector_1D dxCells;
+        for(int i = 0; i < 4; i++) dxCells.push_back(0.04);
+        for(int i = 0; i < 4; i++) dxCells.push_back(0.02);
+        for(int i = 0; i < 30; i++) dxCells.push_back(0.01);
+        for(int i = 0; i < 4; i++) dxCells.push_back(0.02);
+        for(int i = 0; i < 4; i++) dxCells.push_back(0.04);
+        int nx = dxCells.size(), ny = 50;
+        double dy = 1.0/ny;
+        Vector_1D xCoords(nx), yCoords(ny);
+        double x = 0;
+        for(int i = 0; i < nx; i++){
+            xCoords[i] = x + 0.5 * dxCells[i];
+            x += dxCells[i];
+        }
+        for(int j = 0; j < ny; j++) yCoords[j] = dy * (0.5 + j);
+
+        Eigen::VectorXd init(nx * ny + 2*nx + 2*ny);
+        init.setZero();
+        for(int i = 0; i < nx; i++){
+            for(int j = 0; j < ny; j++){
+                double r2 = (xCoords[i] - 0.3) * (xCoords[i] - 0.3) + (yCoords[j] - 0.5) * (yCoords[j] - 0.5);
+                init[i*ny + j] = std::exp(-r2 / 0.005);
+            }
+        }
+        BoundaryConditions bc;
+        bc.bcType_top = BoundaryConditionFlag::DIRICHLET_INT_BPOINT;
+        bc.bcType_left = BoundaryConditionFlag::DIRICHLET_INT_BPOINT;
+        bc.bcType_right = BoundaryConditionFlag::DIRICHLET_INT_BPOINT;
+        bc.bcType_bot = BoundaryConditionFlag::DIRICHLET_INT_BPOINT;
+        bc.bcVals_top = Vector_1D(nx, 0);
+        bc.bcVals_bot = Vector_1D(nx, 0);
+        bc.bcVals_left = Vector_1D(ny, 0);
+        bc.bcVals_right = Vector_1D(ny, 0);
+
+        auto totalMass = [&](const Eigen::VectorXd& phi){
+            double mass = 0;
+            for(int i = 0; i < nx; i++){
+                for(int j = 0; j < ny; j++){
+                    mass += phi[i*ny + j] * dxCells[i] * dy;
+                }
+            }
+            return mass;
+        };
+        double mass_init = totalMass(init);
+
+        SECTION("Uniform widths reproduce the default solver"){
+            Vector_1D xUniform(nx);
+            for(int i = 0; i < nx; i++) xUniform[i] = (0.5 + i) / nx;
+            AdvDiffParams params(0.1, 0, 0, 0.01, 0.01, 0.05);
+            FVM_Solver reference(params, xUniform, yCoords, bc, init);
+            FVM_Solver solver(params, xUniform, yCoords, bc, init);
+            solver.updateCellWidthsX(Vector_1D(nx, 1.0 / nx));
+            Eigen::VectorXd expected = reference.solve();
+            Eigen::VectorXd soln = solver.solve();
+            for(int n = 0; n < nx * ny; n++){
+                REQUIRE(soln[n] == Catch::Approx(expected[n]).margin(1e-12));
+            }
+        }
+        SECTION("Explicit advection conserves mass across block interfaces"){
+            AdvDiffParams params(0.5, 0, 0, 0, 0, 0.004);
+            FVM_Solver solver(params, xCoords, yCoords, bc, init);
+            solver.updateCellWidthsX(dxCells);
+            Eigen::VectorXd soln;
+            for(int n = 0; n < 100; n++){
+                soln = solver.explicitSolve();
+            }
+            REQUIRE(totalMass(soln) == Catch::Approx(mass_init).epsilon(1e-3));
+            REQUIRE(soln(Eigen::seq(0, nx*ny - 1)).minCoeff() >= 0.0);
+        }
+        SECTION("Implicit westward advection conserves mass across block interfaces"){
+            //Cells are both narrower and wider than dy, so the east face must be scaled by the cell width.
+            //u = u0 - shear * y is westward above y = 0.1
+            AdvDiffParams params(0.1, 0, 1.0, 0, 0, 0.01);
+            FVM_Solver solver(params, xCoords, yCoords, bc, init, false, 1000, 1e-10);
+            solver.updateCellWidthsX(dxCells);
+            Eigen::VectorXd soln;
+            for(int n = 0; n < 5; n++){
+                soln = solver.solve();
+            }
+            REQUIRE(totalMass(soln) == Catch::Approx(mass_init).epsilon(1e-3));
+        }
+        SECTION("Implicit diffusion conserves mass across block interfaces"){
+            AdvDiffParams params(0, 0, 0, 0.002, 0.002, 0.1);
+            FVM_Solver solver(params, xCoords, yCoords, bc, init, false, 1000, 1e-10);
+            solver.updateCellWidthsX(dxCells);
+            Eigen::VectorXd soln;
+            for(int n = 0; n < 5; n++){
+                soln = solver.solve();
+            }
+            REQUIRE(totalMass(soln) == Catch::Approx(mass_init).epsilon(1e-3));
+            REQUIRE(soln.maxCoeff() < 1.0);
+        }
+    }
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "AIM/Aerosol.hpp"
+#include "AIM/KernelCache.hpp"
 #include "Util/ForwardDecl.hpp"
 #include "Util/PhysConstant.hpp"
 #include <catch2/catch_test_macros.hpp>
@@ -236,4 +237,116 @@ TEST_CASE ("Aerosol", "[single-file]" ) {
         REQUIRE(result[low_idx] < 10.0);
     }
 
-}
\ No newline at end of file
+}
+TEST_CASE("Grid aerosol coagulation", "[single-file]") {
+    const int nBins = 20;
+    const double r_min = 1.0e-7;
+    const double r_max = 1.0e-4;
+    const double ratio = r_max/r_min;
+    Vector_1D bin_edges(nBins + 1);
+    Vector_1D bin_centers(nBins);
+    for (int i = 0; i <= nBins; i++) {
+        bin_edges[i] = r_min * pow(ratio, double(i)/nBins);
+    }
+    for (int i = 0; i < nBins; i++) {
+        bin_centers[i] = 0.5 * (bin_edges[i] + bin_edges[i+1]);
+    }
+
+    SECTION("Sparse map matches dense f") {
+        Vector_1D vCenters(nBins);
+        for (int i = 0; i < nBins; i++) {
+            vCenters[i] = 4.0/3.0 * physConst::PI * pow(bin_centers[i], 3);
+        }
+        Vector_2D kernel(nBins, Vector_1D(nBins, 1.0e-8));
+        Coagulation dense("ice", kernel, bin_centers, vCenters);
+        CoagulationMap sparse;
+        sparse.build(vCenters);
+        for (int i = 0; i < nBins; i++) {
+            for (int j = 0; j < nBins; j++) {
+                for (int k = 0; k < nBins; k++) {
+                    REQUIRE(sparse.f(i, j, k) == Catch::Approx(dense.f[i][j][k]).margin(1e-14));
+                }
+            }
+        }
+    }
+
+    SECTION("Cell-parallel coagulation") {
+        const int nx = 6;
+        const int ny = 4;
+        Grid_Aerosol aerosol(nx, ny, bin_centers, bin_edges, 1.0e3, 5.0e-6, 1.6);
+        Vector_2D T(ny, Vector_1D(nx, 215.0));
+        Vector_1D P(ny, 25000.0);
+        for (int j = 0; j < ny; j++) {
+            P[j] = 25000.0 + 100.0 * j;
+        }
+
+        Vector_2D vol0 = aerosol.TotalVolume();
+        Vector_2D num0 = aerosol.TotalNumber();
+        aerosol.Coagulate(600.0, T, P, "ice", physConst::RHO_ICE);
+        Vector_2D vol1 = aerosol.TotalVolume();
+        Vector_2D num1 = aerosol.TotalNumber();
+
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                //Coagulation conserves volume and only removes particles
+                REQUIRE(vol1[j][i] == Catch::Approx(vol0[j][i]).epsilon(1e-10));
+                REQUIRE(num1[j][i] < num0[j][i]);
+                //Cells in the same row see the same conditions
+                REQUIRE(num1[j][i] == Catch::Approx(num1[j][0]).epsilon(1e-12));
+            }
+        }
+    }
+
+    SECTION("Cached kernels against a kernel built for the cell") {
+        //Between nodes in T and ln P, at the default resolution
+        KernelCache& cache = KernelCache::getInstance();
+        cache.clear();
+        cache.setResolution(1.0, 0.02);
+        const double T0 = 217.3;
+        const double P0 = 24000.0;
+
+        Grid_Aerosol cached(1, 1, bin_centers, bin_edges, 1.0e3, 5.0e-6, 1.6);
+        Grid_Aerosol serial = cached;
+        const double num0 = cached.TotalNumber()[0][0];
+        cached.Coagulate(600.0, Vector_2D(1, Vector_1D(1, T0)), Vector_1D(1, P0), "ice", physConst::RHO_ICE);
+
+        Vector_1D vCenters(nBins);
+        for (int i = 0; i < nBins; i++) {
+            vCenters[i] = 4.0/3.0 * physConst::PI * pow(bin_centers[i], 3);
+        }
+        Coagulation kernel("ice", bin_centers, vCenters, physConst::RHO_ICE, T0, P0);
+        serial.Coagulate(600.0, kernel);
+
+        const double cachedLoss = num0 - cached.TotalNumber()[0][0];
+        const double serialLoss = num0 - serial.TotalNumber()[0][0];
+        //Within the error allowed for interpolated kernels. The serial scheme
+        //does not conserve volume exactly, so only particle losses compare.
+        REQUIRE(serialLoss > 0.0);
+        REQUIRE(cachedLoss == Catch::Approx(serialLoss).epsilon(0.2));
+        cache.clear();
+    }
+
+    SECTION("Kernel interpolated between cache nodes") {
+        //Conditions half way between nodes, where snapping to the nearest node is least accurate
+        KernelCache& cache = KernelCache::getInstance();
+        const double T0 = 215.5;
+        const double P0 = exp((std::floor(log(25000.0) / 0.02) + 0.5) * 0.02);
+        auto particleLoss = [&](double dT, double dlnP) {
+            cache.clear();
+            cache.setResolution(dT, dlnP);
+            Grid_Aerosol aerosol(1, 1, bin_centers, bin_edges, 1.0e3, 5.0e-6, 1.6);
+            Vector_2D T(1, Vector_1D(1, T0));
+            Vector_1D P(1, P0);
+            const double num0 = aerosol.TotalNumber()[0][0];
+            aerosol.Coagulate(600.0, T, P, "ice", physConst::RHO_ICE);
+            return num0 - aerosol.TotalNumber()[0][0];
+        };
+        //Nodes close enough to the requested state to stand for the exact kernel
+        const double exact = particleLoss(1.0e-3, 1.0e-5);
+        const double interpolated = particleLoss(1.0, 0.02);
+        //Snapping to the nearest node is off by about 1% here
+        REQUIRE(interpolated == Catch::Approx(exact).epsilon(5e-4));
+        cache.clear();
+        cache.setResolution(1.0, 0.02);
+    }
+}
@@ -0,0 +1,132 @@
+#include "Core/AmbientState.hpp"
+#include "Core/Structure.hpp"
+#include "Core/Input.hpp"
+#include "Core/Meteorology.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <string>
+
+namespace {
+    const std::string backgFile = std::string(APCEMM_TESTS_DIR) + "/../../input_data/init.txt";
+
+    std::vector<std::unordered_map<std::string, double>> parameters() {
+        return { {
+            {"PLUMEPROCESS", 2.0}, {"TEMPERATURE", 217.0}, {"RHW", 60.0}, {"PRESSURE", 24000.0},
+            {"DH", 15.0}, {"DV", 0.15}, {"SHEAR", 2.0E-03}, {"NBV", 0.013},
+            {"LONGITUDE", -15.0}, {"LATITUDE", 60.0}, {"EDAY", 81.0}, {"ETIME", 8.0},
+            {"BACKG_NOX", 5.0E-02}, {"BACKG_HNO3", 8.1E-02}, {"BACKG_O3", 100.0},
+            {"BACKG_CO", 40.0}, {"BACKG_CH4", 1.76E+03}, {"BACKG_SO2", 7.25E-03},
+            {"EI_NOX", 10.0}, {"EI_CO", 1.0}, {"EI_UHC", 0.6}, {"EI_SO2", 1.2},
+            {"EI_SO2TOSO4", 0.02}, {"EI_SOOT", 0.008}, {"EI_SOOTRAD", 20.0E-09},
+            {"FF", 0.7}, {"AMASS", 6.0E+04}, {"FSPEED", 240.0}, {"NUMENG", 2.0},
+            {"WINGSPAN", 34.32}, {"COREEXITTEMP", 547.3}, {"BYPASSAREA", 1.804} } };
+    }
+
+    OptInput gridInput() {
+        OptInput opt;
+        opt.ADV_GRID_NX = 4;
+        opt.ADV_GRID_NY = 6;
+        opt.ADV_GRID_XLIM_LEFT = 1.0E+03;
+        opt.ADV_GRID_XLIM_RIGHT = 1.0E+03;
+        opt.ADV_GRID_YLIM_UP = 300.0;
+        opt.ADV_GRID_YLIM_DOWN = 300.0;
+        opt.ADV_TROPOPAUSE_PRESSURE = 2.0E+04;
+        opt.CHEMISTRY_CHEMISTRY = false;
+        opt.MET_LOADMET = false;
+        opt.MET_DT = 1.0;
+        opt.MET_INTERPTEMPDATA = true;
+        opt.MET_INTERPRHDATA = true;
+        opt.MET_INTERPSHEARDATA = true;
+        opt.MET_INTERPVERTVELOC = true;
+        opt.MET_FIXDEPTH = false;
+        opt.MET_DEPTH = 200.0;
+        opt.MET_LAPSERATE = -3.0E-03;
+        opt.MET_SUBSAT_RHI = 80.0;
+        opt.MET_DIURNAL = false;
+        opt.MET_TEMP_PERTURB_AMPLITUDE = 0.0;
+        opt.MET_HUMIDSCAL_MODIFICATION_SCHEME = "none";
+        opt.SIMULATION_RANDOM_SEED = 0;
+        return opt;
+    }
+
+    //Uniform grid of ny cells over [-halfHeight, halfHeight]
+    void makeGrid(int ny, double halfHeight, Vector_1D& y, Vector_1D& yE) {
+        const double dy = 2.0 * halfHeight / ny;
+        y.resize(ny);
+        yE.resize(ny + 1);
+        for (int j = 0; j <= ny; j++) yE[j] = -halfHeight + dy * j;
+        for (int j = 0; j < ny; j++) y[j] = 0.5 * (yE[j] + yE[j + 1]);
+    }
+
+    //AmbientState at every cell holds what Solution::Initialize leaves there
+    void compare(const OptInput& opt, const Input& input, const Meteorology& met, double airDens) {
+        Solution solution(opt);
+        double VAR[NVAR], FIX[NFIX];
+        solution.Initialize(backgFile.c_str(), input, airDens, met, opt, VAR, FIX, false);
+
+        for (UInt i = 0; i < opt.ADV_GRID_NX; i++) {
+            for (UInt j = 0; j < opt.ADV_GRID_NY; j++) {
+                const AmbientState ambient(backgFile.c_str(), input, airDens, met, opt, i, j);
+
+                double VAR_sol[NVAR], FIX_sol[NFIX], VAR_amb[NVAR], FIX_amb[NFIX];
+                solution.getData(VAR_sol, FIX_sol, i, j);
+                ambient.getData(VAR_amb, FIX_amb);
+                for (UInt N = 0; N < NVAR; N++) REQUIRE(VAR_amb[N] == Catch::Approx(VAR_sol[N]).epsilon(1.0E-12));
+                for (UInt N = 0; N < NFIX; N++) REQUIRE(FIX_amb[N] == Catch::Approx(FIX_sol[N]).epsilon(1.0E-12));
+                for (UInt N = 0; N < NVAR; N++) REQUIRE(ambient.species()[N] == VAR_amb[N]);
+
+                const Vector_2D aerosol = solution.getAerosol();
+                REQUIRE(ambient.aerosol().size() == aerosol.size());
+                for (UInt iAer = 0; iAer < aerosol.size(); iAer++) {
+                    REQUIRE(ambient.aerosol()[iAer].size() == aerosol[iAer].size());
+                    for (UInt k = 0; k < aerosol[iAer].size(); k++)
+                        REQUIRE(ambient.aerosol()[iAer][k] == Catch::Approx(aerosol[iAer][k]).epsilon(1.0E-12));
+                }
+
+                for (UInt k = 0; k < 11; k++)
+                    REQUIRE(ambient.KHETI_SLA()[k] == Catch::Approx(solution.KHETI_SLA[k]).epsilon(1.0E-12));
+                REQUIRE(ambient.STATE_PSC() == solution.STATE_PSC);
+            }
+        }
+    }
+}
+
+TEST_CASE("Ambient state of a single cell", "[single-file]") {
+    const auto params = parameters();
+    const Input input(0, params, "", "", "", "", "");
+    const double airDens = input.pressure_Pa() / (physConst::kB * input.temperature_K()) * 1.00E-06;
+
+    AmbientMetParams amb;
+    amb.solarTime_h = input.emissionTime();
+    amb.temp_K = input.temperature_K();
+    amb.press_Pa = input.pressure_Pa();
+    amb.rhi = 110.0;
+    amb.shear = input.shear();
+
+    SECTION("Without met input") {
+        const OptInput opt = gridInput();
+        Vector_1D y, yE;
+        makeGrid(opt.ADV_GRID_NY, opt.ADV_GRID_YLIM_DOWN, y, yE);
+        const Meteorology met(opt, amb, y, yE);
+        compare(opt, input, met, airDens);
+    }
+
+    SECTION("With met input") {
+        //H2O then varies with altitude
+        OptInput opt = gridInput();
+        opt.MET_LOADMET = true;
+        opt.MET_FILENAME = std::string(APCEMM_TESTS_DIR) + "/test_meteorology_metfile.nc";
+        opt.MET_LOADTEMP = true;
+        opt.MET_TEMPTIMESERIES = true;
+        opt.MET_LOADRH = true;
+        opt.MET_RHTIMESERIES = true;
+        opt.MET_LOADSHEAR = false;
+        opt.MET_SHEARTIMESERIES = false;
+        opt.MET_LOADVERTVELOC = false;
+        opt.MET_VERTVELOCTIMESERIES = false;
+        Vector_1D y, yE;
+        makeGrid(opt.ADV_GRID_NY, opt.ADV_GRID_YLIM_DOWN, y, yE);
+        const Meteorology met(opt, amb, y, yE);
+        compare(opt, input, met, airDens);
+    }
+}
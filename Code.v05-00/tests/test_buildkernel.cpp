@@ -1,11 +1,14 @@
 #include "AIM/buildKernel.hpp"
+#include "AIM/KernelCache.hpp"
 #include "Util/ForwardDecl.hpp"
 #include "Util/PhysFunction.hpp"
 #include "Util/PhysConstant.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 using namespace AIM;
 
@@ -225,4 +228,145 @@ TEST_CASE("Build kernel", "[single-file]") {
         REQUIRE(1.0e6 * scaler * TSKernel[0][0] == Catch::Approx(2.5118864315095718e-8).epsilon(0.1));
     }
 
-}
\ No newline at end of file
+}
+
+TEST_CASE("Kernel cache", "[single-file]") {
+    Vector_1D bin_centers(8);
+    for (int i = 0; i < 8; i++) {
+        bin_centers[i] = 1.0e-8 * pow(2.0, i);
+    }
+    double rho = physConst::RHO_ICE;
+
+    KernelCache& cache = KernelCache::getInstance();
+    cache.clear();
+    cache.setResolution(1.0, 0.02);
+
+    SECTION("Exact on nodes") {
+        double T = 220.0;
+        double p = exp(550 * 0.02);
+        Vector_2D cached = cache.getKernel("ice", T, p, bin_centers, rho);
+        Vector_2D direct = buildTotalKernel("ice", T, p, bin_centers, rho, bin_centers, rho);
+        //A state on a node, up to round-off in ln P, uses that node alone
+        REQUIRE(cache.size() == 1);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                REQUIRE(cached[i][j] == Catch::Approx(direct[i][j]).epsilon(1e-8));
+            }
+        }
+
+        //Looked up by node index
+        const KernelCache::Resolution resolution = cache.resolution();
+        std::vector<Vector_2D> nodes = cache.getNodeKernels("ice", resolution, { 220, 221 }, { 550, 550 }, bin_centers, rho);
+        REQUIRE(cache.size() == 2);
+        Vector_2D direct221 = buildTotalKernel("ice", 221.0, p, bin_centers, rho, bin_centers, rho);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                REQUIRE(nodes[0][i][j] == cached[i][j]);
+                REQUIRE(nodes[1][i][j] == Catch::Approx(direct221[i][j]).epsilon(1e-8));
+            }
+        }
+
+        //Nodes of another resolution are built, but not cached
+        nodes = cache.getNodeKernels("ice", KernelCache::Resolution{ 0.5, 0.02 }, { 441 }, { 550 }, bin_centers, rho);
+        REQUIRE(cache.size() == 2);
+        Vector_2D direct2205 = buildTotalKernel("ice", 220.5, p, bin_centers, rho, bin_centers, rho);
+        REQUIRE(nodes[0][3][5] == Catch::Approx(direct2205[3][5]).epsilon(1e-8));
+    }
+
+    SECTION("Interpolated between nodes") {
+        double T = 217.3;
+        double p = 24000.0;
+        Vector_2D cached = cache.getKernel("ice", T, p, bin_centers, rho);
+        Vector_2D direct = buildTotalKernel("ice", T, p, bin_centers, rho, bin_centers, rho);
+        REQUIRE(cache.size() == 4);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                REQUIRE(cached[i][j] == Catch::Approx(direct[i][j]).epsilon(1e-2));
+            }
+        }
+
+        //Same thermodynamic cell: no new nodes
+        cache.getKernel("ice", T + 0.1, p, bin_centers, rho);
+        REQUIRE(cache.size() == 4);
+    }
+
+    SECTION("Batched lookup") {
+        Vector_1D T = { 215.2, 215.4, 216.7, 230.0 };
+        Vector_1D p = { 25000.0, 25000.0, 25100.0, 20000.0 };
+        std::vector<Vector_2D> cached = cache.getKernels("ice", T, p, bin_centers, rho);
+        REQUIRE(cached.size() == 4);
+        REQUIRE(cache.size() < 16);
+        for (std::size_t s = 0; s < T.size(); s++) {
+            Vector_2D single = cache.getKernel("ice", T[s], p[s], bin_centers, rho);
+            REQUIRE(cached[s][3][5] == Catch::Approx(single[3][5]));
+        }
+    }
+
+    SECTION("Distinct bin grids and phases") {
+        Vector_1D other_centers = bin_centers;
+        other_centers[0] *= 1.1;
+        cache.getKernel("ice", 220.5, 24000.0, bin_centers, rho);
+        REQUIRE(cache.size() == 4);
+        cache.getKernel("ice", 220.5, 24000.0, other_centers, rho);
+        REQUIRE(cache.size() == 8);
+        cache.getKernel("soot", 220.5, 24000.0, bin_centers, rho);
+        REQUIRE(cache.size() == 12);
+        cache.getKernel("ice", 220.5, 24000.0, bin_centers, 0.5 * rho);
+        REQUIRE(cache.size() == 16);
+
+        //Every hit returns the kernel of its own grid, density and phase
+        double T = 221.0;
+        double p = exp(504 * 0.02);
+        struct Case { const char* phase; const Vector_1D* centers; double rho; };
+        for (const Case& c: { Case{ "ice", &bin_centers, rho }, Case{ "ice", &other_centers, rho },
+                              Case{ "soot", &bin_centers, rho }, Case{ "ice", &bin_centers, 0.5 * rho } }) {
+            cache.getKernel(c.phase, T, p, *c.centers, c.rho);
+        }
+        for (const Case& c: { Case{ "ice", &bin_centers, rho }, Case{ "ice", &other_centers, rho },
+                              Case{ "soot", &bin_centers, rho }, Case{ "ice", &bin_centers, 0.5 * rho } }) {
+            const std::size_t nodes = cache.size();
+            Vector_2D cached = cache.getKernel(c.phase, T, p, *c.centers, c.rho);
+            Vector_2D direct = buildTotalKernel(c.phase, T, p, *c.centers, c.rho, *c.centers, c.rho);
+            REQUIRE(cache.size() == nodes);
+            for (int i = 0; i < 8; i++) {
+                for (int j = 0; j < 8; j++) {
+                    REQUIRE(cached[i][j] == Catch::Approx(direct[i][j]).epsilon(1e-8));
+                }
+            }
+        }
+    }
+
+    SECTION("Resolution changed during lookups") {
+        //Node indices of one resolution built at the spacing of the other
+        //would be off by a factor of two in T and P
+        const double T = 217.3;
+        const double p = 24000.0;
+        Vector_2D direct = buildTotalKernel("ice", T, p, bin_centers, rho, bin_centers, rho);
+        //Lookups run until the resolution has changed many times
+        std::atomic<bool> done(false);
+        std::vector<double> maxRelDiff(3, 0.0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < maxRelDiff.size(); t++) {
+            threads.emplace_back([&, t]() {
+                while (!done) {
+                    Vector_2D cached = cache.getKernel("ice", T, p, bin_centers, rho);
+                    for (int i = 0; i < 8; i++) {
+                        for (int j = 0; j < 8; j++) {
+                            maxRelDiff[t] = std::max(maxRelDiff[t], std::abs(cached[i][j] / direct[i][j] - 1.0));
+                        }
+                    }
+                }
+            });
+        }
+        for (int n = 0; n < 200; n++) {
+            cache.setResolution((n % 2) ? 0.5 : 1.0, (n % 2) ? 0.01 : 0.02);
+            std::this_thread::yield();
+        }
+        done = true;
+        for (auto& thread: threads) thread.join();
+        for (double d: maxRelDiff) REQUIRE(d < 1e-2);
+        cache.setResolution(1.0, 0.02);
+    }
+
+    cache.clear();
+}
@@ -0,0 +1,40 @@
+#include "Core/ChemCluster.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <stdexcept>
+
+TEST_CASE("Chemistry clustering", "[single-file]") {
+    //Two species above a floor of 1 and a rate with no floor
+    ChemCluster cluster(1.0E-02, Vector_1D{1.0, 1.0, 0.0});
+
+    SECTION("Cells within the tolerance share a cluster") {
+        REQUIRE(cluster.Add({1.0E+06, 5.0E+10, 1.0E-12}) == 0);
+        REQUIRE(cluster.Add({1.0E+06, 5.0E+10, 1.0E-12}) == 0);
+        //Bins are 1% wide: 1.002e6 falls into the same one as 1e6
+        REQUIRE(cluster.Add({1.002E+06, 5.0E+10, 1.0E-12}) == 0);
+        //Values at or below the floor are not told apart
+        REQUIRE(cluster.Add({0.5, 5.0E+10, 1.0E-12}) == 1);
+        REQUIRE(cluster.Add({-0.1, 5.0E+10, 1.0E-12}) == 1);
+        REQUIRE(cluster.Add({1.0, 5.0E+10, 1.0E-12}) == 1);
+
+        REQUIRE(cluster.getnCell() == 6);
+        REQUIRE(cluster.getnCluster() == 2);
+        REQUIRE(cluster.getRepresentatives() == std::vector<UInt>{0, 3});
+        REQUIRE(cluster.getClusterIndex() == std::vector<UInt>{0, 0, 0, 1, 1, 1});
+        REQUIRE(cluster.getMaxSpread() == Catch::Approx(2.0E-03));
+    }
+
+    SECTION("Cells differing in any component are kept apart") {
+        cluster.Add({1.0E+06, 5.0E+10, 1.0E-12});
+        REQUIRE(cluster.Add({1.1E+06, 5.0E+10, 1.0E-12}) == 1);
+        REQUIRE(cluster.Add({1.0E+06, 5.0E+10, 1.1E-12}) == 2);
+        //A zero rate differs from any positive rate
+        REQUIRE(cluster.Add({1.0E+06, 5.0E+10, 0.0}) == 3);
+        REQUIRE(cluster.getMaxSpread() == 0.0);
+    }
+
+    SECTION("Invalid input") {
+        REQUIRE_THROWS_AS(ChemCluster(0.0, Vector_1D{1.0}), std::invalid_argument);
+        REQUIRE_THROWS_AS(cluster.Add({1.0, 1.0}), std::invalid_argument);
+    }
+}
@@ -0,0 +1,201 @@
+#include "Core/InputDatabase.hpp"
+#include "Core/Parameters.hpp"
+#include "KPP/KPP_Parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+    //Copies an input file to the temp directory, so that the input folder is left untouched
+    std::string tempCopy(const std::string& fileName, const std::string& copyName) {
+        std::filesystem::path copy = std::filesystem::temp_directory_path() / copyName;
+        std::filesystem::copy_file(std::string(APCEMM_TESTS_DIR) + "/../../input_data/" + fileName, copy,
+                                   std::filesystem::copy_options::overwrite_existing);
+        return copy.string();
+    }
+
+    //Another name for the same file, as the databases already read are kept by name
+    std::string alias(const std::string& fileName, int n) {
+        std::filesystem::path path = std::filesystem::path(fileName).parent_path();
+        while (n-- > 0) path /= ".";
+        return (path / std::filesystem::path(fileName).filename()).string();
+    }
+
+    //Precompiled inputs on, with an empty cache folder in the temp directory
+    struct PrecompiledInputs {
+        std::filesystem::path cacheHome = std::filesystem::temp_directory_path() / "test_inputdatabase_cache";
+        std::string oldCacheHome;
+        bool hadCacheHome;
+
+        PrecompiledInputs() {
+            const char* env = std::getenv("XDG_CACHE_HOME");
+            hadCacheHome = (env != nullptr);
+            if (hadCacheHome) oldCacheHome = env;
+            std::filesystem::remove_all(cacheHome);
+            setenv("XDG_CACHE_HOME", cacheHome.c_str(), 1);
+            SetPrecompiledInputs(true);
+        }
+        ~PrecompiledInputs() {
+            SetPrecompiledInputs(false);
+            if (hadCacheHome) setenv("XDG_CACHE_HOME", oldCacheHome.c_str(), 1);
+            else unsetenv("XDG_CACHE_HOME");
+            std::filesystem::remove_all(cacheHome);
+        }
+
+        //The precompiled files written so far
+        std::vector<std::filesystem::path> files() const {
+            std::vector<std::filesystem::path> found;
+            std::error_code ec;
+            for (const auto& entry: std::filesystem::directory_iterator(cacheHome / "APCEMM", ec))
+                found.push_back(entry.path());
+            return found;
+        }
+    };
+
+    std::string readAll(const std::filesystem::path& fileName) {
+        std::ifstream file(fileName, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void writeAll(const std::filesystem::path& fileName, const std::string& content) {
+        std::ofstream(fileName, std::ios::binary | std::ios::trunc) << content;
+    }
+}
+
+TEST_CASE("Engine emission database", "[single-file]") {
+    std::string engineFile = tempCopy("ENG_EI.txt", "test_inputdatabase_ENG_EI.txt");
+    auto database = EngineDatabase::Get(engineFile);
+    REQUIRE(database != nullptr);
+    REQUIRE(database->size() > 0);
+
+    SECTION("Engines are looked up by name and ICAO UID") {
+        const EngineDatabase::Entry* entry = database->find("CFM56-7B26");
+        REQUIRE(entry != nullptr);
+        //Records in file order: approach, climb out, take off, idle
+        REQUIRE((*entry)[0].CO == Catch::Approx(1.6));
+        REQUIRE((*entry)[0].HC == Catch::Approx(0.1));
+        REQUIRE((*entry)[0].NOx == Catch::Approx(10.8));
+        REQUIRE((*entry)[0].fuelflow == Catch::Approx(0.338));
+        REQUIRE((*entry)[3].CO == Catch::Approx(18.8));
+        REQUIRE(database->find("3CM033") == entry);
+        //Names are matched exactly, not as a prefix
+        REQUIRE(database->find("CFM56-7B26/2 (DAC)") != entry);
+        REQUIRE(database->find("CFM56") == nullptr);
+        REQUIRE(database->find("ENG_NAME") == nullptr);
+    }
+
+    SECTION("The same database is shared") {
+        REQUIRE(EngineDatabase::Get(engineFile) == database);
+    }
+
+    SECTION("Nothing is precompiled unless turned on") {
+        const char* env = std::getenv("XDG_CACHE_HOME");
+        const std::string oldCacheHome = env ? env : "";
+        const std::filesystem::path cacheHome = std::filesystem::temp_directory_path() / "test_inputdatabase_cache";
+        std::filesystem::remove_all(cacheHome);
+        setenv("XDG_CACHE_HOME", cacheHome.c_str(), 1);
+        REQUIRE(EngineDatabase::Get(alias(engineFile, 1))->size() == database->size());
+        REQUIRE(!std::filesystem::exists(cacheHome));
+        if (env) setenv("XDG_CACHE_HOME", oldCacheHome.c_str(), 1);
+        else unsetenv("XDG_CACHE_HOME");
+    }
+
+    SECTION("Precompiled files are used while the text file is unchanged") {
+        //Aliases from 2 on: the sections share the databases already read
+        PrecompiledInputs precompiled;
+        REQUIRE(EngineDatabase::Get(alias(engineFile, 2))->size() == database->size());
+        REQUIRE(precompiled.files().size() == 1);
+        const std::filesystem::path binFile = precompiled.files()[0];
+
+        //Renames an engine in the precompiled file only
+        auto renameEngine = [&]() {
+            std::string content = readAll(binFile);
+            const std::size_t pos = content.find("SSTENG");
+            REQUIRE(pos != std::string::npos);
+            content.replace(pos, 6, "SSTENH");
+            writeAll(binFile, content);
+        };
+
+        renameEngine();
+        auto loaded = EngineDatabase::Get(alias(engineFile, 3));
+        REQUIRE(loaded->size() == database->size());
+        REQUIRE(loaded->find("SSTENG") == nullptr);
+        REQUIRE((*loaded->find("SSTENH"))[1].NOx == Catch::Approx(7.86));
+        REQUIRE(loaded->find("3CM033") == loaded->find("CFM56-7B26"));
+
+        //Same size, later modification time
+        std::filesystem::last_write_time(engineFile, std::filesystem::last_write_time(engineFile) + std::chrono::hours(1));
+        auto modified = EngineDatabase::Get(alias(engineFile, 4));
+        REQUIRE(modified->find("SSTENG") != nullptr);
+        REQUIRE(precompiled.files().size() == 1);
+        REQUIRE(readAll(binFile).find("SSTENG") != std::string::npos);
+
+        //Same modification time, different size
+        renameEngine();
+        const auto mtime = std::filesystem::last_write_time(engineFile);
+        std::ofstream(engineFile, std::ios::app) << "\n";
+        std::filesystem::last_write_time(engineFile, mtime);
+        REQUIRE(EngineDatabase::Get(alias(engineFile, 5))->find("SSTENG") != nullptr);
+
+        //Corrupt precompiled files are ignored
+        const std::string content = readAll(binFile);
+        writeAll(binFile, content.substr(0, content.size() / 2));
+        auto truncated = EngineDatabase::Get(alias(engineFile, 6));
+        REQUIRE(truncated->size() == database->size());
+        REQUIRE(truncated->find("SSTENG") != nullptr);
+
+        //Without a usable cache folder, the text file is parsed
+        std::filesystem::remove_all(precompiled.cacheHome);
+        writeAll(precompiled.cacheHome, "");
+        REQUIRE(EngineDatabase::Get(alias(engineFile, 7))->size() == database->size());
+        std::filesystem::remove(precompiled.cacheHome);
+    }
+
+    SECTION("Missing files throw") {
+        REQUIRE_THROWS_AS(EngineDatabase::Get(engineFile + ".missing"), std::runtime_error);
+    }
+
+    std::remove(engineFile.c_str());
+}
+
+TEST_CASE("Background conditions database", "[single-file]") {
+    std::string initFile = tempCopy("init.txt", "test_inputdatabase_init.txt");
+    auto database = BackgroundDatabase::Get(initFile, NSPEC, N_AER);
+    REQUIRE(database != nullptr);
+    REQUIRE(database->ambient().size() == NSPEC);
+    REQUIRE(database->aerosol().size() == N_AER);
+
+    REQUIRE(database->indexOf("CO2") == 0);
+    REQUIRE(database->ambient()[0] == Catch::Approx(3.6E-04));
+    REQUIRE(database->indexOf("N2O") == 5);
+    REQUIRE(database->ambient()[5] == Catch::Approx(3.208E-07));
+    REQUIRE(database->indexOf("XYZ") == -1);
+    //Soot: number concentration then radius
+    REQUIRE(database->aerosol()[0][0] == Catch::Approx(0.05));
+    REQUIRE(database->aerosol()[0][1] == Catch::Approx(2.0E-08));
+    REQUIRE(database->aerosol()[2][1] == Catch::Approx(1.0E-07));
+
+    REQUIRE(BackgroundDatabase::Get(initFile, NSPEC, N_AER) == database);
+    REQUIRE_THROWS_AS(BackgroundDatabase::Get(initFile + ".missing", NSPEC, N_AER), std::runtime_error);
+
+    {
+        //Parsed, then loaded from the precompiled file
+        PrecompiledInputs precompiled;
+        for (int n = 1; n <= 2; n++) {
+            auto copy = BackgroundDatabase::Get(alias(initFile, n), NSPEC, N_AER);
+            REQUIRE(precompiled.files().size() == 1);
+            REQUIRE(copy->ambient() == database->ambient());
+            REQUIRE(copy->aerosol() == database->aerosol());
+            REQUIRE(copy->indexOf("N2O") == 5);
+        }
+    }
+
+    std::remove(initFile.c_str());
+}
@@ -3,6 +3,8 @@
 #include "Util/PhysConstant.hpp"
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 
@@ -52,3 +54,125 @@ TEST_CASE("EPM integrate", "[single-file]") {
 }
 
 
+
+TEST_CASE("EPM streaming observer", "[single-file]") {
+    const std::vector<UInt> indices = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    auto state = [](double t) {
+        Vector_1D x(13, 1.0E-06);
+        x[0] = 1.0 / (1.0 + t);
+        x[1] = 220.0;
+        x[2] = 25000.0;
+        //RHw crosses 1 between t = 4 and t = 5
+        x[3] = (0.91 + 0.02 * t) * physFunc::pSat_H2Ol(220.0) / 25000.0;
+        return x;
+    };
+
+    SECTION("Ring buffer") {
+        MicroOutputSettings settings;
+        settings.format = MicroOutputFormat::None;
+        streamingObserver observer(indices, "", settings, 3);
+        for (int n = 0; n < 4; n++) {
+            observer(state(n), n);
+            REQUIRE_FALSE(observer.checkwatersat());
+        }
+        REQUIRE(observer.nObserved() == 4);
+        REQUIRE(observer.lastTime() == 3);
+        REQUIRE(observer.lastTime(2) == 1);
+        REQUIRE(observer.lastState()[0] == Catch::Approx(0.25));
+        REQUIRE_THROWS(observer.lastState(3));
+
+        observer(state(6), 6);
+        REQUIRE(observer.checkwatersat());
+        observer(state(1), 7);
+        REQUIRE(observer.checkwatersat());
+    }
+
+    SECTION("Default output stride") {
+        //Every other accepted step, as the original observer's write_every of 2
+        MicroOutputSettings settings;
+        REQUIRE(settings.format == MicroOutputFormat::Text);
+        REQUIRE(settings.writeEvery == 2);
+        streamingObserver observer(indices, "test_epm_micro_default.out", settings);
+        for (int n = 0; n < 5; n++) {
+            observer(state(n), n);
+        }
+        REQUIRE(observer.nRecorded() == 3);
+        observer.close();
+        std::remove("test_epm_micro_default.out");
+    }
+
+    SECTION("Decimated binary output") {
+        const std::string fileName = "test_epm_micro.bin";
+        MicroOutputSettings settings;
+        settings.format = MicroOutputFormat::Binary;
+        settings.writeEvery = 4;
+        {
+            streamingObserver observer(indices, fileName, settings);
+            for (int n = 0; n < 10; n++) {
+                observer(state(n), n);
+            }
+            //Steps 0, 4, 8, and the last one on close
+            REQUIRE(observer.nRecorded() == 3);
+            observer.close();
+            REQUIRE(observer.nRecorded() == 4);
+        }
+
+        std::ifstream file(fileName, std::ios::binary);
+        char magic[8];
+        std::uint32_t nCols;
+        file.read(magic, 8);
+        file.read(reinterpret_cast<char*>(&nCols), sizeof(nCols));
+        REQUIRE(std::string(magic, 8) == "EPMMICRO");
+        REQUIRE(nCols == 18);
+        for (std::uint32_t c = 0; c < nCols; c++) {
+            std::uint32_t len;
+            file.read(reinterpret_cast<char*>(&len), sizeof(len));
+            file.ignore(len);
+        }
+        Vector_1D times;
+        Vector_1D row(nCols);
+        while (file.read(reinterpret_cast<char*>(row.data()), nCols * sizeof(double))) {
+            times.push_back(row[0]);
+        }
+        REQUIRE(times == Vector_1D({0, 4, 8, 9}));
+        file.close();
+        std::remove(fileName.c_str());
+    }
+
+    SECTION("Threshold triggered output") {
+        MicroOutputSettings settings;
+        settings.format = MicroOutputFormat::Text;
+        settings.writeEvery = 1000;
+        settings.relChange = 0.3;
+        streamingObserver observer(indices, "test_epm_micro.out", settings);
+        //Tracer goes 1, 1/2, 1/3, ... : recorded at t = 0, 1, 2, 4, 7
+        for (int n = 0; n < 8; n++) {
+            observer(state(n), n);
+        }
+        REQUIRE(observer.nRecorded() == 5);
+        observer.close();
+        std::remove("test_epm_micro.out");
+    }
+}
+
+TEST_CASE("EPM stiff integrator", "[single-file]") {
+    //x0 relaxes onto x1 with a 1e-4 s timescale, x1 decays slowly
+    const double k = 1.0E+04;
+    auto rhs = [k](const Vector_1D &x, Vector_1D &dxdt, const double t) {
+        dxdt[0] = -k * (x[0] - x[1]);
+        dxdt[1] = -x[1];
+    };
+    Vector_1D x = {0.0, 1.0};
+    Vector_1D tObs;
+    auto observer = [&tObs](const Vector_1D &state, double t) { tObs.push_back(t); };
+
+    UInt nSteps = integrateStiff(rhs, x, 0.0, 2.0, 1.0E-03, observer, 1.0E-08, 1.0E-08);
+
+    REQUIRE(x[0] == Catch::Approx(k / (k - 1.0) * std::exp(-2.0)).epsilon(1.0E-07));
+    REQUIRE(x[1] == Catch::Approx(std::exp(-2.0)).epsilon(1.0E-07));
+    REQUIRE(tObs.front() == 0.0);
+    REQUIRE(tObs.back() == Catch::Approx(2.0));
+    REQUIRE(tObs.size() == nSteps + 1);
+    //An explicit method would be stability limited to dt ~ 1/k, i.e. ~ 1e4 steps
+    REQUIRE(nSteps < 1000);
+}
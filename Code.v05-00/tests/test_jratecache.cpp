@@ -0,0 +1,81 @@
+#include "Core/JRateCache.hpp"
+#include "KPP/KPP_Parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+TEST_CASE("Photolysis rate cache", "[single-file]") {
+    //Rates that are linear in lon, lat and pressure are interpolated exactly
+    Vector_1D lon{-10.0, 0.0, 10.0, 20.0};
+    Vector_1D lat{-10.0, -5.0, 0.0, 5.0, 10.0};
+    Vector_1D pmid{300.0, 250.0, 200.0};
+    auto rate = [](UInt iPhotol, double x, double y, double p) { return iPhotol + 1.0E-02 * x + 2.0E-02 * y + 1.0E-03 * p; };
+
+    Vector_1D data(lon.size() * lat.size() * pmid.size() * NPHOTOL);
+    for (UInt iLat = 0; iLat < lat.size(); iLat++)
+        for (UInt iLon = 0; iLon < lon.size(); iLon++)
+            for (UInt iPres = 0; iPres < pmid.size(); iPres++)
+                for (UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++)
+                    data[((iLat * lon.size() + iLon) * pmid.size() + iPres) * NPHOTOL + iPhotol] = rate(iPhotol, lon[iLon], lat[iLat], pmid[iPres]);
+
+    std::string cacheFile = (std::filesystem::temp_directory_path() / "test_jratecache.jrc").string();
+    std::string sourceFile = (std::filesystem::temp_directory_path() / "test_jratecache.nc").string();
+    std::ofstream(sourceFile) << "input";
+    const JRateCache::Source source = JRateCache::Stamp(sourceFile);
+    REQUIRE(source.size == 5);
+    REQUIRE(JRateCache::Write(cacheFile, source, lon, lat, pmid, data));
+    auto cache = JRateCache::Map(cacheFile, source);
+    REQUIRE(cache != nullptr);
+    REQUIRE(cache->isMapped());
+    REQUIRE(cache->nLon() == 4);
+    REQUIRE(cache->nLat() == 5);
+    REQUIRE(cache->nPres() == 3);
+
+    SECTION("Mapped and in-memory caches agree") {
+        JRateCache inMemory(lon, lat, pmid, Vector_1D(data));
+        double jMapped[NPHOTOL], jMemory[NPHOTOL];
+        cache->Interpolate(3.0, 2.5, 230.0, jMapped);
+        inMemory.Interpolate(3.0, 2.5, 230.0, jMemory);
+        for (UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++) {
+            REQUIRE(jMapped[iPhotol] == Catch::Approx(rate(iPhotol, 3.0, 2.5, 230.0)));
+            REQUIRE(jMapped[iPhotol] == jMemory[iPhotol]);
+        }
+    }
+
+    SECTION("Outer intervals of the grid are not interpolated") {
+        double jRates[NPHOTOL];
+        //Latitudes between the last two rows take the last row, lon is still interpolated
+        cache->Interpolate(3.0, 7.0, 230.0, jRates);
+        REQUIRE(jRates[0] == Catch::Approx(rate(0, 3.0, 10.0, 230.0)));
+        //Points beyond the grid stay on its last row
+        cache->Interpolate(3.0, 40.0, 230.0, jRates);
+        REQUIRE(jRates[0] == Catch::Approx(rate(0, 3.0, 10.0, 230.0)));
+    }
+
+    SECTION("Invalid cache files are not mapped") {
+        REQUIRE(JRateCache::Map(cacheFile + ".missing", source) == nullptr);
+        std::ofstream(cacheFile) << "not a cache";
+        REQUIRE(JRateCache::Map(cacheFile, source) == nullptr);
+    }
+
+    SECTION("Caches of a changed input are not mapped") {
+        //Same size, later modification time
+        std::filesystem::last_write_time(sourceFile, std::filesystem::last_write_time(sourceFile) + std::chrono::seconds(10));
+        REQUIRE_FALSE(JRateCache::Stamp(sourceFile) == source);
+        REQUIRE(JRateCache::Map(cacheFile, JRateCache::Stamp(sourceFile)) == nullptr);
+        //Different size
+        std::ofstream(sourceFile) << "longer input";
+        REQUIRE(JRateCache::Map(cacheFile, JRateCache::Stamp(sourceFile)) == nullptr);
+        //Missing input
+        std::remove(sourceFile.c_str());
+        REQUIRE(JRateCache::Stamp(sourceFile) == JRateCache::Source());
+        REQUIRE(JRateCache::Map(cacheFile, JRateCache::Stamp(sourceFile)) == nullptr);
+    }
+
+    cache.reset();
+    std::remove(cacheFile.c_str());
+    std::remove(sourceFile.c_str());
+}
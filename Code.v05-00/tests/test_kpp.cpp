@@ -0,0 +1,477 @@
+#include "KPP/KPP.hpp"
+#include "KPP/KPP_Lanes.hpp"
+#include "Core/Parameters.hpp"
+#include "Core/ChemCluster.hpp"
+#include "Core/BoxModel.hpp"
+#include "YamlInputReader/YamlInputReader.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <string>
+#include <vector>
+
+//Generated scalar routines, declared where used as in the integrators
+void Fun( double Y[], double FIX[], double RCONST[], double Ydot[] );
+void Jac_SP( double Y[], double FIX[], double RCONST[], double Ydot[] );
+
+namespace {
+    //Inputs the reference values were computed for
+    constexpr double TEMP = 215.0;
+    constexpr double PRESS = 24000.0;
+    constexpr double AIRDENS = PRESS / (1.380649E-23 * TEMP) * 1.0E-06;
+    constexpr double RELHUM = 0.4;
+    constexpr double IWC = 1.0E-04;
+    constexpr double TROPOPAUSE_PRESSURE = 2.0E+04;
+
+    //Sections of tests/test_kpp_reference.txt, by name
+    std::map<std::string, std::vector<double>> readReference() {
+        std::ifstream file(std::string(APCEMM_TESTS_DIR) + "/test_kpp_reference.txt");
+        REQUIRE(file);
+        std::map<std::string, std::vector<double>> sections;
+        std::vector<double>* section = nullptr;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.rfind("##", 0) == 0) continue;
+            if (line.rfind("# ", 0) == 0) {
+                section = &sections[line.substr(2)];
+                continue;
+            }
+            std::istringstream values(line);
+            double val;
+            while (values >> val) section->push_back(val);
+        }
+        return sections;
+    }
+
+    //Sets the rates of ctx from its concentrations and photolysis rates
+    void setRates(KppContext& ctx, double temp = TEMP) {
+        double AREA[NAERO], RADI[NAERO], KHETI_SLA[11];
+        for (int i = 0; i < NAERO; i++) {
+            AREA[i] = 1.0E-08 * (i + 1);
+            RADI[i] = 1.0E-05 * (i + 1);
+        }
+        for (int i = 0; i < 11; i++) KHETI_SLA[i] = 1.0E-06 * (i + 1);
+        const double airDens = PRESS / (1.380649E-23 * temp) * 1.0E-06;
+        GC_SETHET(ctx, temp, PRESS, airDens, RELHUM, 0, ctx.C, AREA, RADI, IWC, KHETI_SLA, TROPOPAUSE_PRESSURE);
+        Update_RCONST(ctx, temp, PRESS, airDens, ctx.C[ind_H2O]);
+    }
+}
+
+TEST_CASE("KPP chemistry through a KppContext", "[single-file]") {
+    auto reference = readReference();
+    REQUIRE(reference["C"].size() == NSPEC);
+    REQUIRE(reference["PHOTOL"].size() == NPHOTOL);
+
+    KppContext ctx;
+    std::copy(reference["C"].begin(), reference["C"].end(), ctx.C);
+    std::copy(reference["PHOTOL"].begin(), reference["PHOTOL"].end(), ctx.PHOTOL);
+    setRates(ctx);
+
+    SECTION("Same rates as the global-state versions") {
+        const std::vector<double>& HET = reference["HET"];
+        REQUIRE(HET.size() == 3 * NSPEC);
+        for (int i = 0; i < NSPEC; i++) {
+            for (int k = 0; k < 3; k++) REQUIRE(ctx.HET[i][k] == Catch::Approx(HET[3 * i + k]).epsilon(1.0E-12));
+        }
+        const std::vector<double>& RCONST = reference["RCONST"];
+        REQUIRE(RCONST.size() == NREACT);
+        for (int i = 0; i < NREACT; i++) REQUIRE(ctx.RCONST[i] == Catch::Approx(RCONST[i]).epsilon(1.0E-12));
+    }
+
+    SECTION("Same integration as the global-state version") {
+        double ATOL[NVAR], RTOL[NVAR];
+        for (int i = 0; i < NVAR; i++) {
+            ATOL[i] = 1.0E-03;
+            RTOL[i] = 1.0E-03;
+        }
+        REQUIRE(INTEGRATE(ctx, 0.0, 600.0, ATOL, RTOL, 1.0E-10) == static_cast<int>(reference["IERR"][0]));
+        const std::vector<double>& VAR = reference["VAR"];
+        REQUIRE(VAR.size() == NVAR);
+        double maxRelDiff = 0.0;
+        for (int i = 0; i < NVAR; i++) {
+            if (std::abs(VAR[i]) < 1.0E-03) continue;
+            maxRelDiff = std::max(maxRelDiff, std::abs(ctx.VAR()[i] - VAR[i]) / std::abs(VAR[i]));
+        }
+        REQUIRE(maxRelDiff < 1.0E-12);
+    }
+}
+
+TEST_CASE("Cached thermal rate constants", "[single-file]") {
+    auto reference = readReference();
+
+    //Rates of ctx for the given temperature, pressure and H2O
+    auto rates = [](KppContext& ctx, double temp, double press, double H2O) {
+        const double airDens = press / (1.380649E-23 * temp) * 1.0E-06;
+        Update_RCONST(ctx, temp, press, airDens, H2O);
+        return std::vector<double>(ctx.RCONST, ctx.RCONST + NREACT);
+    };
+    //Largest relative difference between two sets of rates
+    auto maxRelDiff = [](const std::vector<double>& a, const std::vector<double>& b) {
+        double diff = 0.0;
+        for (int i = 0; i < NREACT; i++) {
+            if (b[i] != 0.0) diff = std::max(diff, std::abs(a[i] - b[i]) / std::abs(b[i]));
+            else if (a[i] != 0.0) diff = 1.0;
+        }
+        return diff;
+    };
+    //The cached rates are evaluated at the nearest (T, M) node
+    const double cacheRelTol = 2.0E-03;
+
+    KppContext ctx;
+    std::copy(reference["C"].begin(), reference["C"].end(), ctx.C);
+    std::copy(reference["PHOTOL"].begin(), reference["PHOTOL"].end(), ctx.PHOTOL);
+    const double H2O = ctx.C[ind_H2O];
+
+    SECTION("Off by default") {
+        KppContext exact = ctx;
+        const std::vector<double> first = rates(ctx, TEMP, PRESS, H2O);
+        REQUIRE(rates(exact, TEMP + 1.0E-03, PRESS, H2O) != first);
+    }
+
+    SECTION("Close to the exact rates over a temperature and pressure sweep") {
+        double maxDiff = 0.0;
+        for (double temp = 195.0; temp <= 260.0; temp += 2.3) {
+            for (double press = 1.5E+04; press <= 3.5E+04; press += 1.7E+03) {
+                Set_RCONST_Cache(0.0, 0.0);
+                const std::vector<double> exact = rates(ctx, temp, press, H2O);
+                Set_RCONST_Cache(1.0E-02, 1.0E-04);
+                //Filling the cache, then reading it back
+                REQUIRE(rates(ctx, temp, press, H2O) == rates(ctx, temp, press, H2O));
+                maxDiff = std::max(maxDiff, maxRelDiff(rates(ctx, temp, press, H2O), exact));
+            }
+        }
+        REQUIRE(maxDiff > 0.0);
+        REQUIRE(maxDiff < cacheRelTol);
+    }
+
+    SECTION("Follows changes in temperature, pressure, H2O and photolysis") {
+        Set_RCONST_Cache(1.0E-02, 1.0E-04);
+        const std::vector<double> base = rates(ctx, TEMP, PRESS, H2O);
+
+        //Each change is checked against the exact rates for the new inputs
+        auto check = [&](double temp, double press, double H2O_) {
+            KppContext exactCtx = ctx;
+            const std::vector<double> cached = rates(ctx, temp, press, H2O_);
+            Set_RCONST_Cache(0.0, 0.0);
+            const std::vector<double> exact = rates(exactCtx, temp, press, H2O_);
+            Set_RCONST_Cache(1.0E-02, 1.0E-04);
+            REQUIRE(cached != base);
+            REQUIRE(maxRelDiff(cached, exact) < cacheRelTol);
+        };
+        check(TEMP + 0.5, PRESS, H2O);
+        check(TEMP, PRESS * 1.01, H2O);
+        check(TEMP, PRESS, H2O * 2.0);
+        ctx.PHOTOL[1] *= 2.0;
+        check(TEMP, PRESS, H2O);
+    }
+
+    SECTION("Resolution set from the chemistry menu") {
+        //tests/test.yaml asks for a 0.01 K cache
+        OptInput input;
+        YamlInputReader::readChemMenu(input, YAML::LoadFile(std::string(APCEMM_TESTS_DIR) + "/test.yaml")["CHEMISTRY MENU"]);
+        REQUIRE(input.CHEMISTRY_RCONST_DT == 1.0E-02);
+        Set_RCONST_Cache(0.0, 0.0);
+        KppContext exactCtx = ctx;
+        const std::vector<double> exact = rates(exactCtx, TEMP + 0.37, PRESS, H2O);
+        //As done by main at startup
+        Set_RCONST_Cache(input.CHEMISTRY_RCONST_DT, KPP_RCONST_DLOGM);
+        const std::vector<double> cached = rates(ctx, TEMP + 0.37, PRESS, H2O);
+        REQUIRE(cached != exact);
+        REQUIRE(maxRelDiff(cached, exact) < cacheRelTol);
+    }
+
+    SECTION("Resolution changed while rates are updated") {
+        //Every rate set is either exact or cached, never a mix of resolutions
+        Set_RCONST_Cache(0.0, 0.0);
+        KppContext exactCtx = ctx;
+        const std::vector<double> exact = rates(exactCtx, TEMP + 0.37, PRESS, H2O);
+        std::vector<std::thread> threads;
+        std::vector<double> maxDiff(4, 0.0);
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&, t] {
+                KppContext local = ctx;
+                for (int n = 0; n < 200; n++)
+                    maxDiff[t] = std::max(maxDiff[t], maxRelDiff(rates(local, TEMP + 0.37, PRESS, H2O), exact));
+            });
+        }
+        for (int n = 0; n < 200; n++)
+            Set_RCONST_Cache((n % 2) ? 1.0E-02 : 0.0, KPP_RCONST_DLOGM);
+        for (auto& t : threads) t.join();
+        for (double d : maxDiff) REQUIRE(d < cacheRelTol);
+    }
+
+    Set_RCONST_Cache(KPP_RCONST_DT, KPP_RCONST_DLOGM);
+}
+
+TEST_CASE("Batched KPP integration", "[single-file]") {
+    auto reference = readReference();
+
+    //Not a multiple of KPP_BATCH, so that the last batch is partial
+    const int nCells = 2 * KPP_BATCH + 1;
+    const int badCell = KPP_BATCH + 1;
+    std::vector<KppContext> cells0(nCells);
+    for (int n = 0; n < nCells; n++) {
+        KppContext& ctx = cells0[n];
+        std::copy(reference["C"].begin(), reference["C"].end(), ctx.C);
+        std::copy(reference["PHOTOL"].begin(), reference["PHOTOL"].end(), ctx.PHOTOL);
+        //Plume-like cells: more NOx and a range of temperatures
+        ctx.C[ind_NO] *= 1.0 + 10.0 * n;
+        ctx.C[ind_NO2] *= 1.0 + 10.0 * n;
+        setRates(ctx, 205.0 + 3.0 * n);
+    }
+
+    SECTION("Function and Jacobian on lanes") {
+        //Lane l of every argument is cell l
+        KppLanes V[NVAR], F[NFIX], RCT[NREACT], Vdot[NVAR], JVS[LU_NONZERO];
+        for (int l = 0; l < KPP_BATCH; l++) {
+            for (int i = 0; i < NVAR; i++) V[i][l] = cells0[l].VAR()[i];
+            for (int i = 0; i < NFIX; i++) F[i][l] = cells0[l].FIX()[i];
+            for (int i = 0; i < NREACT; i++) RCT[i][l] = cells0[l].RCONST[i];
+        }
+        Fun_Batch(V, F, RCT, Vdot);
+        Jac_SP_Batch(V, F, RCT, JVS);
+
+        for (int l = 0; l < KPP_BATCH; l++) {
+            double Vdot_l[NVAR], JVS_l[LU_NONZERO];
+            Fun(cells0[l].VAR(), cells0[l].FIX(), cells0[l].RCONST, Vdot_l);
+            Jac_SP(cells0[l].VAR(), cells0[l].FIX(), cells0[l].RCONST, JVS_l);
+            for (int i = 0; i < NVAR; i++)
+                REQUIRE(Vdot[i][l] == Catch::Approx(Vdot_l[i]).epsilon(1.0E-12));
+            for (int i = 0; i < LU_NONZERO; i++)
+                REQUIRE(JVS[i][l] == Catch::Approx(JVS_l[i]).epsilon(1.0E-12));
+        }
+    }
+
+    //The tolerances of PlumeModel, and tighter ones
+    for (const double tol : { KPP_RTOLS, 1.0E-05 }) {
+        DYNAMIC_SECTION("Batch against scalar, rel. tolerance " << tol) {
+            std::vector<KppContext> batch = cells0;
+            //A cell that cannot be integrated
+            batch[badCell].C[ind_O3] = std::nan("");
+            std::vector<KppContext> scalar = batch;
+
+            double ATOL[NVAR], RTOL[NVAR];
+            for (int i = 0; i < NVAR; i++) {
+                ATOL[i] = KPP_ATOLS;
+                RTOL[i] = tol;
+            }
+            std::vector<KppContext*> cells(nCells);
+            for (int n = 0; n < nCells; n++) cells[n] = &batch[n];
+            std::vector<int> IERR(nCells, 0);
+            INTEGRATE_BATCH(cells.data(), IERR.data(), nCells, 0.0, 600.0, ATOL, RTOL, 1.0E-10);
+
+            for (int n = 0; n < nCells; n++) {
+                const int scalarIERR = INTEGRATE(scalar[n], 0.0, 600.0, ATOL, RTOL, 1.0E-10);
+                REQUIRE(IERR[n] == scalarIERR);
+                if (n == badCell) {
+                    REQUIRE(IERR[n] < 0);
+                    continue;
+                }
+                REQUIRE(IERR[n] == 1);
+                //The two take different steps, each within the tolerances, so
+                //their results may differ by about the error allowed per step
+                for (int i = 0; i < NVAR; i++) {
+                    const double allowed = ATOL[i] + RTOL[i] * std::abs(scalar[n].VAR()[i]);
+                    REQUIRE(std::abs(batch[n].VAR()[i] - scalar[n].VAR()[i]) <= 2.0 * allowed);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Clustered KPP integration", "[single-file]") {
+    auto reference = readReference();
+
+    //Three groups of cells, each spread over much less than the tolerance
+    const UInt nCell = 12;
+    auto setupCell = [&](KppContext& ctx, const UInt iCell) {
+        std::copy(reference["C"].begin(), reference["C"].end(), ctx.C);
+        std::copy(reference["PHOTOL"].begin(), reference["PHOTOL"].end(), ctx.PHOTOL);
+        const double spread = 1.0 + 1.0E-05 * (iCell % 4);
+        ctx.C[ind_NO] *= (1.0 + 10.0 * (iCell / 4)) * spread;
+        ctx.C[ind_NO2] *= (1.0 + 10.0 * (iCell / 4)) * spread;
+        setRates(ctx, 205.0 + 10.0 * (iCell / 4));
+    };
+
+    double ATOL[NVAR], RTOL[NVAR];
+    for (int i = 0; i < NVAR; i++) {
+        ATOL[i] = 1.0E-03;
+        RTOL[i] = 1.0E-03;
+    }
+    std::vector<std::vector<double>> clustered(nCell);
+    std::vector<int> failed(nCell, 0);
+    const ChemCluster chemCluster = IntegrateClustered(nCell, 1.0E-03, 1.0E+03, setupCell,
+        [&](const UInt iCell, const double VAR[]) { clustered[iCell].assign(VAR, VAR + NVAR); },
+        [&](const KppContext&, const UInt iCell) { failed[iCell]++; },
+        0.0, 600.0, ATOL, RTOL, 1.0E-10);
+    REQUIRE(std::count(failed.begin(), failed.end(), 0) == nCell);
+    REQUIRE(chemCluster.getnCluster() < nCell);
+
+    for (UInt iCell = 0; iCell < nCell; iCell++) {
+        KppContext ctx;
+        setupCell(ctx, iCell);
+        const std::vector<double> VAR0(ctx.VAR(), ctx.VAR() + NVAR);
+        REQUIRE(INTEGRATE(ctx, 0.0, 600.0, ATOL, RTOL, 1.0E-10) == 1);
+        //A cell gets the increments of its representative, so its error
+        //scales with its initial as well as its final concentrations
+        double maxRelDiff = 0.0;
+        for (int i = 0; i < NVAR; i++) {
+            const double scale = std::max(std::abs(VAR0[i]), std::abs(ctx.VAR()[i]));
+            if (scale < 1.0E-03) continue;
+            maxRelDiff = std::max(maxRelDiff, std::abs(clustered[iCell][i] - ctx.VAR()[i]) / scale);
+        }
+        //Within the clustering tolerance
+        REQUIRE(maxRelDiff < 1.0E-03);
+    }
+}
+
+TEST_CASE("Clustered KPP integration with failed clusters", "[single-file]") {
+    auto reference = readReference();
+
+    //The second half of the cells cannot be integrated
+    const UInt nCell = 8;
+    auto setupCell = [&](KppContext& ctx, const UInt iCell) {
+        std::copy(reference["C"].begin(), reference["C"].end(), ctx.C);
+        std::copy(reference["PHOTOL"].begin(), reference["PHOTOL"].end(), ctx.PHOTOL);
+        setRates(ctx);
+        if (iCell >= nCell / 2) for (int i = 0; i < NREACT; i++) ctx.RCONST[i] *= 1.0E+250;
+    };
+
+    double ATOL[NVAR], RTOL[NVAR];
+    for (int i = 0; i < NVAR; i++) {
+        ATOL[i] = 1.0E-03;
+        RTOL[i] = 1.0E-03;
+    }
+    //Cells are applied from several threads: each one only sets its own flag
+    std::vector<int> applied(nCell, 0), failed(nCell, 0);
+    const ChemCluster chemCluster = IntegrateClustered(nCell, 1.0E-03, 1.0E+03, setupCell,
+        [&](const UInt iCell, const double[]) { applied[iCell]++; },
+        [&](const KppContext&, const UInt iCell) { failed[iCell]++; },
+        0.0, 600.0, ATOL, RTOL, 1.0E-10);
+    REQUIRE(chemCluster.getnCluster() == 2);
+    //Every cell of the failed cluster was integrated on its own, and failed
+    REQUIRE(applied == std::vector<int>{1, 1, 1, 1, 1, 1, 1, 1});
+    REQUIRE(failed == std::vector<int>{0, 0, 0, 0, 1, 1, 1, 1});
+}
+
+TEST_CASE("KPP adjoint", "[single-file]") {
+    auto reference = readReference();
+
+    KppContext ctx;
+    std::copy(reference["C"].begin(), reference["C"].end(), ctx.C);
+    std::copy(reference["PHOTOL"].begin(), reference["PHOTOL"].end(), ctx.PHOTOL);
+    setRates(ctx);
+
+    double ATOL[NVAR], RTOL[NVAR], ATOL_adj[1][NVAR], RTOL_adj[1][NVAR];
+    for (int i = 0; i < NVAR; i++) {
+        ATOL[i] = 1.0;
+        RTOL[i] = 1.0E-03;
+        ATOL_adj[0][i] = 1.0E-06;
+        RTOL_adj[0][i] = 1.0E-06;
+    }
+
+    //Final O3 after TOUT, with its gradient wrt the initial concentrations
+    //when gradient is given, using nCheck checkpoints. The first step is tried
+    //over the whole interval rather than from a tiny one
+    auto finalO3 = [&](double TOUT, const KppContext& init, std::vector<double>* gradient = nullptr, int nCheck = 0) {
+        KppContext adjKPP = init;
+        double Y[NVAR], Lambda[1][NVAR] = {};
+        std::copy(adjKPP.C, adjKPP.C + NVAR, Y);
+        Lambda[0][ind_O3] = 1.0;
+        int ICNTRL[20] = {};
+        double RCNTRL[20] = {};
+        ICNTRL[8] = nCheck;
+        REQUIRE(INTEGRATE_ADJ(adjKPP, 1, Y, Lambda, 0.0, TOUT, ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, nullptr, nullptr, TOUT) == 1);
+        if (gradient) gradient->assign(Lambda[0], Lambda[0] + NVAR);
+        return Y[ind_O3];
+    };
+    //Centered finite difference of the final O3 wrt the initial concentration of species iSpec
+    auto finiteDiff = [&](double TOUT, int iSpec) {
+        const double h = 1.0E-03 * ctx.C[iSpec];
+        KppContext up = ctx, down = ctx;
+        up.C[iSpec] += h;
+        down.C[iSpec] -= h;
+        return (finalO3(TOUT, up) - finalO3(TOUT, down)) / (2.0 * h);
+    };
+
+    SECTION("Matches finite differences over the first few steps") {
+        //Over a few steps, leaving out any of them shows
+        std::vector<double> gradient;
+        finalO3(1.0, ctx, &gradient);
+        for (int iSpec : {ind_NO, ind_NO2}) REQUIRE(gradient[iSpec] == Catch::Approx(finiteDiff(1.0, iSpec)).epsilon(1.0E-04));
+    }
+
+    SECTION("Checkpointed and stored trajectories give the same gradient") {
+        std::vector<double> stored;
+        const double O3 = finalO3(600.0, ctx, &stored);
+        for (int nCheck : {1, 3, 10}) {
+            std::vector<double> checkpointed;
+            REQUIRE(finalO3(600.0, ctx, &checkpointed, nCheck) == O3);
+            for (int i = 0; i < NVAR; i++) REQUIRE(checkpointed[i] == Catch::Approx(stored[i]).epsilon(1.0E-12));
+        }
+        //Spot check against finite differences
+        REQUIRE(stored[ind_NO] == Catch::Approx(finiteDiff(600.0, ind_NO)).epsilon(1.0E-03));
+    }
+}
+
+TEST_CASE("Box model run", "[single-file]") {
+    auto reference = readReference();
+
+    KppContext ambient;
+    std::copy(reference["C"].begin(), reference["C"].end(), ambient.C);
+    std::copy(reference["PHOTOL"].begin(), reference["PHOTOL"].end(), ambient.PHOTOL);
+
+    //Default inner ring of the plume model in a 10 km x 1 km domain
+    BoxPlume plume;
+    plume.sigmaX = 73.796;
+    plume.sigmaY = 27.361;
+    plume.horizDiff = 15.0;
+    plume.vertiDiff = 0.15;
+    plume.maxArea = 1.0E+07;
+
+    double ATOL[NVAR], RTOL[NVAR];
+    for (int i = 0; i < NVAR; i++) {
+        ATOL[i] = 1.0E-03;
+        RTOL[i] = 1.0E-06;
+    }
+    std::vector<double> timeArray;
+    for (int n = 0; n <= 12; n++) timeArray.push_back(600.0 * n);
+    auto rates = [](KppContext& ctx, double, double) { setRates(ctx); };
+
+    SECTION("Cross-section") {
+        REQUIRE(plume.area(0.0) == Catch::Approx(M_PI * 73.796 * 27.361));
+        REQUIRE(plume.area(3600.0) > plume.area(600.0));
+        REQUIRE(plume.area(1.0E+09) == plume.maxArea);
+    }
+
+    SECTION("Without emissions the box follows the ambient air") {
+        KppContext box = ambient, amb = ambient;
+        Vector_2D boxSpecies(NVAR, Vector_1D(timeArray.size(), 0.0));
+        REQUIRE(BoxIntegrate(box, amb, plume, timeArray, rates, ATOL, RTOL, boxSpecies) >= 0);
+        for (int i = 0; i < NVAR; i++) {
+            REQUIRE(box.C[i] == Catch::Approx(amb.C[i]).epsilon(1.0E-12));
+            REQUIRE(boxSpecies[i].back() == box.C[i]);
+        }
+    }
+
+    SECTION("Emissions are diluted as the box spreads") {
+        //CO2 over the ambient air, which the chemistry barely changes
+        KppContext box = ambient, amb = ambient;
+        box.C[ind_CO2] += 1.0E+14;
+        box.C[ind_NO] += 1.0E+10;
+        Vector_2D boxSpecies(NVAR, Vector_1D(timeArray.size(), 0.0));
+        REQUIRE(BoxIntegrate(box, amb, plume, timeArray, rates, ATOL, RTOL, boxSpecies) >= 0);
+        REQUIRE(boxSpecies[ind_CO2][0] == ambient.C[ind_CO2] + 1.0E+14);
+        for (std::size_t n = 1; n < timeArray.size(); n++) {
+            const double excess = boxSpecies[ind_CO2][n] - amb.C[ind_CO2];
+            REQUIRE(excess == Catch::Approx(1.0E+14 * plume.area(0.0) / plume.area(timeArray[n])).epsilon(1.0E-03));
+        }
+        //The emitted NOx stays above the ambient levels
+        REQUIRE(box.C[ind_NO] + box.C[ind_NO2] > amb.C[ind_NO] + amb.C[ind_NO2]);
+    }
+}
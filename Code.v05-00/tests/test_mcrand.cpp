@@ -0,0 +1,40 @@
+#include "Util/MC_Rand.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+TEST_CASE("Counter-based random numbers", "[single-file]") {
+    SECTION("Philox4x32-10 known answers") {
+        //Known-answer tests of the Random123 distribution
+        REQUIRE(philox4x32({0, 0, 0, 0}, {0, 0}) == RandCounter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+        REQUIRE(philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff})
+                == RandCounter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+        REQUIRE(philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0})
+                == RandCounter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+    }
+
+    SECTION("Uniform numbers") {
+        REQUIRE(uniform01(0, 0) == 0.0);
+        REQUIRE(uniform01(0xffffffff, 0xffffffff) < 1.0);
+        const RandKey key = randKey(42);
+        double sum = 0;
+        const int n = 10000;
+        for (int i = 0; i < n; i++) {
+            double x = fRand(-1.0, 1.0, key, {(std::uint32_t) i, 0, 0, 0});
+            REQUIRE(x >= -1.0);
+            REQUIRE(x < 1.0);
+            sum += x;
+        }
+        REQUIRE(std::abs(sum / n) < 0.05);
+        //Same counter and key, same number
+        REQUIRE(fRand(-1.0, 1.0, key, {7, 0, 0, 0}) == fRand(-1.0, 1.0, randKey(42), {7, 0, 0, 0}));
+        REQUIRE(fRand(-1.0, 1.0, key, {7, 0, 0, 0}) != fRand(-1.0, 1.0, randKey(43), {7, 0, 0, 0}));
+    }
+
+    SECTION("Stream ids are stable") {
+        //FNV-1a reference values
+        REQUIRE(randStream("") == 0x811c9dc5);
+        REQUIRE(randStream("a") == 0xe40c292c);
+        REQUIRE(randStream("Temperature [K] (double)") == randStream("Temperature [K] (double)"));
+        REQUIRE(randStream("Temperature [K] (double)") != randStream("Pressure [hPa] (double)"));
+    }
+}
@@ -0,0 +1,30 @@
+#include "Core/MetDataset.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+
+TEST_CASE("Shared met dataset", "[single-file]") {
+    std::string fileName = std::string(APCEMM_TESTS_DIR)+"/test_meteorology_metfile.nc";
+    auto first = MetDataset::Get(fileName);
+
+    SECTION("Each file is decoded once and shared") {
+        auto second = MetDataset::Get(fileName);
+        REQUIRE(first == second);
+        REQUIRE(first->fileName() == fileName);
+    }
+
+    SECTION("Profiles are stored on the file's altitude grid") {
+        REQUIRE(first->altitudeDim() > 0);
+        REQUIRE(first->pressure().size() == first->altitude().size());
+        REQUIRE(first->hasProfile("temperature"));
+        const MetDataset::Profile& temp = first->profile("temperature");
+        REQUIRE(temp.data.size() == first->altitude().size());
+        REQUIRE(temp.data[0].size() == (temp.timeseries ? first->timeDim() : 1));
+    }
+
+    SECTION("Missing variables are reported") {
+        REQUIRE_FALSE(first->hasProfile("not_a_met_variable"));
+        REQUIRE_THROWS_AS(first->profile("not_a_met_variable"), std::runtime_error);
+        REQUIRE_THROWS_AS(MetDataset::Get(fileName + ".missing"), std::runtime_error);
+    }
+}
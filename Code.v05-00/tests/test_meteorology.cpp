@@ -0,0 +1,89 @@
+#include "Core/Meteorology.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <string>
+
+namespace {
+    //Uniform grid of ny cells over [-halfHeight, halfHeight]
+    void makeGrid(int ny, double halfHeight, Vector_1D& y, Vector_1D& yE) {
+        const double dy = 2.0 * halfHeight / ny;
+        y.resize(ny);
+        yE.resize(ny + 1);
+        for (int j = 0; j <= ny; j++) yE[j] = -halfHeight + dy * j;
+        for (int j = 0; j < ny; j++) y[j] = 0.5 * (yE[j] + yE[j + 1]);
+    }
+
+    OptInput noMetInput() {
+        OptInput opt;
+        opt.ADV_GRID_NX = 4;
+        opt.ADV_GRID_NY = 10;
+        opt.MET_LOADMET = false;
+        opt.MET_DT = 1.0;
+        opt.MET_INTERPTEMPDATA = true;
+        opt.MET_INTERPRHDATA = true;
+        opt.MET_INTERPSHEARDATA = true;
+        opt.MET_INTERPVERTVELOC = true;
+        opt.MET_FIXDEPTH = false;
+        opt.MET_DEPTH = 200.0;
+        opt.MET_LAPSERATE = -3.0E-03;
+        opt.MET_SUBSAT_RHI = 80.0;
+        opt.MET_DIURNAL = false;
+        opt.MET_TEMP_PERTURB_AMPLITUDE = 0.0;
+        opt.MET_HUMIDSCAL_MODIFICATION_SCHEME = "none";
+        opt.SIMULATION_RANDOM_SEED = 0;
+        return opt;
+    }
+}
+
+TEST_CASE("Meteorology regenerated on a new grid", "[single-file]") {
+    AmbientMetParams amb;
+    amb.solarTime_h = 12.0;
+    amb.temp_K = 217.0;
+    amb.press_Pa = 24000.0;
+    amb.rhi = 110.0;
+    amb.shear = 2.0E-03;
+
+    Vector_1D y, yE, yNew, yENew;
+    makeGrid(10, 500.0, y, yE);
+    makeGrid(20, 1000.0, yNew, yENew);
+
+    SECTION("Without met input") {
+        OptInput opt = noMetInput();
+        Meteorology met(opt, amb, y, yE);
+        met.regenerate(yNew, yENew, 6);
+
+        //Same profiles as if built on the new grid
+        opt.ADV_GRID_NX = 6;
+        opt.ADV_GRID_NY = 20;
+        const Meteorology fresh(opt, amb, yNew, yENew);
+        REQUIRE(met.Shear().size() == 20);
+        for (int j = 0; j < 20; j++) {
+            REQUIRE(met.shear(j) == amb.shear);
+            REQUIRE(met.alt(j) == Catch::Approx(fresh.alt(j)));
+            REQUIRE(met.tempBase()[j] == Catch::Approx(fresh.tempBase()[j]));
+            REQUIRE(met.H2O_1D()[j] == Catch::Approx(fresh.H2O_1D()[j]));
+        }
+        REQUIRE(met.Temp().size() == 20);
+        REQUIRE(met.Temp()[0].size() == 6);
+    }
+
+    SECTION("With met input but without met shear") {
+        OptInput opt = noMetInput();
+        opt.MET_LOADMET = true;
+        opt.MET_FILENAME = std::string(APCEMM_TESTS_DIR) + "/test_meteorology_metfile.nc";
+        opt.MET_LOADTEMP = true;
+        opt.MET_TEMPTIMESERIES = true;
+        opt.MET_LOADRH = true;
+        opt.MET_RHTIMESERIES = true;
+        opt.MET_LOADSHEAR = false;
+        opt.MET_SHEARTIMESERIES = false;
+        opt.MET_LOADVERTVELOC = false;
+        opt.MET_VERTVELOCTIMESERIES = false;
+        Meteorology met(opt, amb, y, yE);
+        met.regenerate(yNew, yENew, 6);
+
+        REQUIRE(met.Shear().size() == 20);
+        for (int j = 0; j < 20; j++) REQUIRE(met.shear(j) == amb.shear);
+        REQUIRE(met.tempBase().size() == 20);
+    }
+}
@@ -0,0 +1,92 @@
+#include "Core/OutputWriter.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("I/O thread", "[single-file]") {
+    SECTION("Jobs run one at a time in submission order") {
+        OutputWriter writer;
+        std::vector<int> order;
+        std::vector<std::future<void>> done;
+        for (int i = 0; i < 100; i++) done.push_back(writer.Submit([&order, i] { order.push_back(i); }));
+        for (auto& f : done) f.get();
+        REQUIRE(order.size() == 100);
+        for (int i = 0; i < 100; i++) REQUIRE(order[i] == i);
+    }
+
+    SECTION("Futures complete when the job has run") {
+        OutputWriter writer;
+        std::atomic<bool> gate{false}, ran{false};
+        std::future<void> done = writer.Submit([&] {
+            while (!gate) std::this_thread::yield();
+            ran = true;
+        });
+        REQUIRE(done.wait_for(std::chrono::milliseconds(20)) == std::future_status::timeout);
+        gate = true;
+        done.get();
+        REQUIRE(ran);
+    }
+
+    SECTION("Jobs run on the I/O thread and run nested jobs in place") {
+        OutputWriter writer;
+        std::thread::id outer, inner;
+        std::vector<int> order;
+        writer.Run([&] {
+            outer = std::this_thread::get_id();
+            order.push_back(0);
+            //Would deadlock if it were queued behind the running job
+            writer.Run([&] {
+                inner = std::this_thread::get_id();
+                order.push_back(1);
+            });
+            order.push_back(2);
+        });
+        REQUIRE(outer != std::this_thread::get_id());
+        REQUIRE(inner == outer);
+        REQUIRE(order == std::vector<int>{0, 1, 2});
+    }
+
+    SECTION("Exceptions are passed back to the caller") {
+        OutputWriter writer;
+        REQUIRE_THROWS_AS(writer.Run([] { throw std::runtime_error("write failed"); }), std::runtime_error);
+        std::future<void> done = writer.Submit([] { throw std::invalid_argument("bad file"); });
+        REQUIRE_THROWS_AS(done.get(), std::invalid_argument);
+        //The thread keeps going after a failed job
+        bool ran = false;
+        writer.Run([&] { ran = true; });
+        REQUIRE(ran);
+    }
+
+    SECTION("Destruction runs the queued jobs") {
+        std::atomic<int> count{0};
+        {
+            OutputWriter writer;
+            for (int i = 0; i < 20; i++) {
+                writer.Submit([&count] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    count++;
+                });
+            }
+        }
+        REQUIRE(count == 20);
+    }
+
+    SECTION("A job can destroy its writer") {
+        OutputWriter* writer = new OutputWriter();
+        std::atomic<bool> gate{false};
+        std::future<void> destroyed = writer->Submit([&] {
+            while (!gate) std::this_thread::yield();
+            delete writer;
+        });
+        //Queued behind the job that destroys the writer, still run
+        bool ran = false;
+        std::future<void> after = writer->Submit([&] { ran = true; });
+        gate = true;
+        destroyed.get();
+        after.get();
+        REQUIRE(ran);
+    }
+}
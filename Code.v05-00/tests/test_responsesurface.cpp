@@ -0,0 +1,122 @@
+#include "EPM/ResponseSurface.hpp"
+#include "Util/ForwardDecl.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <cmath>
+#include <cstdio>
+
+using namespace EPM;
+
+namespace {
+    Vector_1D binCenters = {1.0E-07, 1.0E-06, 1.0E-05};
+    Vector_1D binEdges = {5.0E-08, 5.0E-07, 5.0E-06, 5.0E-05};
+
+    //Fake EPM: linear in T and RHw, quadratic in P, no persistence below 230 K
+    ResponseSurface::NodeResult fakeEPM(const ResponseSurface::Point& p) {
+        EPMOutput out;
+        out.finalTemp = p[0];
+        out.iceRadius = 1.0E-06 * (1.0 + 0.01 * p[2]);
+        out.iceDensity = 100.0 + 2.0 * p[0] + 1.0E-08 * p[1] * p[1];
+        out.sootDensity = 0.0;
+        out.H2O_mol = p[2];
+        out.SO4g_mol = 1.0;
+        out.SO4l_mol = 1.0;
+        out.area = 10.0 + p[3];
+        out.bypassArea = p[5];
+        out.coreExitTemp = p[6];
+        out.SO4Aer = AIM::Aerosol(binCenters, binEdges, 1.0, 1.0E-06, 1.5);
+        out.IceAer = AIM::Aerosol(binCenters, binEdges, out.iceDensity, 1.0E-06, 1.5);
+        return std::make_pair(out, p[0] < 230.0 ? SimStatus::EPMSuccess : SimStatus::NoPersistence);
+    }
+}
+
+TEST_CASE("EPM response surface", "[single-file]") {
+    std::array<Vector_1D, ResponseSurface::NDIM> axes = {
+        Vector_1D{210.0, 215.0, 220.0, 225.0, 230.0},
+        Vector_1D{20000.0, 25000.0, 30000.0},
+        Vector_1D{60.0, 80.0},
+        Vector_1D{0.08},
+        Vector_1D{2.0E-08},
+        Vector_1D{1.804},
+        Vector_1D{547.3}
+    };
+    const std::string context = "engine=GEnx-2B67B EI_NOx=15.14 backgNOx=5.1e-11";
+    ResponseSurface table = ResponseSurface::build(axes, fakeEPM, context);
+    REQUIRE(table.size() == 30);
+
+    ResponseSurface::Point query = {217.0, 22000.0, 70.0, 0.08, 2.0E-08, 1.804, 547.3};
+
+    SECTION("Interpolation") {
+        auto result = table.interpolate(query);
+        REQUIRE(result);
+        REQUIRE(result->status == SimStatus::EPMSuccess);
+        REQUIRE(result->output.finalTemp == Catch::Approx(217.0));
+        REQUIRE(result->output.iceRadius == Catch::Approx(1.7E-06));
+        REQUIRE(result->output.IceAer.Moment() == Catch::Approx(AIM::Aerosol(binCenters, binEdges, result->output.iceDensity, 1.0E-06, 1.5).Moment()));
+
+        //Only the pressure dependence is curved: (22000 - 20000) * (25000 - 22000) / 2 * 2e-8
+        const double exactDensity = 100.0 + 2.0 * 217.0 + 1.0E-08 * 22000.0 * 22000.0;
+        const double expectedError = 0.5 * 2000.0 * 3000.0 * 2.0E-08 / result->output.iceDensity;
+        REQUIRE(result->relError == Catch::Approx(expectedError));
+        REQUIRE(std::abs(result->output.iceDensity - exactDensity) / exactDensity == Catch::Approx(expectedError).epsilon(0.01));
+        REQUIRE_FALSE(table.interpolate(query, 0.5 * expectedError));
+    }
+
+    SECTION("Nodes are reproduced exactly") {
+        ResponseSurface::Point node = {215.0, 25000.0, 80.0, 0.08, 2.0E-08, 1.804, 547.3};
+        auto result = table.interpolate(node);
+        REQUIRE(result);
+        REQUIRE(result->output.iceDensity == fakeEPM(node).first.iceDensity);
+        REQUIRE(result->relError == 0.0);
+    }
+
+    SECTION("Fallbacks") {
+        //Outside of the table
+        query[0] = 205.0;
+        REQUIRE_FALSE(table.interpolate(query));
+        query[0] = 217.0;
+        query[3] = 0.1;
+        REQUIRE_FALSE(table.interpolate(query));
+        query[3] = 0.08;
+        //Regime change across the cell
+        query[0] = 227.0;
+        REQUIRE_FALSE(table.interpolate(query));
+        //Cell is fine but the curvature stencil reaches into the other regime
+        query[0] = 224.0;
+        REQUIRE_FALSE(table.interpolate(query));
+        //Exactly on a failed node
+        query[0] = 230.0;
+        auto result = table.interpolate(query);
+        REQUIRE(result);
+        REQUIRE(result->status == SimStatus::NoPersistence);
+    }
+
+    SECTION("Scattered points must cover a grid") {
+        std::vector<ResponseSurface::Point> points = {query, query, query};
+        points[1][0] = 220.0;
+        points[2][1] = 25000.0;
+        std::vector<ResponseSurface::NodeResult> results = {fakeEPM(points[0]), fakeEPM(points[1]), fakeEPM(points[2])};
+        REQUIRE_THROWS_AS(ResponseSurface(points, results), std::invalid_argument);
+        //Repeated points are fine
+        points[2] = points[0];
+        REQUIRE(ResponseSurface(points, results).size() == 2);
+    }
+
+    SECTION("Read/write") {
+        const std::string fileName = "test_epm_table.bin";
+        table.write(fileName);
+        auto loaded = ResponseSurface::load(fileName, context);
+        REQUIRE(loaded == ResponseSurface::load(fileName, context));
+        REQUIRE(loaded->size() == table.size());
+        REQUIRE(loaded->context() == context);
+        //Tables built for other aircraft, fuel, EIs or background are rejected
+        REQUIRE_THROWS_AS(ResponseSurface::load(fileName, "engine=GEnx-2B67B EI_NOx=12.0 backgNOx=5.1e-11"), std::runtime_error);
+        auto result = loaded->interpolate(query);
+        auto expected = table.interpolate(query);
+        REQUIRE(result);
+        REQUIRE(result->output.iceDensity == expected->output.iceDensity);
+        REQUIRE(result->output.IceAer.getPDF() == expected->output.IceAer.getPDF());
+        REQUIRE(result->relError == expected->relError);
+        std::remove(fileName.c_str());
+    }
+}
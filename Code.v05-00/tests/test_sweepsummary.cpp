@@ -0,0 +1,56 @@
+#include "Core/SweepSummary.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <netcdf>
+
+TEST_CASE("Sweep summary file", "[single-file]") {
+    const std::string fileName = (std::filesystem::temp_directory_path() / "test_sweep_summary.nc").string();
+    std::vector<std::unordered_map<std::string, double>> parameters = {
+        {{"TEMPERATURE", 210.0}, {"RHW", 60.0}},
+        {{"TEMPERATURE", 220.0}, {"RHW", 70.0}},
+        {{"TEMPERATURE", 230.0}, {"RHW", 80.0}} };
+
+    {
+        SweepSummary summary(fileName, parameters);
+        //Cases write their records independently of each other
+        summary.Record(1, 0.0, SweepSummary::Scalars{1.0, 10.0, 100.0, 50.0, 0.1});
+        summary.Record(0, 0.0, SweepSummary::Scalars{2.0, 20.0, 200.0, 60.0, 0.2});
+        summary.Record(1, 0.5, SweepSummary::Scalars{3.0, 30.0, 300.0, 70.0, 0.3});
+        summary.SetStatus(1, SimStatus::Complete);
+        summary.SetStatus(0, SimStatus::NoPersistence);
+    }
+
+    netCDF::NcFile file(fileName, netCDF::NcFile::read);
+    REQUIRE(file.getDim("case").getSize() == 3);
+    REQUIRE(file.getDim("t").getSize() == 2);
+
+    double temperature[3];
+    file.getVar("TEMPERATURE").getVar(temperature);
+    REQUIRE(temperature[2] == 230.0);
+
+    int nt[3], status[3];
+    file.getVar("nt").getVar(nt);
+    file.getVar("status").getVar(status);
+    REQUIRE(nt[0] == 1);
+    REQUIRE(nt[1] == 2);
+    REQUIRE(nt[2] == 0);
+    REQUIRE(status[0] == (int) SimStatus::NoPersistence);
+    REQUIRE(status[1] == (int) SimStatus::Complete);
+    REQUIRE(status[2] == -1);
+
+    float t[6], width[6];
+    file.getVar("t").getVar(t);
+    file.getVar("width").getVar(width);
+    REQUIRE(t[3] == Catch::Approx(0.5));
+    REQUIRE(width[0] == Catch::Approx(200.0));
+    REQUIRE(width[3] == Catch::Approx(300.0));
+    //Records a case did not write are missing
+    REQUIRE(std::isnan(width[1]));
+    REQUIRE(std::isnan(width[4]));
+
+    file.close();
+    std::remove(fileName.c_str());
+}
@@ -0,0 +1,161 @@
+#include "Core/Diag_Mod.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <netcdf.h>
+
+namespace {
+    //Uniform grid of n cells of width d centered on 0
+    void makeAxis(int n, double d, Vector_1D& centers, Vector_1D& edges) {
+        centers.resize(n);
+        edges.resize(n + 1);
+        for (int i = 0; i <= n; i++) edges[i] = d * (i - 0.5 * n);
+        for (int i = 0; i < n; i++) centers[i] = 0.5 * (edges[i] + edges[i + 1]);
+    }
+
+    OptInput noMetInput(int nx, int ny) {
+        OptInput opt;
+        opt.ADV_GRID_NX = nx;
+        opt.ADV_GRID_NY = ny;
+        opt.MET_LOADMET = false;
+        opt.MET_DT = 1.0;
+        opt.MET_INTERPTEMPDATA = true;
+        opt.MET_INTERPRHDATA = true;
+        opt.MET_INTERPSHEARDATA = true;
+        opt.MET_INTERPVERTVELOC = true;
+        opt.MET_FIXDEPTH = false;
+        opt.MET_DEPTH = 200.0;
+        opt.MET_LAPSERATE = -3.0E-03;
+        opt.MET_SUBSAT_RHI = 80.0;
+        opt.MET_DIURNAL = false;
+        opt.MET_TEMP_PERTURB_AMPLITUDE = 0.0;
+        opt.MET_HUMIDSCAL_MODIFICATION_SCHEME = "none";
+        opt.SIMULATION_RANDOM_SEED = 0;
+        return opt;
+    }
+}
+
+TEST_CASE("Aerosol timeseries output options", "[single-file]") {
+    SECTION("Variable selection and significant digits") {
+        Diag::TSOutputOptions options;
+        REQUIRE(options.wants("IWC"));
+        REQUIRE(options.digits("IWC") == 0);
+
+        options.vars = {"IWC", "RHi"};
+        options.sigDigits = {{"all", 3}, {"H2O", 5}};
+        REQUIRE(options.wants("RHi"));
+        REQUIRE_FALSE(options.wants("H2O"));
+        REQUIRE(options.digits("H2O") == 5);
+        REQUIRE(options.digits("IWC") == 3);
+    }
+    SECTION("Bit grooming keeps the requested precision") {
+        std::vector<float> values;
+        for (int i = 0; i < 1000; i++)
+            values.push_back(std::pow(1.37f, (float) (i % 97) - 48.0f) * (i % 2 == 0 ? 1.0f : -1.0f));
+        values.push_back(0.0f);
+        values.push_back(NAN);
+        std::vector<float> groomed = values;
+
+        Diag::GroomFloats(groomed.data(), groomed.size(), 3);
+        for (size_t i = 0; i < 1000; i++)
+            REQUIRE(std::abs(groomed[i] - values[i]) <= 5.0E-04 * std::abs(values[i]));
+        REQUIRE(groomed[1000] == 0.0f);
+        REQUIRE(std::isnan(groomed[1001]));
+
+        //Nothing to remove at full precision
+        groomed = values;
+        Diag::GroomFloats(groomed.data(), groomed.size(), 7);
+        REQUIRE(groomed[5] == values[5]);
+    }
+}
+
+TEST_CASE("Aerosol timeseries in a single file", "[single-file]") {
+    SECTION("File name of the series") {
+        REQUIRE(Diag::TSSeriesFileName("out/ts_aerosol_hhmm.nc") == "out/ts_aerosol_series.nc");
+        REQUIRE(Diag::TSSeriesFileName("out/ts_aerosol_hhmmss.nc") == "out/ts_aerosol_series.nc");
+        REQUIRE(Diag::TSSeriesFileName("ts_hhmm.nc") == "ts_series.nc");
+    }
+
+    SECTION("Records on grids of different sizes") {
+        const int nBin = 8;
+        Vector_1D binCenters(nBin), binEdges(nBin + 1);
+        for (int i = 0; i <= nBin; i++) binEdges[i] = 1.0E-07 * std::pow(2.0, i);
+        for (int i = 0; i < nBin; i++) binCenters[i] = 0.5 * (binEdges[i] + binEdges[i + 1]);
+
+        AmbientMetParams amb;
+        amb.solarTime_h = 12.0;
+        amb.temp_K = 217.0;
+        amb.press_Pa = 24000.0;
+        amb.rhi = 110.0;
+        amb.shear = 2.0E-03;
+
+        //Grid of each record: nx cells of 100 m by ny cells of 50 m
+        const std::vector<int> NX{4, 6, 3};
+        const std::vector<int> NY{3, 5, 2};
+        const int nxMax = 6;
+        const int nyMax = 5;
+        const std::string fileName = (std::filesystem::temp_directory_path() / "test_tsoutput_series.nc").string();
+        std::vector<Vector_1D> xCenters(3), yCenters(3);
+        {
+            AIM::Grid_Aerosol ice0(NX[0], NY[0], binCenters, binEdges, 1.0E+02, 5.0E-06, 1.6);
+            Diag::TSPhysFile file(fileName, ice0);
+            for (int iT = 0; iT < 3; iT++) {
+                Vector_1D xEdges, yEdges;
+                makeAxis(NX[iT], 100.0, xCenters[iT], xEdges);
+                makeAxis(NY[iT], 50.0, yCenters[iT], yEdges);
+                const AIM::Grid_Aerosol ice(NX[iT], NY[iT], binCenters, binEdges, 1.0E+02, 5.0E-06, 1.6);
+                const Meteorology met(noMetInput(NX[iT], NY[iT]), amb, yCenters[iT], yEdges);
+                //H2O of cell (j, i) in record iT
+                Vector_2D H2O(NY[iT], Vector_1D(NX[iT]));
+                for (int j = 0; j < NY[iT]; j++)
+                    for (int i = 0; i < NX[iT]; i++) H2O[j][i] = 1.0E+14 * (iT + 1) + 1.0E+12 * j + 1.0E+10 * i;
+                file.Append(iT, 0, 0, ice, H2O, xCenters[iT], yCenters[iT], xEdges, yEdges, met);
+            }
+            REQUIRE(file.nRecord() == 3);
+        }
+
+        netCDF::NcFile file(fileName, netCDF::NcFile::read);
+        REQUIRE(file.getDim("t").getSize() == 3);
+        REQUIRE(file.getDim("x").getSize() == nxMax);
+        REQUIRE(file.getDim("y").getSize() == nyMax);
+
+        //Extent of each record's own grid
+        std::vector<int> nx(3), ny(3);
+        file.getVar("nx").getVar(nx.data());
+        file.getVar("ny").getVar(ny.data());
+        REQUIRE(nx == NX);
+        REQUIRE(ny == NY);
+
+        //Cell centers of each record, padded beyond its grid
+        std::vector<float> x(3 * nxMax), y(3 * nyMax);
+        file.getVar("x_centers").getVar(x.data());
+        file.getVar("y_centers").getVar(y.data());
+        for (int iT = 0; iT < 3; iT++) {
+            for (int i = 0; i < nxMax; i++) {
+                if (i < NX[iT]) REQUIRE(x[iT * nxMax + i] == Catch::Approx(xCenters[iT][i]));
+                else REQUIRE(x[iT * nxMax + i] == NC_FILL_FLOAT);
+            }
+            for (int j = 0; j < nyMax; j++) {
+                if (j < NY[iT]) REQUIRE(y[iT * nyMax + j] == Catch::Approx(yCenters[iT][j]));
+                else REQUIRE(y[iT * nyMax + j] == NC_FILL_FLOAT);
+            }
+        }
+
+        //2D fields are padded the same way
+        std::vector<float> H2O(3 * nyMax * nxMax);
+        file.getVar("H2O").getVar(H2O.data());
+        for (int iT = 0; iT < 3; iT++) {
+            for (int j = 0; j < nyMax; j++) {
+                for (int i = 0; i < nxMax; i++) {
+                    const float value = H2O[(iT * nyMax + j) * nxMax + i];
+                    if (j < NY[iT] && i < NX[iT]) REQUIRE(value == Catch::Approx(1.0E+14 * (iT + 1) + 1.0E+12 * j + 1.0E+10 * i));
+                    else REQUIRE(value == NC_FILL_FLOAT);
+                }
+            }
+        }
+        file.close();
+        std::remove(fileName.c_str());
+    }
+}
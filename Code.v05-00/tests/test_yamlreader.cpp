@@ -130,6 +130,10 @@ TEST_CASE("YamlInputReader Helper Functions"){
             REQUIRE (d >= 20);
             REQUIRE (d <= 40);
         }
+        //Samples only depend on the seed and the parameter
+        REQUIRE(parseParamSweepInput(teststr, "", true, 10) == vec);
+        REQUIRE(parseParamSweepInput(teststr, "", true, 10, 1) != vec);
+        REQUIRE(parseParamSweepInput(teststr, "Temperature [K] (double)", true, 10) != vec);
         //Parameter sweep min:step:max case
         teststr = " 20 : 5.0 : 40 "; // results in 20 25 30 35 40 (length 5)
         vec = parseParamSweepInput(teststr);
@@ -201,17 +205,21 @@ TEST_CASE("Read Yaml File"){
         REQUIRE(input.SIMULATION_PARAMETER_SWEEP == true);
         REQUIRE(input.SIMULATION_MONTECARLO == true);
         REQUIRE(input.SIMULATION_MCRUNS == 2);
+        REQUIRE(input.SIMULATION_RANDOM_SEED == 0);
         //REQUIRE(input.SIMULATION_OUTPUT_FOLDER == "./");
         REQUIRE(input.SIMULATION_OVERWRITE == true);
+        REQUIRE(input.SIMULATION_SUMMARY_FILENAME == "");
         REQUIRE(input.SIMULATION_THREADED_FFT == true);
         REQUIRE(input.SIMULATION_USE_FFTW_WISDOM == true);
         //REQUIRE(input.SIMULATION_DIRECTORY_W_WRITE_PERMISSION == "./");
         //REQUIRE(input.SIMULATION_INPUT_BACKG_COND == "../../input_data/init.txt");
         //REQUIRE(input.SIMULATION_INPUT_ENG_EI == "../../input_data/ENG_EI.txt");
+        REQUIRE(input.SIMULATION_PRECOMPILE_INPUTS);
         REQUIRE(input.SIMULATION_SAVE_FORWARD == true);
         REQUIRE(input.SIMULATION_FORWARD_FILENAME == "APCEMM_Case_*");
         REQUIRE(input.SIMULATION_ADJOINT == true);
         REQUIRE(input.SIMULATION_ADJOINT_FILENAME == "APCEMM_ADJ_Case_*");
+        REQUIRE(input.SIMULATION_ADJOINT_CHECKPOINT_MB == 0);
         REQUIRE(input.SIMULATION_BOXMODEL == true);
         REQUIRE(input.SIMULATION_BOX_FILENAME == "APCEMM_BOX_CASE_*");
         REQUIRE(err == "In Simulation Menu: Parameter sweep and Monte Carlo cannot have the same value!");
@@ -219,6 +227,7 @@ TEST_CASE("Read Yaml File"){
     }
     SECTION("Read Param Menu"){
         OptInput input;
+        input.SIMULATION_MONTECARLO = false;
         string err;
         readParamMenu(input, data["PARAMETER MENU"]);
 
@@ -263,6 +272,46 @@ TEST_CASE("Read Yaml File"){
         REQUIRE(input.PARAMETER_PARAM_MAP["COREEXITTEMP"][0] == 547.3);
         REQUIRE(input.PARAMETER_PARAM_MAP["BYPASSAREA"][0] == 1.804);
     }
+    SECTION("Read Param Menu for Monte Carlo runs"){
+        YAML::Node paramNode = YAML::Clone(data["PARAMETER MENU"]);
+        paramNode["METEOROLOGICAL PARAMETERS SUBMENU"]["Temperature [K] (double)"] = "215:225";
+        paramNode["METEOROLOGICAL PARAMETERS SUBMENU"]["Pressure [hPa] (double)"] = "220:240";
+        OptInput input;
+        input.SIMULATION_MONTECARLO = true;
+        input.SIMULATION_MCRUNS = 5;
+        input.SIMULATION_RANDOM_SEED = 3;
+        readParamMenu(input, paramNode);
+
+        REQUIRE(input.PARAMETER_PARAM_MAP["TEMPERATURE"].size() == 5);
+        for (double d: input.PARAMETER_PARAM_MAP["TEMPERATURE"]){
+            REQUIRE(d >= 215);
+            REQUIRE(d <= 225);
+        }
+        for (double d: input.PARAMETER_PARAM_MAP["PRESSURE"]){
+            REQUIRE(d >= 22000);
+            REQUIRE(d <= 24000);
+        }
+        //Constants are repeated in every run
+        REQUIRE(input.PARAMETER_PARAM_MAP["RHW"] == Vector_1D(5, 43.9432));
+
+        //The samples come from the seed
+        OptInput same = input;
+        readParamMenu(same, paramNode);
+        REQUIRE(same.PARAMETER_PARAM_MAP["TEMPERATURE"] == input.PARAMETER_PARAM_MAP["TEMPERATURE"]);
+        OptInput other = input;
+        other.SIMULATION_RANDOM_SEED = 4;
+        readParamMenu(other, paramNode);
+        REQUIRE(other.PARAMETER_PARAM_MAP["TEMPERATURE"] != input.PARAMETER_PARAM_MAP["TEMPERATURE"]);
+
+        //Run i takes the i-th sample of every parameter
+        vector<std::unordered_map<string,double>> cases = generateCases(input);
+        REQUIRE(cases.size() == 5);
+        for (int i = 0; i < 5; i++){
+            REQUIRE(cases[i]["TEMPERATURE"] == input.PARAMETER_PARAM_MAP["TEMPERATURE"][i]);
+            REQUIRE(cases[i]["PRESSURE"] == input.PARAMETER_PARAM_MAP["PRESSURE"][i]);
+            REQUIRE(cases[i]["RHW"] == 43.9432);
+        }
+    }
     SECTION("Read Transport Menu"){
         OptInput input;
         readTransportMenu(input, data["TRANSPORT MENU"]);
@@ -280,6 +329,9 @@ TEST_CASE("Read Yaml File"){
         REQUIRE(input.CHEMISTRY_HETCHEM == true);
         REQUIRE(input.CHEMISTRY_TIMESTEP == 10);
         REQUIRE(input.CHEMISTRY_JRATE_FOLDER == "/net/d04/data/fritzt/APCEMM_Data/J-Rates");
+        REQUIRE(input.CHEMISTRY_CLUSTER_RTOL == 0.0);
+        REQUIRE(input.CHEMISTRY_RCONST_DT == 0.01);
+        REQUIRE(input.CHEMISTRY_BATCH);
     }
     SECTION("Read Aerosol Menu"){
         OptInput input;
@@ -347,6 +399,11 @@ TEST_CASE("Read Yaml File"){
         REQUIRE(input.TS_AEROSOL.size() == 3);
         REQUIRE(input.TS_AEROSOL[2] == 5);
         REQUIRE(input.TS_AERO_FREQ == 10);
+        REQUIRE(input.TS_AERO_APPEND == false);
+        REQUIRE(input.TS_AERO_VARS.empty());
+        REQUIRE(input.TS_AERO_DEFLATE == 0);
+        REQUIRE(input.TS_AERO_SIGDIGITS.empty());
+        REQUIRE(input.TS_AERO_RESAMPLE == false);
         REQUIRE(input.PL_PL == true);
         REQUIRE(input.PL_O3 == true);
     }
@@ -371,6 +428,7 @@ TEST_CASE("Read Yaml File"){
 }
 TEST_CASE("Generate All Cases"){
     OptInput input;
+    input.SIMULATION_MONTECARLO = false;
     input.PARAMETER_PARAM_MAP = {{"test1", {1}}};
     vector<std::unordered_map<string,double>> combinations = generateCases(input);
     REQUIRE(combinations.size() == 1);